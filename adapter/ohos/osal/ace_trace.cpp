@@ -26,13 +26,16 @@ namespace OHOS::Ace {
 
 bool AceTraceEnabled()
 {
-    return SystemProperties::GetTraceEnabled();
+    // nothing is formatted unless hitrace is capturing ace traces.
+    return SystemProperties::GetTraceEnabled() && IsTagEnabled(HITRACE_TAG_ACE);
 }
 
 void AceTraceBegin(const char* name)
 {
     CHECK_NULL_VOID(name);
-    std::string nameStr(name);
+    // reuse the buffer of the thread, traces of a frame do not allocate once it has grown.
+    thread_local std::string nameStr;
+    nameStr.assign(name);
     StartTrace(HITRACE_TAG_ACE, nameStr);
 }
 
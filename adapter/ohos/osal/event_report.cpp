@@ -66,6 +66,7 @@ constexpr char EVENT_KEY_SOURCE_TYPE[] = "SOURCE_TYPE";
 constexpr char EVENT_KEY_NOTE[] = "NOTE";
 constexpr char EVENT_KEY_DISPLAY_ANIMATOR[] = "DISPLAY_ANIMATOR";
 constexpr char EVENT_KEY_SKIPPED_FRAME_TIME[] = "SKIPPED_FRAME_TIME";
+constexpr char EVENT_KEY_JANK_CAUSE[] = "JANK_CAUSE";
 
 constexpr int32_t MAX_PACKAGE_NAME_LENGTH = 128;
 
@@ -368,6 +369,7 @@ void EventReport::ReportEventJankFrame(DataBase& data)
     const auto& totalMissedFrames = data.totalMissed;
     const auto& maxFrameTime = data.maxFrameTime / NS_TO_MS;
     const auto& maxSeqMissedFrames = data.maxSuccessiveFrames;
+    const auto& maxFrameCause = data.maxFrameCause;
     const auto& note = data.baseInfo.note;
     const auto& isDisplayAnimator = data.isDisplayAnimator;
     HiSysEventWrite(OHOS::HiviewDFX::HiSysEvent::Domain::ACE, eventName,
@@ -387,7 +389,8 @@ void EventReport::ReportEventJankFrame(DataBase& data)
         EVENT_KEY_MAX_FRAMETIME, static_cast<uint64_t>(maxFrameTime),
         EVENT_KEY_MAX_SEQ_MISSED_FRAMES, maxSeqMissedFrames,
         EVENT_KEY_NOTE, note,
-        EVENT_KEY_DISPLAY_ANIMATOR, isDisplayAnimator);
+        EVENT_KEY_DISPLAY_ANIMATOR, isDisplayAnimator,
+        EVENT_KEY_JANK_CAUSE, maxFrameCause);
     ACE_SCOPED_TRACE("INTERACTION_APP_JANK: inputTime=%lld(ms), maxFrameTime=%lld(ms)",
         static_cast<long long>(startTime), static_cast<long long>(maxFrameTime));
 }
@@ -402,6 +405,7 @@ void EventReport::ReportJankFrameApp(JankInfo& info)
     const auto& versionCode = info.baseInfo.versionCode;
     const auto& versionName = info.baseInfo.versionName;
     const auto& skippedFrameTime = info.skippedFrameTime;
+    const auto& jankCause = info.jankCause;
     HiSysEventWrite(OHOS::HiviewDFX::HiSysEvent::Domain::ACE, eventName,
         OHOS::HiviewDFX::HiSysEvent::EventType::FAULT,
         EVENT_KEY_PROCESS_NAME, processName,
@@ -410,7 +414,8 @@ void EventReport::ReportJankFrameApp(JankInfo& info)
         EVENT_KEY_PAGE_URL, pageUrl,
         EVENT_KEY_VERSION_CODE, versionCode,
         EVENT_KEY_VERSION_NAME, versionName,
-        EVENT_KEY_SKIPPED_FRAME_TIME, static_cast<uint64_t>(skippedFrameTime));
+        EVENT_KEY_SKIPPED_FRAME_TIME, static_cast<uint64_t>(skippedFrameTime),
+        EVENT_KEY_JANK_CAUSE, jankCause);
     ACE_SCOPED_TRACE("JANK_FRAME_APP: skipppedFrameTime=%lld(ms)", static_cast<long long>(skippedFrameTime / NS_TO_MS));
 }
 
@@ -24,6 +24,7 @@
 #include "parameter.h"
 #include "parameters.h"
 
+#include "base/log/ace_trace.h"
 #include "base/log/log.h"
 #include "base/utils/utils.h"
 #include "core/common/ace_application_info.h"
@@ -44,6 +45,8 @@ constexpr char ENABLE_DEBUG_BOUNDARY_KEY[] = "persist.ace.debug.boundary.enabled
 constexpr char ENABLE_DOWNLOAD_BY_NETSTACK_KEY[] = "persist.ace.download.netstack.enabled";
 constexpr char ANIMATION_SCALE_KEY[] = "persist.sys.arkui.animationscale";
 constexpr char CUSTOM_TITLE_KEY[] = "persist.sys.arkui.customtitle";
+// bits of AceTraceCategory, in hex or decimal.
+constexpr char TRACE_CATEGORY_KEY[] = "persist.ace.trace.category";
 constexpr int32_t ORIENTATION_PORTRAIT = 0;
 constexpr int32_t ORIENTATION_LANDSCAPE = 1;
 constexpr int DEFAULT_THRESHOLD_JANK = 15;
@@ -77,6 +80,27 @@ bool IsTraceEnabled()
     return (system::GetParameter("persist.ace.trace.enabled", "1") == "1");
 }
 
+uint32_t GetTraceCategoryMask(const char* value)
+{
+    CHECK_NULL_RETURN(value, ACE_TRACE_CATEGORY_ALL);
+    char* end = nullptr;
+    auto mask = std::strtoul(value, &end, 0);
+    if (end == value || mask > ACE_TRACE_CATEGORY_ALL) {
+        return ACE_TRACE_CATEGORY_ALL;
+    }
+    return static_cast<uint32_t>(mask);
+}
+
+void OnTraceCategoryChanged(const char* key, const char* value, void* context)
+{
+    CHECK_NULL_VOID(key);
+    if (strcmp(key, TRACE_CATEGORY_KEY) != 0) {
+        LOGE("TraceCategory key not matched. key: %{public}s", key);
+        return;
+    }
+    SetAceTraceCategoryMask(GetTraceCategoryMask(value));
+}
+
 bool IsSvgTraceEnabled()
 {
     return (system::GetParameter("persist.ace.trace.svg.enabled", "0") == "1");
@@ -215,6 +239,16 @@ bool IsFlutterDecouplingEnabled()
 {
     return system::GetBoolParameter("persist.ace.flutter.decoupling.enabled", false);
 }
+
+bool IsParallelLayoutEnabled()
+{
+    return system::GetBoolParameter("persist.ace.layout.parallel.enabled", false);
+}
+
+int32_t GetTouchPredictorProp()
+{
+    return system::GetIntParameter<int>("persist.ace.touch.predictor", 0);
+}
 } // namespace
 
 bool SystemProperties::traceEnabled_ = IsTraceEnabled();
@@ -257,6 +291,8 @@ ACE_WEAK_SYM uint32_t SystemProperties::dumpFrameCount_ = GetSysDumpFrameCount()
 bool SystemProperties::resourceDecoupling_ = GetResourceDecoupling();
 bool SystemProperties::changeTitleStyleEnabled_ = IsTitleStyleEnabled();
 bool SystemProperties::flutterDecouplingEnabled_ = IsFlutterDecouplingEnabled();
+bool SystemProperties::parallelLayoutEnabled_ = IsParallelLayoutEnabled();
+int32_t SystemProperties::touchPredictor_ = GetTouchPredictorProp();
 
 bool SystemProperties::IsSyscapExist(const char* cap)
 {
@@ -368,6 +404,8 @@ void SystemProperties::InitDeviceInfo(
     debugEnabled_ = IsDebugEnabled();
     traceEnabled_ = IsTraceEnabled();
     svgTraceEnable_ = IsSvgTraceEnabled();
+    SetAceTraceCategoryMask(GetTraceCategoryMask(system::GetParameter(TRACE_CATEGORY_KEY, "").c_str()));
+    WatchParameter(TRACE_CATEGORY_KEY, OnTraceCategoryChanged, nullptr);
     accessibilityEnabled_ = IsAccessibilityEnabled();
     rosenBackendEnabled_ = IsRosenBackendEnabled();
     isHookModeEnabled_ = IsHookModeEnabled();
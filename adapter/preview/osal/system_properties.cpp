@@ -81,6 +81,8 @@ bool SystemProperties::rosenBackendEnabled_ = false;
 bool SystemProperties::rosenBackendEnabled_ = true;
 #endif
 bool SystemProperties::flutterDecouplingEnabled_ = true;
+bool SystemProperties::parallelLayoutEnabled_ = false;
+int32_t SystemProperties::touchPredictor_ = 0;
 
 void SystemProperties::InitDeviceType(DeviceType type)
 {
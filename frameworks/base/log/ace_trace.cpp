@@ -15,6 +15,8 @@
 
 #include "base/log/ace_trace.h"
 
+#include <cstring>
+
 #ifndef WINDOWS_PLATFORM
 #include "securec.h"
 #endif
@@ -24,10 +26,26 @@ namespace {
 
 const size_t MAX_STRING_SIZE = 128;
 
+std::atomic<uint32_t> g_traceCategoryMask = ACE_TRACE_CATEGORY_ALL;
+} // namespace
+
+uint32_t GetAceTraceCategoryMask()
+{
+    return g_traceCategoryMask.load(std::memory_order_relaxed);
+}
+
+void SetAceTraceCategoryMask(uint32_t mask)
+{
+    g_traceCategoryMask.store(mask, std::memory_order_relaxed);
 }
 
 bool AceTraceBeginWithArgv(const char* format, va_list args)
 {
+    // names without conversions, such as those of ACE_FUNCTION_TRACE, are traced as they are.
+    if (strchr(format, '%') == nullptr) {
+        AceTraceBegin(format);
+        return true;
+    }
     char name[MAX_STRING_SIZE] = { 0 };
     if (vsnprintf_s(name, sizeof(name), sizeof(name) - 1, format, args) < 0) {
         return false;
@@ -57,7 +75,8 @@ void AceCountTraceWidthArgs(int32_t count, const char* format, ...)
     AceCountTrace(name, count);
 }
 
-AceScopedTrace::AceScopedTrace(const char* format, ...) : traceEnabled_(AceTraceEnabled())
+AceScopedTrace::AceScopedTrace(const char* format, ...)
+    : traceEnabled_(AceTraceCategoryEnabled(AceTraceCategory::DEFAULT) && AceTraceEnabled())
 {
     if (traceEnabled_) {
         va_list args;
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -37,10 +38,39 @@
 
 #define ACE_FUNCTION_TRACE() ACE_SCOPED_TRACE(__func__)
 
+// Traces of a category are only formatted while the category is in the mask, see SetAceTraceCategoryMask.
+#define ACE_CATEGORY_SCOPED_TRACE(category, fmt, ...) \
+    AceScopedTraceFlag aceScopedTraceFlag(AceTraceCategoryEnabled(category), fmt, ##__VA_ARGS__)
+#define ACE_LAYOUT_SCOPED_TRACE(fmt, ...) ACE_CATEGORY_SCOPED_TRACE(AceTraceCategory::LAYOUT, fmt, ##__VA_ARGS__)
+#define ACE_IMAGE_SCOPED_TRACE(fmt, ...) ACE_CATEGORY_SCOPED_TRACE(AceTraceCategory::IMAGE, fmt, ##__VA_ARGS__)
+#define ACE_GESTURE_SCOPED_TRACE(fmt, ...) ACE_CATEGORY_SCOPED_TRACE(AceTraceCategory::GESTURE, fmt, ##__VA_ARGS__)
+#define ACE_ANIMATION_SCOPED_TRACE(fmt, ...) \
+    ACE_CATEGORY_SCOPED_TRACE(AceTraceCategory::ANIMATION, fmt, ##__VA_ARGS__)
+
 #define ACE_COUNT_TRACE(count, fmt, ...) AceCountTraceWidthArgs(count, fmt, ##__VA_ARGS__)
 
 namespace OHOS::Ace {
 
+// Bits of the trace category mask, ACE_SCOPED_TRACE belongs to DEFAULT.
+enum class AceTraceCategory : uint32_t {
+    DEFAULT = 1,
+    LAYOUT = 1 << 1,
+    IMAGE = 1 << 2,
+    GESTURE = 1 << 3,
+    ANIMATION = 1 << 4,
+};
+
+inline constexpr uint32_t ACE_TRACE_CATEGORY_ALL = UINT32_MAX;
+
+uint32_t ACE_EXPORT GetAceTraceCategoryMask();
+// Takes effect for traces starting after the call, all categories are on by default.
+void ACE_EXPORT SetAceTraceCategoryMask(uint32_t mask);
+
+inline bool AceTraceCategoryEnabled(AceTraceCategory category)
+{
+    return (GetAceTraceCategoryMask() & static_cast<uint32_t>(category)) != 0;
+}
+
 bool ACE_EXPORT AceTraceEnabled();
 bool ACE_EXPORT AceAsyncTraceEnable();
 void ACE_EXPORT AceTraceBegin(const char* name);
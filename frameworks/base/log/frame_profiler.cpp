@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/frame_profiler.h"
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "base/log/dump_log.h"
+#include "base/log/log_wrapper.h"
+#include "base/utils/time_util.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+// "ACEFPROF", followed by the version, the size of a record, the tag count and the record count as uint32_t.
+constexpr char BINARY_MAGIC[] = { 'A', 'C', 'E', 'F', 'P', 'R', 'O', 'F' };
+constexpr uint32_t BINARY_VERSION = 1;
+constexpr int64_t NANOS_PER_MICRO = 1000;
+constexpr uint8_t MAX_THREAD_INDEX = std::numeric_limits<uint8_t>::max();
+
+constexpr const char* FRAME_PHASE_NAMES[] = {
+    "Frame",
+    "Animation",
+    "Touch",
+    "Build",
+    "Measure",
+    "Layout",
+    "AfterLayout",
+    "Render",
+};
+static_assert(std::size(FRAME_PHASE_NAMES) == static_cast<size_t>(FramePhase::COUNT));
+static_assert(std::is_trivially_copyable_v<FrameProfileRecord>);
+static_assert(sizeof(FrameProfileRecord) == 24, "binary dumps rely on the layout of FrameProfileRecord");
+static_assert(sizeof(FrameProfileRecord) % sizeof(uint64_t) == 0);
+
+template<typename T>
+void WriteValue(std::ostream& out, T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+std::string FormatMicros(int64_t nanos)
+{
+    // Chrome trace takes microseconds, keep the fraction for tasks shorter than a microsecond.
+    auto micros = std::to_string(nanos / NANOS_PER_MICRO);
+    auto fraction = std::to_string(nanos % NANOS_PER_MICRO);
+    return micros + "." + std::string(3 - fraction.length(), '0') + fraction;
+}
+
+// Writes |text| as the content of a JSON string, tags are node tags and task names given by the app.
+void WriteJsonEscaped(std::ostream& out, const std::string& text)
+{
+    constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    constexpr int32_t HEX_SHIFT = 4;
+    constexpr uint8_t HEX_MASK = 0xf;
+    constexpr uint8_t FIRST_PRINTABLE = 0x20;
+    for (char ch : text) {
+        auto code = static_cast<uint8_t>(ch);
+        if (ch == '"' || ch == '\\') {
+            out << '\\' << ch;
+        } else if (code < FIRST_PRINTABLE) {
+            out << "\\u00" << HEX_DIGITS[code >> HEX_SHIFT] << HEX_DIGITS[code & HEX_MASK];
+        } else {
+            out << ch;
+        }
+    }
+}
+} // namespace
+
+std::atomic<bool> FrameProfiler::enabled_ = false;
+
+const char* GetFramePhaseName(FramePhase phase)
+{
+    auto index = static_cast<size_t>(phase);
+    return index < std::size(FRAME_PHASE_NAMES) ? FRAME_PHASE_NAMES[index] : "Unknown";
+}
+
+FrameProfiler& FrameProfiler::GetInstance()
+{
+    static FrameProfiler instance;
+    return instance;
+}
+
+void FrameProfiler::Enable(size_t capacity)
+{
+    {
+        std::lock_guard<std::mutex> lock(tagMutex_);
+        if (!slots_) {
+            capacity_ = RoundUpToPowerOfTwo(std::max<size_t>(capacity, 1));
+            slots_ = std::make_unique<Slot[]>(capacity_);
+        }
+    }
+    enabled_.store(true, std::memory_order_release);
+}
+
+void FrameProfiler::Disable()
+{
+    enabled_.store(false, std::memory_order_release);
+}
+
+void FrameProfiler::Clear()
+{
+    CHECK_NULL_VOID(slots_);
+    for (size_t i = 0; i < capacity_; ++i) {
+        slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+void FrameProfiler::SetCostSink(FrameCostSink* sink)
+{
+    GetThreadCostSink() = sink;
+}
+
+FrameCostSink* FrameProfiler::GetCostSink()
+{
+    return GetThreadCostSink();
+}
+
+FrameCostSink*& FrameProfiler::GetThreadCostSink()
+{
+    static thread_local FrameCostSink* sink = nullptr;
+    return sink;
+}
+
+int64_t FrameProfileScope::Now()
+{
+    return GetSysTimestamp();
+}
+
+uint8_t FrameProfiler::GetThreadIndex()
+{
+    static std::atomic<uint8_t> nextIndex = 0;
+    // threads after the 255th share the last index.
+    thread_local uint8_t index = [] {
+        auto next = nextIndex.load(std::memory_order_relaxed);
+        while (next < MAX_THREAD_INDEX && !nextIndex.compare_exchange_weak(next, static_cast<uint8_t>(next + 1))) {
+        }
+        return next;
+    }();
+    return index;
+}
+
+void FrameProfiler::Record(FramePhase phase, int32_t id, uint16_t tagId, int64_t begin, int64_t duration)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    auto index = writeIndex_.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = slots_[index & (capacity_ - 1)];
+    // writers own a slot between the two stores, readers seeing 0 or a different sequence drop the record.
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    FrameProfileRecord record { begin, duration, id, tagId, phase, GetThreadIndex() };
+    uint64_t words[RECORD_WORD_COUNT];
+    std::memcpy(words, &record, sizeof(record));
+    for (size_t i = 0; i < RECORD_WORD_COUNT; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+uint16_t FrameProfiler::InternTag(const std::string& tag)
+{
+    thread_local std::unordered_map<std::string, uint16_t> cachedTagIds;
+    auto iter = cachedTagIds.find(tag);
+    if (iter != cachedTagIds.end()) {
+        return iter->second;
+    }
+    std::lock_guard<std::mutex> lock(tagMutex_);
+    if (tags_.empty()) {
+        tags_.emplace_back("");
+        tagIds_.emplace("", UNKNOWN_TAG);
+    }
+    auto tagId = UNKNOWN_TAG;
+    auto tagIter = tagIds_.find(tag);
+    if (tagIter != tagIds_.end()) {
+        tagId = tagIter->second;
+    } else if (tags_.size() <= std::numeric_limits<uint16_t>::max()) {
+        tagId = static_cast<uint16_t>(tags_.size());
+        tags_.emplace_back(tag);
+        tagIds_.emplace(tag, tagId);
+    } else {
+        // too many distinct tags, leave the rest unnamed.
+        return UNKNOWN_TAG;
+    }
+    cachedTagIds.emplace(tag, tagId);
+    return tagId;
+}
+
+std::string FrameProfiler::GetTag(uint16_t tagId) const
+{
+    std::lock_guard<std::mutex> lock(tagMutex_);
+    return tagId < tags_.size() ? tags_[tagId] : "";
+}
+
+std::vector<FrameProfileRecord> FrameProfiler::GetRecords() const
+{
+    std::vector<FrameProfileRecord> records;
+    CHECK_NULL_RETURN(slots_, records);
+    auto end = writeIndex_.load(std::memory_order_acquire);
+    auto begin = end > capacity_ ? end - capacity_ : 0;
+    records.reserve(end - begin);
+    for (auto index = begin; index < end; ++index) {
+        const auto& slot = slots_[index & (capacity_ - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+            continue;
+        }
+        uint64_t words[RECORD_WORD_COUNT];
+        for (size_t i = 0; i < RECORD_WORD_COUNT; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != index + 1) {
+            continue;
+        }
+        FrameProfileRecord record;
+        std::memcpy(&record, words, sizeof(record));
+        records.emplace_back(record);
+    }
+    return records;
+}
+
+void FrameProfiler::DumpBinary(std::ostream& out) const
+{
+    auto records = GetRecords();
+    std::vector<std::string> tags;
+    {
+        std::lock_guard<std::mutex> lock(tagMutex_);
+        tags = tags_;
+    }
+    out.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    WriteValue<uint32_t>(out, BINARY_VERSION);
+    WriteValue<uint32_t>(out, sizeof(FrameProfileRecord));
+    WriteValue<uint32_t>(out, tags.size());
+    WriteValue<uint32_t>(out, records.size());
+    // each tag as its uint16_t length and its characters, the tag id is the position in the list.
+    for (const auto& tag : tags) {
+        WriteValue<uint16_t>(out, tag.length());
+        out.write(tag.data(), tag.length());
+    }
+    out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(FrameProfileRecord));
+    out.flush();
+}
+
+void FrameProfiler::DumpChromeTrace(std::ostream& out) const
+{
+    auto records = GetRecords();
+    std::vector<std::string> tags;
+    {
+        std::lock_guard<std::mutex> lock(tagMutex_);
+        tags = tags_;
+    }
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& record : records) {
+        if (!first) {
+            out << ",";
+        }
+        first = false;
+        // complete events nest by time on each thread, tasks of a frame show under the frame.
+        out << "\n{\"name\":\"" << GetFramePhaseName(record.phase);
+        if (record.tagId != UNKNOWN_TAG && record.tagId < tags.size()) {
+            out << " ";
+            WriteJsonEscaped(out, tags[record.tagId]);
+        }
+        out << "\",\"cat\":\"" << GetFramePhaseName(record.phase) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+            << static_cast<int32_t>(record.threadIndex) << ",\"ts\":" << FormatMicros(record.begin)
+            << ",\"dur\":" << FormatMicros(record.duration) << ",\"args\":{\"id\":" << record.id << "}}";
+    }
+    out << "\n]}\n";
+    out.flush();
+}
+
+void FrameProfiler::OnDumpInfo(const std::vector<std::string>& params)
+{
+    const auto& dumpFile = DumpLog::GetInstance().GetDumpFile();
+    CHECK_NULL_VOID(dumpFile);
+    auto command = params.size() > 1 ? params[1] : "";
+    if (command == "on") {
+        Enable();
+        DumpLog::GetInstance().Print("FrameProfiler is on, capacity: " + std::to_string(capacity_));
+    } else if (command == "off") {
+        Disable();
+        DumpLog::GetInstance().Print("FrameProfiler is off");
+    } else if (command == "clear") {
+        Clear();
+    } else if (command == "json") {
+        DumpChromeTrace(*dumpFile);
+    } else if (command == "binary") {
+        DumpBinary(*dumpFile);
+    } else {
+        DumpLog::GetInstance().Print("Usage: -frameprofile <on|off|clear|json|binary>");
+        DumpLog::GetInstance().Print(1, "on/off: start or stop recording the tasks of each frame");
+        DumpLog::GetInstance().Print(1, "json: Chrome trace of the recorded tasks, opened by Perfetto as well");
+        DumpLog::GetInstance().Print(1, "binary: the records as they are in memory, with their tags");
+    }
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_PROFILER_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+enum class FramePhase : uint8_t {
+    FRAME = 0,
+    ANIMATION,
+    TOUCH,
+    BUILD,
+    MEASURE,
+    LAYOUT,
+    AFTER_LAYOUT,
+    RENDER,
+    COUNT,
+};
+
+const char* GetFramePhaseName(FramePhase phase);
+
+// One timed task of a frame, kept small and trivially copyable so that recording is a copy into the ring.
+struct FrameProfileRecord {
+    // GetSysTimestamp() when the task began, in nanoseconds.
+    int64_t begin = 0;
+    int64_t duration = 0;
+    // node id, or the vsync count for FramePhase::FRAME.
+    int32_t id = -1;
+    // see FrameProfiler::GetTag.
+    uint16_t tagId = 0;
+    FramePhase phase = FramePhase::FRAME;
+    // profiler-wide index of the recording thread, 0 for the first thread recording.
+    uint8_t threadIndex = 0;
+};
+
+// Takes the tasks timed by FrameProfileScope on the thread it is set for, whether the profiler is enabled or not.
+class FrameCostSink {
+public:
+    virtual ~FrameCostSink() = default;
+    // |id| is -1 for a phase which is not the task of one node.
+    virtual void AddCost(FramePhase phase, int32_t id, uint16_t tagId, int64_t duration) = 0;
+};
+
+// FrameProfiler keeps the latest frame tasks in a fixed ring of records, written without locks by the ui thread and
+// the layout threads. It costs one atomic load per task while disabled, the ring is not allocated until it is enabled.
+// Records are exported as a compact binary dump or as Chrome trace JSON, which Perfetto opens as well.
+class ACE_FORCE_EXPORT FrameProfiler final {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 16384;
+    static constexpr uint16_t UNKNOWN_TAG = 0;
+
+    static FrameProfiler& GetInstance();
+
+    static bool IsEnabled()
+    {
+        return enabled_.load(std::memory_order_acquire);
+    }
+
+    // The sink of the calling thread, nullptr to stop sending tasks to it.
+    static void SetCostSink(FrameCostSink* sink);
+    static FrameCostSink* GetCostSink();
+
+    // |capacity| is rounded up to a power of two and fixed by the first call, the newest records overwrite the oldest.
+    void Enable(size_t capacity = DEFAULT_CAPACITY);
+    void Disable();
+    void Clear();
+
+    void Record(FramePhase phase, int32_t id, uint16_t tagId, int64_t begin, int64_t duration);
+
+    // Tags are interned once, records refer to them by id. Each thread caches the ids it has seen, so only the
+    // first use of a tag on a thread takes a lock.
+    uint16_t InternTag(const std::string& tag);
+    std::string GetTag(uint16_t tagId) const;
+
+    // Records still in the ring, oldest first.
+    std::vector<FrameProfileRecord> GetRecords() const;
+
+    void DumpBinary(std::ostream& out) const;
+    void DumpChromeTrace(std::ostream& out) const;
+    // Handles "-frameprofile <on|off|clear|json|binary>" of OnDumpInfo, prints the usage for anything else.
+    void OnDumpInfo(const std::vector<std::string>& params);
+
+private:
+    static constexpr size_t RECORD_WORD_COUNT = sizeof(FrameProfileRecord) / sizeof(uint64_t);
+
+    // |sequence| is one past the index of the record it holds, readers skip slots changed while being copied.
+    // The record is kept in relaxed atomic words, which are plain loads and stores on the targets we run on.
+    struct Slot {
+        std::atomic<uint64_t> sequence = 0;
+        std::atomic<uint64_t> words[RECORD_WORD_COUNT] = {};
+    };
+
+    FrameProfiler() = default;
+    ~FrameProfiler() = default;
+
+    static uint8_t GetThreadIndex();
+    static FrameCostSink*& GetThreadCostSink();
+
+    static std::atomic<bool> enabled_;
+
+    // slots are kept once allocated, so a thread still recording after Disable() never writes freed memory.
+    std::unique_ptr<Slot[]> slots_;
+    size_t capacity_ = 0;
+    std::atomic<uint64_t> writeIndex_ = 0;
+
+    mutable std::mutex tagMutex_;
+    std::unordered_map<std::string, uint16_t> tagIds_;
+    std::vector<std::string> tags_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameProfiler);
+};
+
+// Records the lifetime of the scope as one task for the profiler and for the cost sink of the thread. When given,
+// |duration| is increased by it as well. No timestamp is taken while none of them wants it.
+class FrameProfileScope final {
+public:
+    explicit FrameProfileScope(FramePhase phase, int32_t id = -1)
+        : enabled_(FrameProfiler::IsEnabled()), sink_(FrameProfiler::GetCostSink()), phase_(phase), id_(id)
+    {
+        if (enabled_ || sink_) {
+            begin_ = Now();
+        }
+    }
+
+    FrameProfileScope(FramePhase phase, int32_t id, const std::string& tag, int64_t* duration = nullptr)
+        : enabled_(FrameProfiler::IsEnabled()), sink_(FrameProfiler::GetCostSink()), phase_(phase), id_(id),
+          duration_(duration)
+    {
+        if (enabled_ || sink_) {
+            tagId_ = FrameProfiler::GetInstance().InternTag(tag);
+        }
+        if (enabled_ || sink_ || duration_) {
+            begin_ = Now();
+        }
+    }
+
+    ~FrameProfileScope()
+    {
+        if (!enabled_ && !sink_ && !duration_) {
+            return;
+        }
+        auto duration = Now() - begin_;
+        if (enabled_) {
+            FrameProfiler::GetInstance().Record(phase_, id_, tagId_, begin_, duration);
+        }
+        if (sink_) {
+            sink_->AddCost(phase_, id_, tagId_, duration);
+        }
+        if (duration_) {
+            *duration_ += duration;
+        }
+    }
+
+private:
+    static int64_t Now();
+
+    bool enabled_ = false;
+    FrameCostSink* sink_ = nullptr;
+    FramePhase phase_;
+    int32_t id_;
+    int64_t* duration_ = nullptr;
+    uint16_t tagId_ = FrameProfiler::UNKNOWN_TAG;
+    int64_t begin_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameProfileScope);
+};
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_PROFILER_H
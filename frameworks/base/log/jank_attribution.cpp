@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/jank_attribution.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "base/log/dump_log.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr char BINARY_MAGIC[] = { 'A', 'C', 'E', 'J', 'A', 'N', 'K', '\0' };
+constexpr uint32_t BINARY_VERSION = 1;
+constexpr int64_t NANOS_PER_MILLI = 1000000;
+constexpr int64_t NANOS_PER_CENTI_MILLI = 10000;
+constexpr int64_t CENTI_MILLIS_PER_MILLI = 100;
+constexpr double JANK_THRESHOLD = 1.0;
+
+template<typename T>
+void WriteValue(std::ostream& out, T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+std::string FormatMillis(int64_t nanos)
+{
+    // two decimals are enough to tell frames apart.
+    auto fraction = std::to_string(nanos / NANOS_PER_CENTI_MILLI % CENTI_MILLIS_PER_MILLI);
+    return std::to_string(nanos / NANOS_PER_MILLI) + "." + std::string(2 - fraction.length(), '0') + fraction + "ms";
+}
+
+bool IsMoreExpensive(const TagCost& left, const TagCost& right)
+{
+    return left.duration > right.duration;
+}
+
+// |tags| keeps at most |maxCount| tags, a new tag replaces the cheapest one if it cost more.
+void MergeTagCost(std::vector<TagCost>& tags, const TagCost& cost, size_t maxCount)
+{
+    auto iter = std::find_if(tags.begin(), tags.end(), [&cost](const TagCost& tag) { return tag.tag == cost.tag; });
+    if (iter != tags.end()) {
+        iter->duration += cost.duration;
+        iter->count += cost.count;
+        return;
+    }
+    if (tags.size() < maxCount) {
+        tags.emplace_back(cost);
+        return;
+    }
+    auto cheapest = std::min_element(tags.begin(), tags.end(),
+        [](const TagCost& left, const TagCost& right) { return left.duration < right.duration; });
+    if (cheapest != tags.end() && cheapest->duration < cost.duration) {
+        *cheapest = cost;
+    }
+}
+
+class StringTable {
+public:
+    uint16_t Add(const std::string& value)
+    {
+        auto iter = ids_.find(value);
+        if (iter != ids_.end()) {
+            return iter->second;
+        }
+        if (values_.size() > std::numeric_limits<uint16_t>::max()) {
+            return 0;
+        }
+        auto id = static_cast<uint16_t>(values_.size());
+        ids_.emplace(value, id);
+        values_.emplace_back(&value);
+        return id;
+    }
+
+    uint16_t Get(const std::string& value) const
+    {
+        auto iter = ids_.find(value);
+        return iter != ids_.end() ? iter->second : 0;
+    }
+
+    void Write(std::ostream& out) const
+    {
+        WriteValue<uint32_t>(out, values_.size());
+        for (const auto* value : values_) {
+            auto length = std::min<size_t>(value->length(), std::numeric_limits<uint16_t>::max());
+            WriteValue<uint16_t>(out, length);
+            out.write(value->data(), length);
+        }
+    }
+
+private:
+    std::unordered_map<std::string, uint16_t> ids_;
+    std::vector<const std::string*> values_;
+};
+
+void WriteTagCosts(std::ostream& out, const std::vector<TagCost>& tags, const StringTable& strings)
+{
+    WriteValue<uint8_t>(out, std::min<size_t>(tags.size(), std::numeric_limits<uint8_t>::max()));
+    for (size_t i = 0; i < tags.size() && i < std::numeric_limits<uint8_t>::max(); ++i) {
+        WriteValue<uint16_t>(out, strings.Get(tags[i].tag));
+        WriteValue<int64_t>(out, tags[i].duration);
+        WriteValue<int32_t>(out, tags[i].count);
+    }
+}
+} // namespace
+
+std::string JankFrameCause::ToString() const
+{
+    std::vector<size_t> phases;
+    for (size_t i = 0; i < phaseDurations.size(); ++i) {
+        if (phaseDurations[i] > 0) {
+            phases.emplace_back(i);
+        }
+    }
+    std::sort(phases.begin(), phases.end(),
+        [this](size_t left, size_t right) { return phaseDurations[left] > phaseDurations[right]; });
+    std::string result;
+    for (auto phase : phases) {
+        result.append(result.empty() ? "" : ", ")
+            .append(GetFramePhaseName(static_cast<FramePhase>(phase)))
+            .append(" ")
+            .append(FormatMillis(phaseDurations[phase]));
+    }
+    result.append(" |");
+    for (const auto& node : nodes) {
+        result.append(&node == &nodes.front() ? " " : ", ")
+            .append(node.tag)
+            .append("(")
+            .append(std::to_string(node.id))
+            .append(") ")
+            .append(GetFramePhaseName(node.phase))
+            .append(" ")
+            .append(FormatMillis(node.duration));
+    }
+    result.append(" |");
+    for (const auto& tag : tags) {
+        result.append(&tag == &tags.front() ? " " : ", ")
+            .append(tag.tag)
+            .append(" ")
+            .append(FormatMillis(tag.duration))
+            .append(" x")
+            .append(std::to_string(tag.count));
+    }
+    return result;
+}
+
+void JankAttribution::AddPhaseCost(FramePhase phase, int64_t duration)
+{
+    auto index = static_cast<size_t>(phase);
+    if (index < phaseDurations_.size()) {
+        phaseDurations_[index] += duration;
+    }
+}
+
+void JankAttribution::AddCost(FramePhase phase, int32_t id, uint16_t tagId, int64_t duration)
+{
+    // the costs are attributed to the frame itself.
+    if (phase == FramePhase::FRAME) {
+        return;
+    }
+    if (id == -1) {
+        AddPhaseCost(phase, duration);
+    } else {
+        AddNodeCost(phase, tagId, id, duration);
+    }
+}
+
+void JankAttribution::AddNodeCost(FramePhase phase, uint16_t tagId, int32_t id, int64_t duration)
+{
+    AddPhaseCost(phase, duration);
+
+    if (tagId >= frameTagIndexes_.size()) {
+        frameTagIndexes_.resize(tagId + 1, 0);
+    }
+    auto& tagIndex = frameTagIndexes_[tagId];
+    if (tagIndex > 0) {
+        auto& cost = frameTags_[tagIndex - 1];
+        cost.duration += duration;
+        cost.count++;
+    } else {
+        frameTags_.push_back({ tagId, duration, 1 });
+        tagIndex = static_cast<uint32_t>(frameTags_.size());
+    }
+
+    if (topNodeCount_ == TOP_COUNT && duration <= topNodes_[TOP_COUNT - 1].duration) {
+        return;
+    }
+    // the new node takes the last entry, then moves before the cheaper ones.
+    auto last = topNodeCount_ < TOP_COUNT ? topNodeCount_++ : TOP_COUNT - 1;
+    topNodes_[last] = { tagId, id, phase, duration };
+    auto begin = topNodes_.begin();
+    auto position = std::upper_bound(begin, begin + last, duration,
+        [](int64_t value, const FrameNodeCost& cost) { return value > cost.duration; });
+    std::rotate(position, begin + last, begin + last + 1);
+}
+
+const JankFrameCause* JankAttribution::EndFrame(
+    const std::string& pageUrl, int64_t vsyncTime, int64_t duration, double jank, size_t jankRange)
+{
+    auto& page = GetPage(pageUrl);
+    if (page.frameCount >= MAX_HISTOGRAM_FRAMES) {
+        page.frameCount = 0;
+        for (auto& count : page.frames) {
+            count /= 2;
+            page.frameCount += count;
+        }
+        for (auto& tag : page.tags) {
+            tag.duration /= 2;
+            tag.count /= 2;
+        }
+    }
+    page.frames[std::min(jankRange, JANK_RANGE_COUNT - 1)]++;
+    page.frameCount++;
+
+    JankFrameCause* cause = nullptr;
+    if (jank > JANK_THRESHOLD) {
+        if (jankFrames_.size() >= MAX_FRAME_COUNT) {
+            jankFrames_.pop_front();
+        }
+        cause = &jankFrames_.emplace_back();
+        cause->vsyncTime = vsyncTime;
+        cause->duration = duration;
+        cause->pageUrl = pageUrl;
+        cause->phaseDurations = phaseDurations_;
+        const auto& profiler = FrameProfiler::GetInstance();
+        for (size_t i = 0; i < topNodeCount_; ++i) {
+            const auto& node = topNodes_[i];
+            cause->nodes.push_back({ profiler.GetTag(node.tagId), node.id, node.phase, node.duration });
+        }
+        auto tagCount = std::min(frameTags_.size(), TOP_COUNT);
+        std::partial_sort(frameTags_.begin(), frameTags_.begin() + tagCount, frameTags_.end(),
+            [](const FrameTagCost& left, const FrameTagCost& right) { return left.duration > right.duration; });
+        for (size_t i = 0; i < tagCount; ++i) {
+            const auto& tag = frameTags_[i];
+            cause->tags.push_back({ profiler.GetTag(tag.tagId), tag.duration, tag.count });
+            MergeTagCost(page.tags, cause->tags.back(), MAX_PAGE_TAG_COUNT);
+        }
+    }
+    ResetFrame();
+    return cause;
+}
+
+void JankAttribution::ResetFrame()
+{
+    phaseDurations_.fill(0);
+    topNodeCount_ = 0;
+    for (const auto& tag : frameTags_) {
+        frameTagIndexes_[tag.tagId] = 0;
+    }
+    frameTags_.clear();
+}
+
+PageJankHistogram& JankAttribution::GetPage(const std::string& pageUrl)
+{
+    if (!pages_.empty() && pages_.front().pageUrl == pageUrl) {
+        return pages_.front();
+    }
+    auto iter = std::find_if(
+        pages_.begin(), pages_.end(), [&pageUrl](const PageJankHistogram& page) { return page.pageUrl == pageUrl; });
+    if (iter != pages_.end()) {
+        pages_.splice(pages_.begin(), pages_, iter);
+        return pages_.front();
+    }
+    if (pages_.size() >= MAX_PAGE_COUNT) {
+        pages_.pop_back();
+    }
+    auto& page = pages_.emplace_front();
+    page.pageUrl = pageUrl;
+    return page;
+}
+
+void JankAttribution::Clear()
+{
+    ResetFrame();
+    jankFrames_.clear();
+    pages_.clear();
+}
+
+void JankAttribution::DumpBinary(std::ostream& out) const
+{
+    StringTable strings;
+    for (const auto& page : pages_) {
+        strings.Add(page.pageUrl);
+        for (const auto& tag : page.tags) {
+            strings.Add(tag.tag);
+        }
+    }
+    for (const auto& frame : jankFrames_) {
+        strings.Add(frame.pageUrl);
+        for (const auto& node : frame.nodes) {
+            strings.Add(node.tag);
+        }
+        for (const auto& tag : frame.tags) {
+            strings.Add(tag.tag);
+        }
+    }
+
+    out.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    WriteValue<uint32_t>(out, BINARY_VERSION);
+    // each string as its uint16_t length and its characters.
+    strings.Write(out);
+    // each page as its url, frame count, the count of each jank range and the tags of its janky frames.
+    WriteValue<uint32_t>(out, pages_.size());
+    for (const auto& page : pages_) {
+        WriteValue<uint16_t>(out, strings.Get(page.pageUrl));
+        WriteValue<uint32_t>(out, page.frameCount);
+        for (auto count : page.frames) {
+            WriteValue<uint32_t>(out, count);
+        }
+        WriteTagCosts(out, page.tags, strings);
+    }
+    // each frame as its vsync time, duration, page url, the duration of each FramePhase, its nodes and its tags.
+    WriteValue<uint32_t>(out, jankFrames_.size());
+    for (const auto& frame : jankFrames_) {
+        WriteValue<int64_t>(out, frame.vsyncTime);
+        WriteValue<int64_t>(out, frame.duration);
+        WriteValue<uint16_t>(out, strings.Get(frame.pageUrl));
+        for (auto phaseDuration : frame.phaseDurations) {
+            WriteValue<int64_t>(out, phaseDuration);
+        }
+        WriteValue<uint8_t>(out, frame.nodes.size());
+        for (const auto& node : frame.nodes) {
+            WriteValue<uint16_t>(out, strings.Get(node.tag));
+            WriteValue<int32_t>(out, node.id);
+            WriteValue<uint8_t>(out, static_cast<uint8_t>(node.phase));
+            WriteValue<int64_t>(out, node.duration);
+        }
+        WriteTagCosts(out, frame.tags, strings);
+    }
+    out.flush();
+}
+
+void JankAttribution::Dump() const
+{
+    DumpLog::GetInstance().Print("JankAttribution:");
+    for (const auto& page : pages_) {
+        std::string frames;
+        for (auto count : page.frames) {
+            frames.append(frames.empty() ? "" : ", ").append(std::to_string(count));
+        }
+        DumpLog::GetInstance().Print(1, "Page: " + page.pageUrl + ", frames: " + std::to_string(page.frameCount) +
+                                            ", by jank range: " + frames);
+        auto tags = page.tags;
+        std::sort(tags.begin(), tags.end(), IsMoreExpensive);
+        for (const auto& tag : tags) {
+            DumpLog::GetInstance().Print(
+                2, tag.tag + ": " + FormatMillis(tag.duration) + " x" + std::to_string(tag.count));
+        }
+    }
+    for (const auto& frame : jankFrames_) {
+        DumpLog::GetInstance().Print(1, "JankFrame: vsync " + std::to_string(frame.vsyncTime) + ", duration " +
+                                            FormatMillis(frame.duration) + ", page " + frame.pageUrl);
+        DumpLog::GetInstance().Print(2, frame.ToString());
+    }
+}
+
+void JankAttribution::OnDumpInfo(const std::vector<std::string>& params)
+{
+    auto command = params.size() > 1 ? params[1] : "";
+    if (command == "binary") {
+        const auto& dumpFile = DumpLog::GetInstance().GetDumpFile();
+        CHECK_NULL_VOID(dumpFile);
+        DumpBinary(*dumpFile);
+    } else if (command == "clear") {
+        Clear();
+    } else {
+        Dump();
+    }
+}
+} // namespace OHOS::Ace
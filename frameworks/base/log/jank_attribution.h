@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_JANK_ATTRIBUTION_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_JANK_ATTRIBUTION_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "base/log/frame_profiler.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+// Frames are counted in the jank ranges of JankFrameReport, from under 6 to over 120 refresh periods.
+inline constexpr size_t JANK_RANGE_COUNT = 8;
+
+// Cost of one node in a frame, |tag| is the tag of the node or the view name of a custom node.
+struct NodeCost {
+    std::string tag;
+    int32_t id = -1;
+    FramePhase phase = FramePhase::FRAME;
+    int64_t duration = 0;
+};
+
+// Summed cost of the nodes of one tag, which stands for their pattern.
+struct TagCost {
+    std::string tag;
+    int64_t duration = 0;
+    int32_t count = 0;
+};
+
+// Where the time of a janky frame went, nodes and tags are the most expensive ones, the most expensive first.
+struct JankFrameCause {
+    int64_t vsyncTime = 0;
+    int64_t duration = 0;
+    std::string pageUrl;
+    std::array<int64_t, static_cast<size_t>(FramePhase::COUNT)> phaseDurations {};
+    std::vector<NodeCost> nodes;
+    std::vector<TagCost> tags;
+
+    // Phases, nodes and tags in one line short enough for an event, such as
+    // "Layout 15.20ms, Build 0.80ms | List(12) Layout 15.00ms | List 15.00ms x1".
+    std::string ToString() const;
+};
+
+// Frames of a page by jank range, counts are halved whenever MAX_HISTOGRAM_FRAMES is reached so that the histogram
+// follows the recent frames of a long living page.
+struct PageJankHistogram {
+    std::string pageUrl;
+    uint32_t frameCount = 0;
+    std::array<uint32_t, JANK_RANGE_COUNT> frames {};
+    // tags which cost the most in the janky frames of the page.
+    std::vector<TagCost> tags;
+};
+
+// JankAttribution sums the node and phase costs reported during a frame, and keeps them for the janky frames, so that
+// a jank can be traced back to the nodes which caused it. Each pipeline has its own, set as the cost sink of the ui
+// thread while it flushes a frame, it is fed and read on the ui thread only.
+class ACE_FORCE_EXPORT JankAttribution final : public FrameCostSink {
+public:
+    static constexpr size_t TOP_COUNT = 5;
+    static constexpr size_t MAX_FRAME_COUNT = 32;
+    static constexpr size_t MAX_PAGE_COUNT = 16;
+    static constexpr size_t MAX_PAGE_TAG_COUNT = 16;
+    static constexpr uint32_t MAX_HISTOGRAM_FRAMES = 1024;
+
+    JankAttribution() = default;
+    ~JankAttribution() override = default;
+
+    void AddCost(FramePhase phase, int32_t id, uint16_t tagId, int64_t duration) override;
+    // The cost of a node counts for its phase as well, |tagId| is interned by FrameProfiler.
+    void AddNodeCost(FramePhase phase, uint16_t tagId, int32_t id, int64_t duration);
+    void AddPhaseCost(FramePhase phase, int64_t duration);
+
+    // Ends the current frame and counts it for |pageUrl|. The causes of a frame longer than one refresh period are
+    // kept and returned, they stay valid until the next call. Returns nullptr for other frames.
+    const JankFrameCause* EndFrame(
+        const std::string& pageUrl, int64_t vsyncTime, int64_t duration, double jank, size_t jankRange);
+
+    // Janky frames, the oldest first.
+    const std::deque<JankFrameCause>& GetJankFrames() const
+    {
+        return jankFrames_;
+    }
+
+    // Pages, the latest shown first.
+    const std::list<PageJankHistogram>& GetPages() const
+    {
+        return pages_;
+    }
+
+    void Clear();
+
+    // "ACEJANK\0" and the version as uint32_t, followed by a table of the page urls and tags, the histogram of each
+    // page and the causes of each janky frame. Strings are written once and referred to by their uint16_t index.
+    void DumpBinary(std::ostream& out) const;
+    // Handles "-jank [binary|clear]" of OnDumpInfo, prints the pages and the janky frames without a command.
+    void OnDumpInfo(const std::vector<std::string>& params);
+
+private:
+    // costs of the current frame refer to their tags by id, names are only looked up for a janky frame.
+    struct FrameNodeCost {
+        uint16_t tagId = FrameProfiler::UNKNOWN_TAG;
+        int32_t id = -1;
+        FramePhase phase = FramePhase::FRAME;
+        int64_t duration = 0;
+    };
+
+    struct FrameTagCost {
+        uint16_t tagId = FrameProfiler::UNKNOWN_TAG;
+        int64_t duration = 0;
+        int32_t count = 0;
+    };
+
+    PageJankHistogram& GetPage(const std::string& pageUrl);
+    void ResetFrame();
+    void Dump() const;
+
+    std::array<int64_t, static_cast<size_t>(FramePhase::COUNT)> phaseDurations_ {};
+    // storage of the current frame is reused by the next one, a frame without jank allocates nothing once it grew.
+    std::array<FrameNodeCost, TOP_COUNT> topNodes_;
+    size_t topNodeCount_ = 0;
+    std::vector<FrameTagCost> frameTags_;
+    // one past the index in frameTags_ of each tag id, 0 for the tags not seen in the current frame.
+    std::vector<uint32_t> frameTagIndexes_;
+
+    std::deque<JankFrameCause> jankFrames_;
+    std::list<PageJankHistogram> pages_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(JankAttribution);
+};
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_JANK_ATTRIBUTION_H
@@ -36,6 +36,7 @@ constexpr uint32_t JANK_FRAME_60_FREQ = 5;
 constexpr uint32_t JANK_FRAME_120_FREQ = 6;
 constexpr uint32_t JANK_FRAME_180_FREQ = 7;
 constexpr uint32_t JANK_SIZE = 8;
+static_assert(JANK_SIZE == JANK_RANGE_COUNT);
 
 using namespace std;
 using namespace std::chrono;
@@ -108,6 +109,7 @@ bool JankFrameReport::needReport_ = false;
 bool JankFrameReport::hasJsAnimation_ = false;
 int64_t JankFrameReport::animatorEndTime_ = 0;
 double JankFrameReport::jsAnimationDelayJank_ = 0;
+std::string JankFrameReport::jankCause_;
 
 void JankFrameReport::JankFrameRecord(int64_t timeStampNanos)
 {
@@ -118,8 +120,9 @@ void JankFrameReport::JankFrameRecord(int64_t timeStampNanos)
     int64_t duration = now - std::max(timeStampNanos, prevEndTimeStamp_);
     double jank = double(duration) / refreshPeriod_;
     // perf monitor jank frame
-    PerfMonitor::GetPerfMonitor()->SetFrameTime(timeStampNanos, duration, jank);
+    PerfMonitor::GetPerfMonitor()->SetFrameTime(timeStampNanos, duration, jank, jankCause_);
     RecordJankStatus(jank);
+    jankCause_.clear();
     prevFrameUpdateCount_ = currentFrameUpdateCount_;
     RecordPreviousEnd();
 }
@@ -158,11 +161,11 @@ void JankFrameReport::RecordJankStatus(double jank)
     frameJankRecord_[GetJankRange(jank)]++;
     if (jank >= 6.0f) {
         jankFrameCount_++;
-        ACE_SCOPED_TRACE("JANK_STATS_APP skippedTime=%lld(ms)",
-            static_cast<long long>(jank * refreshPeriod_ / NS_TO_MS));
+        ACE_SCOPED_TRACE("JANK_STATS_APP skippedTime=%lld(ms) cause: %s",
+            static_cast<long long>(jank * refreshPeriod_ / NS_TO_MS), jankCause_.c_str());
         ACE_COUNT_TRACE(jankFrameCount_, "JANK FRAME %s", pageUrl_.c_str());
     }
-    PerfMonitor::GetPerfMonitor()->ReportJankFrameApp(jank);
+    PerfMonitor::GetPerfMonitor()->ReportJankFrameApp(jank, jankCause_);
 }
 
 void JankFrameReport::RecordPreviousEnd()
@@ -239,6 +242,23 @@ void JankFrameReport::FlushRecord()
     ClearFrameJankRecord();
 }
 
+bool JankFrameReport::IsRecording()
+{
+    // the same frames as RecordJankStatus.
+    return recordStatus_ != JANK_IDLE || animatorEndTime_ != 0;
+}
+
+void JankFrameReport::AttributeFrame(JankAttribution& attribution, int64_t vsyncTime, int64_t duration)
+{
+    if (refreshPeriod_ <= 0) {
+        return;
+    }
+    double jank = double(duration) / refreshPeriod_;
+    // the nodes and phases which cost the most, only for janky frames.
+    auto cause = attribution.EndFrame(pageUrl_, vsyncTime, duration, jank, GetJankRange(jank));
+    jankCause_ = cause ? cause->ToString() : "";
+}
+
 void JankFrameReport::ReportJSAnimation()
 {
     if (animatorEndTime_ != 0) {
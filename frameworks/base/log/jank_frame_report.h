@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_JANK_FRAME_REPORT_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_JANK_FRAME_REPORT_H
 
+#include "base/log/jank_attribution.h"
 #include "base/utils/macros.h"
 
 #include <string>
@@ -39,6 +40,11 @@ public:
     static void RecordFrameUpdate();
     static void ReportJSAnimation();
     static void JsAnimationToRsRecord();
+    // Whether the jank of the frames is recorded, their costs are only attributed meanwhile.
+    static bool IsRecording();
+    // Ends the frame of |attribution| which was flushed in |duration|, the cause of a janky frame is reported with the
+    // jank recorded next.
+    static void AttributeFrame(JankAttribution& attribution, int64_t vsyncTime, int64_t duration);
 
 private:
     static void ClearFrameJankRecord();
@@ -59,6 +65,7 @@ private:
     static bool hasJsAnimation_;
     static int64_t animatorEndTime_;
     static double jsAnimationDelayJank_;
+    static std::string jankCause_;
 };
 } // namespace OHOS::Ace
 
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_POOLED_ALLOCATOR_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_POOLED_ALLOCATOR_H
+
+#include <cstddef>
+
+#include "base/memory/slab_pool.h"
+
+// Allocate instances of the class and all its subclasses through 'PooledAllocator'.
+// The class must have a virtual destructor, so that the size of the most derived class reaches operator delete.
+#define ACE_POOLED_ALLOCATION()                                 \
+public:                                                         \
+    static void* operator new(size_t size)                      \
+    {                                                           \
+        return OHOS::Ace::PooledAllocator::Allocate(size);      \
+    }                                                           \
+    static void operator delete(void* ptr, size_t size)         \
+    {                                                           \
+        OHOS::Ace::PooledAllocator::Deallocate(ptr, size);      \
+    }
+
+namespace OHOS::Ace {
+
+// PooledAllocator takes the blocks of instances from 'SlabPool'. Their reference counters are separate blocks of the
+// smallest pools, so a WeakPtr outliving an instance only keeps its counter alive and not the whole block.
+class PooledAllocator final {
+public:
+    static void* Allocate(size_t size)
+    {
+        return SlabPool::AllocateBlock(size);
+    }
+
+    static void Deallocate(void* object, size_t size)
+    {
+        SlabPool::DeallocateBlock(object, size);
+    }
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_POOLED_ALLOCATOR_H
@@ -18,6 +18,7 @@
 
 #include <atomic>
 
+#include "base/memory/slab_pool.h"
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
 
@@ -122,6 +123,16 @@ public:
         return new RefCounterImpl();
     }
 
+    // Reference counters are allocated for every instance, keep them in a slab pool.
+    static void* operator new(size_t size)
+    {
+        return SlabPool::AllocateBlock(size);
+    }
+    static void operator delete(void* ptr, size_t size)
+    {
+        SlabPool::DeallocateBlock(ptr, size);
+    }
+
     int32_t IncStrongRef() final
     {
         return strongRef_.Increase();
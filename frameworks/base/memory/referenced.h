@@ -19,6 +19,7 @@
 #include <string>
 
 #include "base/memory/memory_monitor.h"
+#include "base/memory/pooled_allocator.h"
 #include "base/memory/ref_counter.h"
 #include "base/utils/macros.h"
 #include "base/utils/lifecycle_checkable.h"
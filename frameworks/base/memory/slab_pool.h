@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_SLAB_POOL_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_SLAB_POOL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// SlabPool hands out blocks of one size carved from slabs. Freed blocks are reused by the next allocation of the same
+// size, so building and tearing down trees of small objects does not hit malloc and does not fragment the heap.
+//
+// Each thread keeps a few free blocks of every size in its own cache and only takes the lock of a pool to move a
+// batch of blocks in or out, a block may be freed on another thread than the one it was allocated on. Slabs are
+// aligned to their size, so the slab of a block is found from its address. A slab whose blocks all came back is
+// returned to the heap, except one kept per pool to absorb allocation bursts.
+class SlabPool final {
+public:
+    static constexpr size_t BLOCK_ALIGNMENT = 16;
+    static constexpr size_t MAX_BLOCK_SIZE = 2048;
+    // Slabs are allocated aligned to SLAB_SIZE, so that a freed block finds its slab, and through it its pool, by
+    // masking its address: a block carries no header, and ThreadCache lists mix blocks of several pools. 16KB is a
+    // few pages, large enough to hold 7 of the largest blocks and small enough that an idle pool holds little.
+    static constexpr size_t SLAB_SIZE = 16 * 1024;
+    static_assert((SLAB_SIZE & (SLAB_SIZE - 1)) == 0, "GetSlab masks block addresses with SLAB_SIZE - 1");
+
+    // Returns the pool serving blocks of |size| bytes, or nullptr if |size| is too large to be pooled.
+    static SlabPool* GetPool(size_t size)
+    {
+        if (size == 0 || size > MAX_BLOCK_SIZE) {
+            return nullptr;
+        }
+        // pools are never destroyed, objects released during static destruction may still return blocks.
+        static SlabPool* const* pools = CreatePools();
+        return pools[(size - 1) / BLOCK_ALIGNMENT];
+    }
+
+    // Allocates |size| bytes aligned to BLOCK_ALIGNMENT from the matching pool, or from the heap for large sizes.
+    static void* AllocateBlock(size_t size)
+    {
+        auto pool = GetPool(size);
+        return pool ? pool->Allocate() : ::operator new(size, std::align_val_t(BLOCK_ALIGNMENT));
+    }
+
+    // |size| must be the one the block was allocated with.
+    static void DeallocateBlock(void* block, size_t size)
+    {
+        if (block == nullptr) {
+            return;
+        }
+        if (GetPool(size)) {
+            Deallocate(block);
+        } else {
+            ::operator delete(block, std::align_val_t(BLOCK_ALIGNMENT));
+        }
+    }
+
+    // Returns the blocks cached by the calling thread to their pools.
+    static void FlushThreadCache()
+    {
+        auto cache = GetThreadCache();
+        if (cache) {
+            cache->Flush();
+        }
+    }
+
+    void* Allocate()
+    {
+        auto cache = GetThreadCache();
+        if (!cache) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return AcquireLocked();
+        }
+        auto& bin = cache->bins[index_];
+        if (!bin.head) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i < batchSize_; ++i) {
+                auto block = AcquireLocked();
+                block->next = bin.head;
+                bin.head = block;
+            }
+            bin.count = batchSize_;
+        }
+        auto block = bin.head;
+        bin.head = block->next;
+        --bin.count;
+        return block;
+    }
+
+    static void Deallocate(void* block)
+    {
+        if (block == nullptr) {
+            return;
+        }
+        auto freeBlock = static_cast<FreeBlock*>(block);
+        auto pool = GetSlab(freeBlock)->pool;
+        auto cache = GetThreadCache();
+        if (!cache) {
+            std::lock_guard<std::mutex> lock(pool->mutex_);
+            pool->ReleaseLocked(freeBlock);
+            return;
+        }
+        auto& bin = cache->bins[pool->index_];
+        freeBlock->next = bin.head;
+        bin.head = freeBlock;
+        if (++bin.count <= pool->batchSize_ * 2) {
+            return;
+        }
+        // keep one batch for the next allocations, return the rest.
+        auto last = bin.head;
+        for (size_t i = 1; i < pool->batchSize_; ++i) {
+            last = last->next;
+        }
+        auto rest = last->next;
+        last->next = nullptr;
+        bin.count = pool->batchSize_;
+        ReturnBlocks(rest);
+    }
+
+    size_t GetBlockSize() const
+    {
+        return blockSize_;
+    }
+
+    // Blocks handed out by the pool, including the ones cached by threads.
+    size_t GetUsedCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return usedCount_;
+    }
+
+    size_t GetSlabCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return slabCount_;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next = nullptr;
+    };
+
+    // Header at the start of every slab, its blocks follow.
+    struct Slab {
+        SlabPool* pool = nullptr;
+        // neighbours in the list of slabs with free blocks.
+        Slab* prev = nullptr;
+        Slab* next = nullptr;
+        FreeBlock* freeList = nullptr;
+        size_t usedCount = 0;
+    };
+
+    static constexpr size_t POOL_COUNT = MAX_BLOCK_SIZE / BLOCK_ALIGNMENT;
+    static constexpr size_t SLAB_HEADER_SIZE = (sizeof(Slab) + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+    // blocks moved between a thread cache and a pool at once, about an eighth of a slab.
+    static constexpr size_t MAX_BATCH_SIZE = 16;
+
+    struct ThreadCache {
+        struct Bin {
+            FreeBlock* head = nullptr;
+            size_t count = 0;
+        };
+
+        ThreadCache() = default;
+        ~ThreadCache()
+        {
+            IsThreadCacheDestroyed() = true;
+            Flush();
+        }
+
+        void Flush()
+        {
+            for (auto& bin : bins) {
+                ReturnBlocks(bin.head);
+                bin.head = nullptr;
+                bin.count = 0;
+            }
+        }
+
+        std::array<Bin, POOL_COUNT> bins;
+
+        ACE_DISALLOW_COPY_AND_MOVE(ThreadCache);
+    };
+
+    SlabPool(size_t index, size_t blockSize)
+        : index_(index), blockSize_(blockSize), blockCount_((SLAB_SIZE - SLAB_HEADER_SIZE) / blockSize),
+          batchSize_(std::clamp<size_t>(blockCount_ / 8, 1, MAX_BATCH_SIZE))
+    {}
+    ~SlabPool() = default;
+
+    static SlabPool* const* CreatePools()
+    {
+        auto pools = new std::array<SlabPool*, POOL_COUNT>();
+        for (size_t i = 0; i < POOL_COUNT; ++i) {
+            (*pools)[i] = new SlabPool(i, (i + 1) * BLOCK_ALIGNMENT);
+        }
+        return pools->data();
+    }
+
+    // Trivially destructible, still readable while the thread local objects of an exiting thread are destroyed.
+    static bool& IsThreadCacheDestroyed()
+    {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    // Returns nullptr once the cache of the calling thread is destroyed, blocks then go straight to their pools.
+    static ThreadCache* GetThreadCache()
+    {
+        if (IsThreadCacheDestroyed()) {
+            return nullptr;
+        }
+        static thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    // Every block lies in the first SLAB_SIZE bytes of its slab, which starts at a multiple of SLAB_SIZE.
+    static Slab* GetSlab(FreeBlock* block)
+    {
+        return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(block) & ~(SLAB_SIZE - 1));
+    }
+
+    // Returns a list of blocks, which may belong to several pools, taking the lock of each pool once per run.
+    static void ReturnBlocks(FreeBlock* head)
+    {
+        while (head) {
+            auto pool = GetSlab(head)->pool;
+            std::lock_guard<std::mutex> lock(pool->mutex_);
+            while (head && GetSlab(head)->pool == pool) {
+                auto next = head->next;
+                pool->ReleaseLocked(head);
+                head = next;
+            }
+        }
+    }
+
+    FreeBlock* AcquireLocked()
+    {
+        if (!partialSlabs_) {
+            if (emptySlab_) {
+                LinkSlab(emptySlab_);
+                emptySlab_ = nullptr;
+            } else {
+                AddSlab();
+            }
+        }
+        auto slab = partialSlabs_;
+        auto block = slab->freeList;
+        slab->freeList = block->next;
+        ++slab->usedCount;
+        ++usedCount_;
+        if (!slab->freeList) {
+            UnlinkSlab(slab);
+        }
+        return block;
+    }
+
+    void ReleaseLocked(FreeBlock* block)
+    {
+        auto slab = GetSlab(block);
+        if (!slab->freeList) {
+            LinkSlab(slab);
+        }
+        block->next = slab->freeList;
+        slab->freeList = block;
+        --slab->usedCount;
+        --usedCount_;
+        if (slab->usedCount > 0) {
+            return;
+        }
+        UnlinkSlab(slab);
+        if (!emptySlab_) {
+            emptySlab_ = slab;
+            return;
+        }
+        slab->~Slab();
+        ::operator delete(slab, std::align_val_t(SLAB_SIZE));
+        --slabCount_;
+    }
+
+    void AddSlab()
+    {
+        auto memory = static_cast<uint8_t*>(::operator new(SLAB_SIZE, std::align_val_t(SLAB_SIZE)));
+        auto slab = new (memory) Slab();
+        slab->pool = this;
+        // thread the blocks in address order, so that consecutive allocations stay adjacent.
+        for (size_t i = blockCount_; i > 0; --i) {
+            auto block = new (memory + SLAB_HEADER_SIZE + (i - 1) * blockSize_) FreeBlock();
+            block->next = slab->freeList;
+            slab->freeList = block;
+        }
+        LinkSlab(slab);
+        ++slabCount_;
+    }
+
+    void LinkSlab(Slab* slab)
+    {
+        slab->prev = nullptr;
+        slab->next = partialSlabs_;
+        if (partialSlabs_) {
+            partialSlabs_->prev = slab;
+        }
+        partialSlabs_ = slab;
+    }
+
+    void UnlinkSlab(Slab* slab)
+    {
+        if (slab->prev) {
+            slab->prev->next = slab->next;
+        } else {
+            partialSlabs_ = slab->next;
+        }
+        if (slab->next) {
+            slab->next->prev = slab->prev;
+        }
+        slab->prev = nullptr;
+        slab->next = nullptr;
+    }
+
+    std::mutex mutex_;
+    Slab* partialSlabs_ = nullptr;
+    Slab* emptySlab_ = nullptr;
+    size_t index_ = 0;
+    size_t blockSize_ = 0;
+    size_t blockCount_ = 0;
+    size_t batchSize_ = 0;
+    size_t usedCount_ = 0;
+    size_t slabCount_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(SlabPool);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_SLAB_POOL_H
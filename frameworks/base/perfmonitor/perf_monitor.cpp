@@ -171,7 +171,7 @@ bool SceneRecord::IsTimeOut(int64_t nowTime)
     return false;
 }
 
-void SceneRecord::RecordFrame(int64_t vsyncTime, int64_t duration, int32_t skippedFrames)
+void SceneRecord::RecordFrame(int64_t vsyncTime, int64_t duration, int32_t skippedFrames, const std::string& jankCause)
 {
     if (totalFrames == 0) {
         beginVsyncTime = GetCurrentRealTimeNs();
@@ -197,6 +197,7 @@ void SceneRecord::RecordFrame(int64_t vsyncTime, int64_t duration, int32_t skipp
     }
     if (!isFirstFrame && duration > maxFrameTime) {
         maxFrameTime = duration;
+        maxFrameCause = jankCause;
     }
     totalFrames++;
 }
@@ -221,6 +222,7 @@ void SceneRecord::Reset()
     beginVsyncTime = 0;
     endVsyncTime = 0;
     maxFrameTime = 0;
+    maxFrameCause = "";
     maxSuccessiveFrames = 0;
     seqMissFrames = 0;
     totalMissed = 0;
@@ -301,14 +303,14 @@ void PerfMonitor::RecordInputEvent(PerfActionType type, PerfSourceType sourceTyp
     }
 }
 
-void PerfMonitor::SetFrameTime(int64_t vsyncTime, int64_t duration, double jank)
+void PerfMonitor::SetFrameTime(int64_t vsyncTime, int64_t duration, double jank, const std::string& jankCause)
 {
     std::lock_guard<std::mutex> Lock(mMutex);
     mVsyncTime = vsyncTime;
     int32_t skippedFrames = static_cast<int32_t> (jank);
     for (auto it = mRecords.begin(); it != mRecords.end();) {
         if (it->second != nullptr) {
-            (it->second)->RecordFrame(vsyncTime, duration, skippedFrames);
+            (it->second)->RecordFrame(vsyncTime, duration, skippedFrames, jankCause);
             if ((it->second)->IsTimeOut(vsyncTime + duration)) {
                 delete it->second;
                 mRecords.erase(it++);
@@ -322,11 +324,12 @@ void PerfMonitor::SetFrameTime(int64_t vsyncTime, int64_t duration, double jank)
     }
 }
 
-void PerfMonitor::ReportJankFrameApp(double jank)
+void PerfMonitor::ReportJankFrameApp(double jank, const std::string& jankCause)
 {
     if (jank >= static_cast<double>(JANK_SKIPPED_THRESHOLD)) {
         JankInfo jankInfo;
         jankInfo.skippedFrameTime = static_cast<int64_t>(jank * SINGLE_FRAME_TIME);
+        jankInfo.jankCause = jankCause;
         RecordBaseInfo(nullptr);
         jankInfo.baseInfo = baseInfo;
         EventReport::ReportJankFrameApp(jankInfo);
@@ -435,6 +438,7 @@ void PerfMonitor::FlushDataBase(SceneRecord* record, DataBase& data)
         data.endVsyncTime = data.beginVsyncTime;
     }
     data.maxFrameTime = record->maxFrameTime;
+    data.maxFrameCause = record->maxFrameCause;
     data.maxSuccessiveFrames = record->maxSuccessiveFrames;
     data.totalMissed = record->totalMissed;
     data.totalFrames = record->totalFrames;
@@ -70,6 +70,8 @@ struct DataBase {
     int64_t beginVsyncTime {0};
     int64_t endVsyncTime {0};
     int64_t maxFrameTime {0};
+    // see JankFrameCause::ToString, of the longest frame.
+    std::string maxFrameCause {""};
     bool isDisplayAnimator {false};
     PerfSourceType sourceType {UNKNOWN_SOURCE};
     PerfActionType actionType {UNKNOWN_ACTION};
@@ -79,6 +81,7 @@ struct DataBase {
 
 struct JankInfo {
     int64_t skippedFrameTime {0};
+    std::string jankCause {""};
     BaseInfo baseInfo;
 };
 
@@ -89,7 +92,7 @@ class SceneRecord {
 public:
     void InitRecord(const std::string& sId, PerfActionType aType, PerfSourceType sType, const std::string& nt,
         int64_t time);
-    void RecordFrame(int64_t vsyncTime, int64_t duration, int32_t skippedFrames);
+    void RecordFrame(int64_t vsyncTime, int64_t duration, int32_t skippedFrames, const std::string& jankCause);
     void Report(const std::string& sceneId, int64_t vsyncTime, bool isRsRender);
     bool IsTimeOut(int64_t nowTime);
     bool IsFirstFrame();
@@ -99,6 +102,7 @@ public:
     int64_t beginVsyncTime {0};
     int64_t endVsyncTime {0};
     int64_t  maxFrameTime {0};
+    std::string maxFrameCause {""};
     int32_t maxSuccessiveFrames {0};
     int32_t totalMissed {0};
     int32_t totalFrames {0};
@@ -118,8 +122,9 @@ public:
     void End(const std::string& sceneId, bool isRsRender);
     void RecordInputEvent(PerfActionType type, PerfSourceType sourceType, int64_t time);
     int64_t GetInputTime(const std::string& sceneId, PerfActionType type, const std::string& note);
-    void SetFrameTime(int64_t vsyncTime, int64_t duration, double jank);
-    void ReportJankFrameApp(double jank);
+    // |jankCause| tells where the time of a janky frame went, empty for other frames.
+    void SetFrameTime(int64_t vsyncTime, int64_t duration, double jank, const std::string& jankCause);
+    void ReportJankFrameApp(double jank, const std::string& jankCause);
     void SetPageUrl(const std::string& pageUrl);
     std::string GetPageUrl();
     static PerfMonitor* GetPerfMonitor();
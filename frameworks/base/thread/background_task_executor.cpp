@@ -16,6 +16,7 @@
 #include "base/thread/background_task_executor.h"
 
 #include <pthread.h>
+#include <algorithm>
 #include <string>
 #include <functional>
 
@@ -29,6 +30,9 @@ namespace {
 constexpr size_t MAX_BACKGROUND_THREADS = 8;
 constexpr uint32_t PURGE_FLAG_MASK = (1 << MAX_BACKGROUND_THREADS) - 1;
 
+// number of the background thread running on, 0 on other threads.
+thread_local uint32_t currentThreadNo = 0;
+
 void SetThreadName(uint32_t threadNo)
 {
     std::string name("ace.bg.");
@@ -48,7 +52,7 @@ BackgroundTaskExecutor& BackgroundTaskExecutor::GetInstance()
     return instance;
 }
 
-BackgroundTaskExecutor::BackgroundTaskExecutor() : maxThreadNum_(MAX_BACKGROUND_THREADS)
+BackgroundTaskExecutor::BackgroundTaskExecutor() : maxThreadNum_(std::min(MAX_BACKGROUND_THREADS, MAX_THREAD_NUM))
 {
     FrameTraceAdapter* ft = FrameTraceAdapter::GetInstance();
     if (ft != nullptr && ft->IsEnabled()) {
@@ -83,69 +87,51 @@ BackgroundTaskExecutor::~BackgroundTaskExecutor()
 
 bool BackgroundTaskExecutor::PostTask(Task&& task, BgTaskPriority priority)
 {
-    if (!task) {
-        return false;
-    }
-
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!running_) {
-        return false;
-    }
-    FrameTraceAdapter* ft = FrameTraceAdapter::GetInstance();
-    if (ft != nullptr && ft->IsEnabled()) {
-        switch (priority) {
-            case BgTaskPriority::LOW:
-                ft->SlowExecute(std::move(task));
-                break;
-            default:
-                ft->QuickExecute(std::move(task));
-                break;
-        }
-        return true;
-    }
-    switch (priority) {
-        case BgTaskPriority::LOW:
-            lowPriorityTasks_.emplace_back(std::move(task));
-            break;
-        default:
-            tasks_.emplace_back(std::move(task));
-            break;
-    }
-    condition_.notify_one();
-    return true;
+    return PostTask(std::move(task), priority, nullptr);
 }
 
 bool BackgroundTaskExecutor::PostTask(const Task& task, BgTaskPriority priority)
 {
-    if (!task) {
-        return false;
-    }
+    Task variableTask = task;
+    return PostTask(std::move(variableTask), priority, nullptr);
+}
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!running_) {
+bool BackgroundTaskExecutor::PostTask(Task&& task, BgTaskPriority priority, const RefPtr<BgTaskGroup>& group)
+{
+    if (!task || !running_ || (group && group->IsCanceled())) {
         return false;
     }
+    auto index = std::min(static_cast<size_t>(priority), BgTaskMetrics::PRIORITY_COUNT - 1);
+
     FrameTraceAdapter* ft = FrameTraceAdapter::GetInstance();
     if (ft != nullptr && ft->IsEnabled()) {
-        Task variableTask = task;
-        switch (priority) {
-            case BgTaskPriority::LOW:
-                ft->SlowExecute(std::move(variableTask));
-                break;
-            default:
-                ft->QuickExecute(std::move(variableTask));
+        if (group) {
+            task = [task = std::move(task), group]() {
+                if (!group->IsCanceled()) {
+                    task();
+                }
+            };
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (index == static_cast<size_t>(BgTaskPriority::USER_VISIBLE)) {
+            ft->QuickExecute(std::move(task));
+        } else {
+            ft->SlowExecute(std::move(task));
         }
         return true;
     }
-    switch (priority) {
-        case BgTaskPriority::LOW:
-            lowPriorityTasks_.emplace_back(task);
-            break;
-        default:
-            tasks_.emplace_back(task);
-            break;
+
+    // counted before queuing, so that a thread going to sleep either sees the task or is woken up below.
+    ++pendingCount_[index];
+    auto& worker = workers_[currentThreadNo > 0 ? currentThreadNo - 1 : nextWorker_++ % maxThreadNum_];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.queues[index].push_back({ std::move(task), group, std::chrono::steady_clock::now() });
+    }
+    if (idleThreadNum_ > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        condition_.notify_one();
     }
-    condition_.notify_one();
     return true;
 }
 
@@ -191,41 +177,83 @@ void BackgroundTaskExecutor::ThreadLoop(uint32_t threadNo)
     LOGD("Background thread is started");
 
     SetThreadName(threadNo);
+    currentThreadNo = threadNo;
 
-    Task task;
+    QueuedTask task;
+    size_t priority = 0;
     const uint32_t purgeFlag = (1 << (threadNo - 1));
-    std::unique_lock<std::mutex> lock(mutex_);
     while (running_) {
-        if (tasks_.empty() && lowPriorityTasks_.empty()) {
-            if ((purgeFlags_ & purgeFlag) != purgeFlag) {
-                condition_.wait(lock);
-                continue;
-            }
-
-            lock.unlock();
+        if (TakeTask(threadNo, task, priority)) {
+            RunTask(task, priority);
+            continue;
+        }
+        if ((purgeFlags_ & purgeFlag) == purgeFlag) {
             LOGD("Purge malloc cache for background thread %{public}u", threadNo);
             PurgeMallocCache();
-            lock.lock();
             purgeFlags_ &= ~purgeFlag;
             continue;
         }
-        // deal with tasks_ first. do lowPriorityTasks_ only when all tasks_ done.
-        if (!tasks_.empty()) {
-            task = std::move(tasks_.front());
-            tasks_.pop_front();
-        } else {
-            task = std::move(lowPriorityTasks_.front());
-            lowPriorityTasks_.pop_front();
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++idleThreadNum_;
+        condition_.wait(lock, [this, purgeFlag]() {
+            return !running_ || HasPendingTask() || (purgeFlags_ & purgeFlag) == purgeFlag;
+        });
+        --idleThreadNum_;
+    }
+
+    LOGD("Background thread is stopped");
+}
+
+bool BackgroundTaskExecutor::TakeTask(uint32_t threadNo, QueuedTask& task, size_t& priority)
+{
+    for (priority = 0; priority < BgTaskMetrics::PRIORITY_COUNT; ++priority) {
+        if (pendingCount_[priority] == 0) {
+            continue;
+        }
+        // own queue first, then steal from the others. The oldest task of a queue is taken first, tasks of one
+        // priority queued on different threads may run in another order than they were posted.
+        for (size_t offset = 0; offset < maxThreadNum_; ++offset) {
+            auto& worker = workers_[(threadNo - 1 + offset) % maxThreadNum_];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            auto& queue = worker.queues[priority];
+            if (queue.empty()) {
+                continue;
+            }
+            task = std::move(queue.front());
+            queue.pop_front();
+            --pendingCount_[priority];
+            if (offset > 0) {
+                ++stolenCount_;
+            }
+            return true;
         }
+    }
+    return false;
+}
 
-        lock.unlock();
-        // Execute the task and clear after execution.
-        task();
-        task = nullptr;
-        lock.lock();
+void BackgroundTaskExecutor::RunTask(QueuedTask& task, size_t priority)
+{
+    if (task.group && task.group->IsCanceled()) {
+        ++canceledCount_[priority];
+    } else {
+        auto waitTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - task.postTime).count();
+        size_t bucket = 0;
+        while (bucket + 1 < BgTaskMetrics::LATENCY_BUCKET_COUNT && waitTime >= (1LL << bucket)) {
+            ++bucket;
+        }
+        ++latencyHistogram_[priority][bucket];
+        ++executedCount_[priority];
+        task.task();
     }
+    // Clear after execution, captures may hold large objects.
+    task = QueuedTask();
+}
 
-    LOGD("Background thread is stopped");
+bool BackgroundTaskExecutor::HasPendingTask() const
+{
+    return std::any_of(
+        pendingCount_.begin(), pendingCount_.end(), [](const std::atomic<size_t>& count) { return count > 0; });
 }
 
 void BackgroundTaskExecutor::TriggerGarbageCollection()
@@ -235,4 +263,40 @@ void BackgroundTaskExecutor::TriggerGarbageCollection()
     condition_.notify_all();
 }
 
+BgTaskMetrics BackgroundTaskExecutor::GetMetrics() const
+{
+    BgTaskMetrics metrics;
+    for (size_t priority = 0; priority < BgTaskMetrics::PRIORITY_COUNT; ++priority) {
+        for (size_t bucket = 0; bucket < BgTaskMetrics::LATENCY_BUCKET_COUNT; ++bucket) {
+            metrics.latencyHistogram[priority][bucket] = latencyHistogram_[priority][bucket];
+        }
+        metrics.executedCount[priority] = executedCount_[priority];
+        metrics.canceledCount[priority] = canceledCount_[priority];
+    }
+    metrics.stolenCount = stolenCount_;
+    return metrics;
+}
+
+std::string BgTaskMetrics::ToString() const
+{
+    static const char* priorityNames[] = { "userVisible", "prefetch", "maintenance" };
+    std::string result;
+    for (size_t priority = 0; priority < PRIORITY_COUNT; ++priority) {
+        result.append(priorityNames[priority])
+            .append(": executed ")
+            .append(std::to_string(executedCount[priority]))
+            .append(", canceled ")
+            .append(std::to_string(canceledCount[priority]))
+            .append(", wait(ms)");
+        for (size_t bucket = 0; bucket < LATENCY_BUCKET_COUNT; ++bucket) {
+            result.append(bucket + 1 < LATENCY_BUCKET_COUNT ? " <" : " >=")
+                .append(std::to_string(1 << (bucket + 1 < LATENCY_BUCKET_COUNT ? bucket : bucket - 1)))
+                .append(":")
+                .append(std::to_string(latencyHistogram[priority][bucket]));
+        }
+        result.append("; ");
+    }
+    return result.append("stolen: ").append(std::to_string(stolenCount));
+}
+
 } // namespace OHOS::Ace
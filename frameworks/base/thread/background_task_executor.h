@@ -16,23 +16,71 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_BACKGROUND_TASK_EXECUTOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_BACKGROUND_TASK_EXECUTOR_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <list>
-#include <thread>
-#ifdef LINUX_PLATFORM
 #include <mutex>
-#include <functional>
-#include <condition_variable>
-#endif
+#include <string>
+#include <thread>
 
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
 #include "base/utils/noncopyable.h"
 
 namespace OHOS::Ace {
 
-enum class BgTaskPriority {
-    DEFAULT,
-    LOW,
+enum class BgTaskPriority : uint32_t {
+    // someone is waiting for the result, e.g. an image on screen
+    USER_VISIBLE = 0,
+    // the result will probably be needed soon, e.g. preloading the next page
+    PREFETCH,
+    // nobody waits for the result, e.g. writing cache files
+    MAINTENANCE,
+    COUNT,
+
+    DEFAULT = USER_VISIBLE,
+    LOW = MAINTENANCE,
+};
+
+// Tasks posted with the same group can be canceled together, e.g. the work of a page being destroyed.
+// Canceled tasks that have not started yet are dropped, running ones are not interrupted.
+class BgTaskGroup final : public Referenced {
+public:
+    void Cancel()
+    {
+        canceled_ = true;
+    }
+
+    bool IsCanceled() const
+    {
+        return canceled_;
+    }
+
+private:
+    std::atomic<bool> canceled_ { false };
+};
+
+struct BgTaskMetrics {
+    // bucket i counts tasks which waited less than (1 << i) ms in the queue, the last one counts the rest.
+    static constexpr size_t LATENCY_BUCKET_COUNT = 10;
+    static constexpr size_t PRIORITY_COUNT = static_cast<size_t>(BgTaskPriority::COUNT);
+
+    std::array<std::array<uint64_t, LATENCY_BUCKET_COUNT>, PRIORITY_COUNT> latencyHistogram {};
+    std::array<uint64_t, PRIORITY_COUNT> executedCount {};
+    std::array<uint64_t, PRIORITY_COUNT> canceledCount {};
+    // tasks run by another thread than the one they were queued on
+    uint64_t stolenCount = 0;
+
+    std::string ToString() const;
 };
 
+// Each thread owns a deque per priority. Tasks posted from a background thread stay on its deques and run on it
+// unless another thread is idle, others are spread over the threads. An idle thread steals from the others, taking
+// higher priorities first, so a long task does not hold up the tasks queued behind it.
 class BackgroundTaskExecutor {
     ACE_DISALLOW_COPY_AND_MOVE(BackgroundTaskExecutor);
 
@@ -43,25 +91,53 @@ public:
 
     bool PostTask(Task&& task, BgTaskPriority priority = BgTaskPriority::DEFAULT);
     bool PostTask(const Task& task, BgTaskPriority priority = BgTaskPriority::DEFAULT);
+    bool PostTask(Task&& task, BgTaskPriority priority, const RefPtr<BgTaskGroup>& group);
 
     void TriggerGarbageCollection();
 
+    BgTaskMetrics GetMetrics() const;
+
 private:
+    static constexpr size_t MAX_THREAD_NUM = 8;
+
+    struct QueuedTask {
+        Task task;
+        RefPtr<BgTaskGroup> group;
+        std::chrono::steady_clock::time_point postTime;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::array<std::deque<QueuedTask>, BgTaskMetrics::PRIORITY_COUNT> queues;
+    };
+
     BackgroundTaskExecutor();
     ~BackgroundTaskExecutor();
 
     void StartNewThreads(size_t num = 1);
     void ThreadLoop(uint32_t threadNo);
+    // Takes the first task of the highest priority, from the worker |threadNo| first and then from the others.
+    bool TakeTask(uint32_t threadNo, QueuedTask& task, size_t& priority);
+    void RunTask(QueuedTask& task, size_t priority);
+    bool HasPendingTask() const;
 
     std::mutex mutex_;
     std::condition_variable condition_;
-    std::list<Task> tasks_;
-    std::list<Task> lowPriorityTasks_;
     std::list<std::thread> threads_;
-    size_t currentThreadNum_ { 0 };
+    std::array<Worker, MAX_THREAD_NUM> workers_;
+    std::array<std::atomic<size_t>, BgTaskMetrics::PRIORITY_COUNT> pendingCount_ {};
+    std::atomic<size_t> idleThreadNum_ { 0 };
+    std::atomic<size_t> nextWorker_ { 0 };
+    std::atomic<size_t> currentThreadNum_ { 0 };
     size_t maxThreadNum_ { 0 };
-    bool running_ { true };
-    uint32_t purgeFlags_ { 0 };
+    std::atomic<bool> running_ { true };
+    std::atomic<uint32_t> purgeFlags_ { 0 };
+
+    std::array<std::array<std::atomic<uint64_t>, BgTaskMetrics::LATENCY_BUCKET_COUNT>, BgTaskMetrics::PRIORITY_COUNT>
+        latencyHistogram_ {};
+    std::array<std::atomic<uint64_t>, BgTaskMetrics::PRIORITY_COUNT> executedCount_ {};
+    std::array<std::atomic<uint64_t>, BgTaskMetrics::PRIORITY_COUNT> canceledCount_ {};
+    std::atomic<uint64_t> stolenCount_ { 0 };
 };
 
 } // namespace OHOS::Ace
@@ -15,12 +15,73 @@
 
 #include "base/utils/string_expression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <regex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "base/log/log.h"
 #include "base/utils/string_utils.h"
 
 namespace OHOS::Ace::StringExpression {
+namespace {
+// CompiledExpressionCache shares compiled formulas between threads, the parallel layout threads included. Lookups
+// only take the shared lock of one shard, a full shard drops its least recently used formula.
+class CompiledExpressionCache final {
+public:
+    std::shared_ptr<const CompiledExpression> Get(const std::string& formula)
+    {
+        auto& shard = shards_[std::hash<std::string> {}(formula) % SHARD_COUNT];
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto iter = shard.entries.find(formula);
+            if (iter != shard.entries.end()) {
+                iter->second.lastUse.store(++shard.clock, std::memory_order_relaxed);
+                return iter->second.expression;
+            }
+        }
+        auto compiled = std::make_shared<const CompiledExpression>(formula);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.entries.find(formula);
+        if (iter != shard.entries.end()) {
+            return iter->second.expression;
+        }
+        if (shard.entries.size() >= MAX_SHARD_ENTRY_COUNT) {
+            auto lru = std::min_element(
+                shard.entries.begin(), shard.entries.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.lastUse.load(std::memory_order_relaxed) <
+                           rhs.second.lastUse.load(std::memory_order_relaxed);
+                });
+            shard.entries.erase(lru);
+        }
+        auto& entry = shard.entries[formula];
+        entry.expression = compiled;
+        entry.lastUse.store(++shard.clock, std::memory_order_relaxed);
+        return compiled;
+    }
+
+private:
+    // formulas come from a handful of style definitions, a shard is small enough to scan for the oldest one.
+    static constexpr size_t SHARD_COUNT = 8;
+    static constexpr size_t MAX_SHARD_ENTRY_COUNT = 64;
+
+    struct Entry {
+        std::shared_ptr<const CompiledExpression> expression;
+        std::atomic<uint64_t> lastUse = 0;
+    };
+
+    struct Shard {
+        std::shared_mutex mutex;
+        std::atomic<uint64_t> clock = 0;
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    std::array<Shard, SHARD_COUNT> shards_;
+};
+} // namespace
+
 void InitMapping(std::map<std::string, int>& mapping)
 {
     mapping["+"] = 0;
@@ -223,84 +284,49 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula)
     return result;
 }
 
-bool CalculateFourOperationsExp(const std::string& exp, const Dimension& num1, const Dimension& num2,
-    const std::function<double(const Dimension&)>& calcFunc, double& opRes)
+double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc)
 {
-    if (exp == "+") {
-        if ((num1.Unit() == DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) ||
-            (num1.Unit() != DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE)) {
-            return false;
-        }
-        opRes = calcFunc(num2) + calcFunc(num1);
-    } else if (exp == "-") {
-        if ((num1.Unit() == DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) ||
-            (num1.Unit() != DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE)) {
-            return false;
-        }
-        opRes = calcFunc(num2) - calcFunc(num1);
-    } else if (exp == "*") {
-        if (num1.Unit() != DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) {
-            return false;
-        }
-        opRes = calcFunc(num2) * calcFunc(num1);
-    } else if (exp == "/") {
-        if (NearZero(calcFunc(num1))) {
-            return false;
-        }
-        if ((num1.Unit() != DimensionUnit::NONE)) {
-            return false;
-        }
-        opRes = calcFunc(num2) / calcFunc(num1);
-    }
-    return true;
+    return CompiledExpression::Compile(expression)->Calculate(calcFunc);
 }
 
-bool CalculateExpImpl(const std::vector<std::string>& rpnexp, const std::function<double(const Dimension&)>& calcFunc,
-    std::vector<Dimension>& result, double& opRes)
+std::shared_ptr<const CompiledExpression> CompiledExpression::Compile(const std::string& formula)
 {
-    std::string ops = "+-*/()";
-    for (auto& i : rpnexp) {
-        if (ops.find(i) == ops.npos) {
-            std::string value = i;
-            Dimension dim = StringUtils::StringToDimensionWithUnit(value, DimensionUnit::PX, 0.0f, true);
-            if (dim.Unit() == DimensionUnit::INVALID) {
-                return false;
+    static CompiledExpressionCache cache;
+    return cache.Get(formula);
+}
+
+CompiledExpression::CompiledExpression(const std::string& formula)
+{
+    static const std::map<std::string, ExpressionOp> opMapping = {
+        { "+", ExpressionOp::ADD },
+        { "-", ExpressionOp::SUB },
+        { "*", ExpressionOp::MUL },
+        { "/", ExpressionOp::DIV },
+        { "(", ExpressionOp::BRACKET },
+        { ")", ExpressionOp::BRACKET },
+    };
+    auto rpnexp = ConvertDal2Rpn(formula);
+    tokens_.reserve(rpnexp.size());
+    size_t depth = 0;
+    for (auto& item : rpnexp) {
+        ExpressionToken token;
+        auto iter = opMapping.find(item);
+        if (iter == opMapping.end()) {
+            token.operand = StringUtils::StringToDimensionWithUnit(item, DimensionUnit::PX, 0.0f, true);
+            if (token.operand.Unit() == DimensionUnit::INVALID) {
+                return;
             }
-            result.emplace_back(dim);
+            maxDepth_ = std::max(maxDepth_, ++depth);
         } else {
-            if (result.size() <= 1) {
-                return false;
-            }
-            Dimension num1 = result.back();
-            result.pop_back();
-            Dimension num2 = result.back();
-            result.pop_back();
-            auto ret = CalculateFourOperationsExp(i, num1, num2, calcFunc, opRes);
-            if (!ret) {
-                return ret;
+            // every operation takes two operands.
+            if (depth <= 1) {
+                return;
             }
-            if (num1.Unit() == DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE) {
-                result.emplace_back(Dimension(opRes, DimensionUnit::NONE));
-                continue;
-            }
-            result.emplace_back(Dimension(opRes, DimensionUnit::PX));
+            token.op = iter->second;
+            --depth;
         }
+        tokens_.emplace_back(token);
     }
-    return true;
-}
-
-double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc)
-{
-    std::vector<std::string> rpnexp = ConvertDal2Rpn(expression);
-    std::vector<Dimension> result;
-    double opRes = 0.0;
-    auto ret = CalculateExpImpl(rpnexp, calcFunc, result, opRes);
-    if (!ret) {
-        return 0.0;
-    }
-    if (result.size() == 1 && result.back().Unit() != DimensionUnit::NONE) {
-        return calcFunc(result.back());
-    }
-    return 0.0;
+    valid_ = !tokens_.empty();
 }
 } // namespace OHOS::Ace::StringExpression
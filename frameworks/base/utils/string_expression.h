@@ -16,12 +16,17 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "base/geometry/dimension.h"
+#include "base/utils/macros.h"
+#include "base/utils/utils.h"
 
 namespace OHOS::Ace::StringExpression {
 
@@ -35,6 +40,111 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula);
 
 double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc);
 
+enum class ExpressionOp : uint8_t {
+    OPERAND,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    // unbalanced bracket left in the RPN, yields the result of the last operation.
+    BRACKET,
+};
+
+struct ExpressionToken {
+    ExpressionOp op = ExpressionOp::OPERAND;
+    Dimension operand;
+};
+
+// CompiledExpression is a calc() formula converted to RPN once, with every operand already parsed.
+// Calculate does not allocate unless the formula nests deeper than MAX_STACK_DEPTH operands.
+class ACE_EXPORT CompiledExpression final {
+public:
+    static constexpr size_t MAX_STACK_DEPTH = 16;
+
+    // Returns the compiled form of |formula|, shared by every caller of the same formula.
+    static std::shared_ptr<const CompiledExpression> Compile(const std::string& formula);
+
+    explicit CompiledExpression(const std::string& formula);
+    ~CompiledExpression() = default;
+
+    bool IsValid() const
+    {
+        return valid_;
+    }
+
+    // Same result as CalculateExp: 0.0 for an invalid formula or a result without unit.
+    template<typename CalcFunc>
+    double Calculate(const CalcFunc& calcFunc) const
+    {
+        if (!valid_) {
+            return 0.0;
+        }
+        if (maxDepth_ <= MAX_STACK_DEPTH) {
+            std::array<Dimension, MAX_STACK_DEPTH> stack;
+            return CalculateImpl(calcFunc, stack.data());
+        }
+        std::vector<Dimension> stack(maxDepth_);
+        return CalculateImpl(calcFunc, stack.data());
+    }
+
+private:
+    template<typename CalcFunc>
+    double CalculateImpl(const CalcFunc& calcFunc, Dimension* stack) const
+    {
+        size_t depth = 0;
+        double opRes = 0.0;
+        for (const auto& token : tokens_) {
+            if (token.op == ExpressionOp::OPERAND) {
+                stack[depth++] = token.operand;
+                continue;
+            }
+            const auto& num1 = stack[depth - 1];
+            const auto& num2 = stack[depth - 2];
+            bool num1HasUnit = num1.Unit() != DimensionUnit::NONE;
+            bool num2HasUnit = num2.Unit() != DimensionUnit::NONE;
+            switch (token.op) {
+                case ExpressionOp::ADD:
+                case ExpressionOp::SUB: {
+                    if (num1HasUnit != num2HasUnit) {
+                        return 0.0;
+                    }
+                    opRes = token.op == ExpressionOp::ADD ? calcFunc(num2) + calcFunc(num1)
+                                                          : calcFunc(num2) - calcFunc(num1);
+                    break;
+                }
+                case ExpressionOp::MUL: {
+                    if (num1HasUnit && num2HasUnit) {
+                        return 0.0;
+                    }
+                    opRes = calcFunc(num2) * calcFunc(num1);
+                    break;
+                }
+                case ExpressionOp::DIV: {
+                    auto divisor = calcFunc(num1);
+                    if (NearZero(divisor) || num1HasUnit) {
+                        return 0.0;
+                    }
+                    opRes = calcFunc(num2) / divisor;
+                    break;
+                }
+                default:
+                    break;
+            }
+            --depth;
+            stack[depth - 1] =
+                Dimension(opRes, (num1HasUnit || num2HasUnit) ? DimensionUnit::PX : DimensionUnit::NONE);
+        }
+        if (depth == 1 && stack[0].Unit() != DimensionUnit::NONE) {
+            return calcFunc(stack[0]);
+        }
+        return 0.0;
+    }
+
+    std::vector<ExpressionToken> tokens_;
+    size_t maxDepth_ = 0;
+    bool valid_ = false;
+};
+
 } // namespace OHOS::Ace::StringExpression
 
 #endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
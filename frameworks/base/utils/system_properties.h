@@ -400,6 +400,18 @@ public:
         return flutterDecouplingEnabled_;
     }
 
+    static bool GetParallelLayoutEnabled()
+    {
+        return parallelLayoutEnabled_;
+    }
+
+    // 0 interpolates the touch points one refresh period back, 1 predicts them with least squares and 2 with a
+    // kalman filter, see TouchPredictor.
+    static int32_t GetTouchPredictor()
+    {
+        return touchPredictor_;
+    }
+
 private:
     static bool traceEnabled_;
     static bool svgTraceEnable_;
@@ -441,6 +453,8 @@ private:
     static bool resourceDecoupling_;
     static bool changeTitleStyleEnabled_;
     static bool flutterDecouplingEnabled_;
+    static bool parallelLayoutEnabled_;
+    static int32_t touchPredictor_;
 };
 
 } // namespace OHOS::Ace
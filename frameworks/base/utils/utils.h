@@ -19,6 +19,7 @@
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 
 #include "base/log/log.h"
 
@@ -233,6 +234,16 @@ inline float CalculateFriction(float gamma)
     return SCROLL_RATIO * static_cast<float>(std::pow(1.0 - gamma, 2));
 }
 
+// Mixes the hash of |value| into |seed|, for hashing keys made of several fields.
+template<typename T>
+inline void HashCombine(size_t& seed, const T& value)
+{
+    constexpr size_t golden = 0x9e3779b9;
+    constexpr size_t leftShift = 6;
+    constexpr size_t rightShift = 2;
+    seed ^= std::hash<T> {}(value) + golden + (seed << leftShift) + (seed >> rightShift);
+}
+
 bool RealPath(const std::string fileName, char* realPath);
 
 } // namespace OHOS::Ace
@@ -75,6 +75,7 @@ public:
             cachedItems.erase(cachedIter);
             return info;
         }
+        RecycleExpiredItems();
 
         NG::ScopedViewStackProcessor scopedViewStackProcessor;
         auto* viewStack = NG::ViewStackProcessor::GetInstance();
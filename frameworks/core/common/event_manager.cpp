@@ -51,7 +51,7 @@ void EventManager::TouchTest(const TouchEvent& touchPoint, const RefPtr<RenderNo
 {
     ContainerScope scope(instanceId_);
 
-    ACE_FUNCTION_TRACE();
+    ACE_GESTURE_SCOPED_TRACE(__func__);
     CHECK_NULL_VOID(renderNode);
     // first clean.
     referee_->CleanGestureScope(touchPoint.id);
@@ -84,7 +84,7 @@ void EventManager::TouchTest(const TouchEvent& touchPoint, const RefPtr<NG::Fram
         (int)needAppend);
     ContainerScope scope(instanceId_);
 
-    ACE_FUNCTION_TRACE();
+    ACE_GESTURE_SCOPED_TRACE(__func__);
     CHECK_NULL_VOID(frameNode);
     // collect
     TouchTestResult hitTestResult;
@@ -127,7 +127,7 @@ void EventManager::TouchTest(
     if (refereeNG_->CheckSourceTypeChange(event.sourceType, true)) {
         refereeNG_->CleanAll(true);
     }
-    ACE_FUNCTION_TRACE();
+    ACE_GESTURE_SCOPED_TRACE(__func__);
     CHECK_NULL_VOID(frameNode);
     if (axisTouchTestResults_.empty() && refereeNG_->QueryAllDone()) {
         responseCtrl_->Reset();
@@ -264,7 +264,7 @@ void EventManager::TouchTest(
 {
     ContainerScope scope(instanceId_);
 
-    ACE_FUNCTION_TRACE();
+    ACE_GESTURE_SCOPED_TRACE(__func__);
     CHECK_NULL_VOID(renderNode);
     // collect
     const Point point { event.x, event.y, event.sourceType };
@@ -317,7 +317,7 @@ bool EventManager::DispatchTouchEvent(const TouchEvent& event)
         point.type = TouchType::UP;
     }
 #endif // ENABLE_DRAG_FRAMEWORK
-    ACE_SCOPED_TRACE("DispatchTouchEvent id:%d, pointX=%f pointY=%f type=%d",
+    ACE_GESTURE_SCOPED_TRACE("DispatchTouchEvent id:%d, pointX=%f pointY=%f type=%d",
         point.id, point.x, point.y, (int)point.type);
     const auto iter = touchTestResults_.find(point.id);
     if (iter == touchTestResults_.end()) {
@@ -406,7 +406,7 @@ bool EventManager::DispatchTouchEvent(const AxisEvent& event)
         }
     }
 
-    ACE_FUNCTION_TRACE();
+    ACE_GESTURE_SCOPED_TRACE(__func__);
     for (const auto& entry : curResultIter->second) {
         if (!entry->HandleEvent(event)) {
             break;
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_LRU_GDSF_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_LRU_GDSF_CACHE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+// Counters of a GDSFCache, all sizes in bytes.
+struct CacheMetrics {
+    size_t hitCount = 0;
+    size_t missCount = 0;
+    size_t evictCount = 0;
+    size_t usedBytes = 0;
+    size_t count = 0;
+
+    inline std::string ToString() const;
+};
+
+// GDSFCache keeps objects under both a byte limit and a count limit, evicting by Greedy-Dual-Size-Frequency:
+// an object is worth (frequency * cost / size) plus the worth of the last evicted one, so small, often used and
+// expensive objects stay while large cold ones go first, and old entries age out.
+// Keys are spread over shards with their own lock, so concurrent decode threads rarely wait for each other.
+// The limits hold for the whole cache: usage is counted atomically across shards. Each shard publishes its lowest
+// priority in an atomic, so eviction picks the shard to evict from without locking the others and only locks that
+// one. Concurrent puts may overshoot a limit briefly.
+// Keys are strings by default, any type std::hash supports can be used instead.
+template<typename T, typename Key = std::string>
+class GDSFCache final {
+public:
+    static constexpr size_t MAX_SHARD_COUNT = 8;
+
+    GDSFCache(size_t byteLimit, size_t countLimit, size_t shardCount = MAX_SHARD_COUNT)
+        : shardCount_(std::clamp<size_t>(shardCount, 1, MAX_SHARD_COUNT)), byteLimit_(byteLimit),
+          countLimit_(countLimit)
+    {}
+    ~GDSFCache() = default;
+
+    // |size| is what the object costs in memory, |cost| what it costs to create it again.
+    // Objects bigger than the byte limit are not cached.
+    void Put(const Key& key, const T& obj, size_t size, double cost = 1.0);
+    // Returns a default constructed T on a miss.
+    T Get(const Key& key);
+    void Erase(const Key& key);
+    void Clear();
+    // Evicts until the cache is within |ratio| of its limits, 0 empties the cache.
+    void Trim(double ratio);
+
+    void SetByteLimit(size_t byteLimit);
+    void SetCountLimit(size_t countLimit);
+    size_t GetByteLimit() const
+    {
+        return byteLimit_;
+    }
+    size_t GetCountLimit() const
+    {
+        return countLimit_;
+    }
+
+    size_t GetUsedBytes() const;
+    size_t GetCount() const;
+    CacheMetrics GetMetrics() const;
+
+private:
+    struct Entry {
+        T obj;
+        size_t size = 0;
+        double cost = 1.0;
+        size_t frequency = 0;
+        double priority = 0.0;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, Entry> entries;
+        // entries ordered by priority, the key points into |entries|
+        std::set<std::pair<double, const Key*>> queue;
+        size_t usedBytes = 0;
+        // priority at the front of |queue|, readable without the lock, infinity when the shard is empty
+        std::atomic<double> lowestPriority = std::numeric_limits<double>::infinity();
+    };
+
+    Shard& GetShard(const Key& key)
+    {
+        return shards_[std::hash<Key> {}(key) % shardCount_];
+    }
+
+    void UpdatePriority(Shard& shard, const Key& key, Entry& entry);
+    // Must be called with the lock of |shard| held whenever its queue changes.
+    static void UpdateLowestPriority(Shard& shard);
+    void EraseEntry(Shard& shard, typename std::unordered_map<Key, Entry>::iterator iter);
+    // Evicts entries with the lowest priority until |byteLimit| and |countLimit| hold for the whole cache.
+    void Evict(size_t byteLimit, size_t countLimit);
+    // Evicts the entry with the lowest priority of all shards, locking only its shard, false if the cache is empty.
+    bool EvictOne();
+
+    std::array<Shard, MAX_SHARD_COUNT> shards_;
+    const size_t shardCount_;
+    std::atomic<size_t> byteLimit_;
+    std::atomic<size_t> countLimit_;
+    std::atomic<size_t> usedBytes_ = 0;
+    std::atomic<size_t> count_ = 0;
+    // priority of the last evicted entry, added to new priorities so that old entries age out
+    std::atomic<double> inflation_ = 0.0;
+    std::atomic<size_t> hitCount_ = 0;
+    std::atomic<size_t> missCount_ = 0;
+    std::atomic<size_t> evictCount_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(GDSFCache);
+};
+} // namespace OHOS::Ace
+
+#include "gdsf_cache.inl"
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_LRU_GDSF_CACHE_H
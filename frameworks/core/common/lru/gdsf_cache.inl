@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+
+#include "core/common/lru/gdsf_cache.h"
+
+namespace OHOS::Ace {
+std::string CacheMetrics::ToString() const
+{
+    auto total = hitCount + missCount;
+    auto hitRate = total == 0 ? 0 : hitCount * 100 / total;
+    return std::string("hit: ")
+        .append(std::to_string(hitCount))
+        .append(", miss: ")
+        .append(std::to_string(missCount))
+        .append(", hitRate: ")
+        .append(std::to_string(hitRate))
+        .append("%, evict: ")
+        .append(std::to_string(evictCount))
+        .append(", count: ")
+        .append(std::to_string(count))
+        .append(", bytes: ")
+        .append(std::to_string(usedBytes));
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::Put(const Key& key, const T& obj, size_t size, double cost)
+{
+    Erase(key);
+    size_t byteLimit = byteLimit_;
+    size_t countLimit = countLimit_;
+    if (size > byteLimit || countLimit == 0) {
+        return;
+    }
+    // make room before inserting, so that the new entry is not evicted by itself.
+    Evict(byteLimit - size, countLimit - 1);
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    // another thread may have put the key while the room was made.
+    auto iter = shard.entries.find(key);
+    if (iter != shard.entries.end()) {
+        EraseEntry(shard, iter);
+    }
+    auto result = shard.entries.emplace(key, Entry { obj, size, cost, 0, 0.0 });
+    shard.usedBytes += size;
+    usedBytes_ += size;
+    ++count_;
+    UpdatePriority(shard, result.first->first, result.first->second);
+}
+
+template<typename T, typename Key>
+T GDSFCache<T, Key>::Get(const Key& key)
+{
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.entries.find(key);
+    if (iter == shard.entries.end()) {
+        ++missCount_;
+        return T();
+    }
+    ++hitCount_;
+    shard.queue.erase({ iter->second.priority, &iter->first });
+    UpdatePriority(shard, iter->first, iter->second);
+    return iter->second.obj;
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::Erase(const Key& key)
+{
+    auto& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.entries.find(key);
+    if (iter != shard.entries.end()) {
+        EraseEntry(shard, iter);
+    }
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::Clear()
+{
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        usedBytes_ -= shard.usedBytes;
+        count_ -= shard.entries.size();
+        shard.queue.clear();
+        shard.entries.clear();
+        shard.usedBytes = 0;
+        UpdateLowestPriority(shard);
+    }
+    inflation_ = 0.0;
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::Trim(double ratio)
+{
+    ratio = std::clamp(ratio, 0.0, 1.0);
+    auto byteLimit = static_cast<size_t>(std::floor(byteLimit_ * ratio));
+    auto countLimit = static_cast<size_t>(std::floor(countLimit_ * ratio));
+    Evict(byteLimit, countLimit);
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::SetByteLimit(size_t byteLimit)
+{
+    byteLimit_ = byteLimit;
+    Trim(1.0);
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::SetCountLimit(size_t countLimit)
+{
+    countLimit_ = countLimit;
+    Trim(1.0);
+}
+
+template<typename T, typename Key>
+size_t GDSFCache<T, Key>::GetUsedBytes() const
+{
+    return usedBytes_;
+}
+
+template<typename T, typename Key>
+size_t GDSFCache<T, Key>::GetCount() const
+{
+    return count_;
+}
+
+template<typename T, typename Key>
+CacheMetrics GDSFCache<T, Key>::GetMetrics() const
+{
+    CacheMetrics metrics;
+    metrics.hitCount = hitCount_;
+    metrics.missCount = missCount_;
+    metrics.evictCount = evictCount_;
+    metrics.usedBytes = usedBytes_;
+    metrics.count = count_;
+    return metrics;
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::UpdatePriority(Shard& shard, const Key& key, Entry& entry)
+{
+    ++entry.frequency;
+    entry.priority = inflation_ + entry.frequency * entry.cost / std::max<size_t>(entry.size, 1);
+    shard.queue.emplace(entry.priority, &key);
+    UpdateLowestPriority(shard);
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::UpdateLowestPriority(Shard& shard)
+{
+    shard.lowestPriority.store(
+        shard.queue.empty() ? std::numeric_limits<double>::infinity() : shard.queue.begin()->first,
+        std::memory_order_relaxed);
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::EraseEntry(Shard& shard, typename std::unordered_map<Key, Entry>::iterator iter)
+{
+    shard.queue.erase({ iter->second.priority, &iter->first });
+    shard.usedBytes -= iter->second.size;
+    usedBytes_ -= iter->second.size;
+    --count_;
+    shard.entries.erase(iter);
+    UpdateLowestPriority(shard);
+}
+
+template<typename T, typename Key>
+void GDSFCache<T, Key>::Evict(size_t byteLimit, size_t countLimit)
+{
+    while (usedBytes_ > byteLimit || count_ > countLimit) {
+        if (!EvictOne()) {
+            break;
+        }
+    }
+}
+
+template<typename T, typename Key>
+bool GDSFCache<T, Key>::EvictOne()
+{
+    // pick the shard from the lowest priorities the shards publish, so that only the victim shard is locked. The
+    // victim may have changed before the lock is taken, which only makes the choice approximate.
+    Shard* victimShard = nullptr;
+    double victimPriority = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < shardCount_; ++i) {
+        auto priority = shards_[i].lowestPriority.load(std::memory_order_relaxed);
+        if (priority < victimPriority) {
+            victimShard = &shards_[i];
+            victimPriority = priority;
+        }
+    }
+    if (!victimShard) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(victimShard->mutex);
+    if (victimShard->queue.empty()) {
+        // emptied by another thread meanwhile, let the caller check the limits again.
+        return true;
+    }
+    auto victim = victimShard->queue.begin();
+    inflation_ = victim->first;
+    auto iter = victimShard->entries.find(*victim->second);
+    if (iter == victimShard->entries.end()) {
+        victimShard->queue.erase(victim);
+        UpdateLowestPriority(*victimShard);
+        return true;
+    }
+    EraseEntry(*victimShard, iter);
+    ++evictCount_;
+    return true;
+}
+} // namespace OHOS::Ace
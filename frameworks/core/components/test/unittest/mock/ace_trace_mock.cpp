@@ -26,6 +26,15 @@ AceScopedTrace::~AceScopedTrace()
 {
 }
 
+AceScopedTraceFlag::AceScopedTraceFlag(bool flag, const char* format, ...)
+{
+    flagTraceEnabled_ = false;
+}
+
+AceScopedTraceFlag::~AceScopedTraceFlag()
+{
+}
+
 AceAsyncScopedTrace::AceAsyncScopedTrace(const char* format, ...)
 {
     asyncTraceEnabled_ = false;
@@ -36,6 +45,14 @@ AceAsyncScopedTrace::~AceAsyncScopedTrace()
 {
 }
 
+uint32_t GetAceTraceCategoryMask()
+{
+    return ACE_TRACE_CATEGORY_ALL;
+}
+
+void SetAceTraceCategoryMask(uint32_t mask)
+{}
+
 bool AceTraceEnabled()
 {
     return false;
@@ -19,6 +19,7 @@
 #include "base/geometry/ng/point_t.h"
 #include "base/log/ace_trace.h"
 #include "base/log/dump_log.h"
+#include "base/log/frame_profiler.h"
 #include "base/log/log_wrapper.h"
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
@@ -300,6 +301,8 @@ private:
     bool needResetChild_ = false;
 }; // namespace OHOS::Ace::NG
 
+std::atomic<uint64_t> FrameNode::geometryChangeCount_ { 0 };
+
 FrameNode::FrameNode(const std::string& tag, int32_t nodeId, const RefPtr<Pattern>& pattern, bool isRoot)
     : UINode(tag, nodeId, isRoot), LayoutWrapper(WeakClaim(this)), pattern_(pattern),
       frameProxy_(std::make_unique<FramePorxy>(this))
@@ -369,7 +372,7 @@ RefPtr<FrameNode> FrameNode::GetOrCreateFrameNode(
 
 RefPtr<FrameNode> FrameNode::GetFrameNode(const std::string& tag, int32_t nodeId)
 {
-    auto frameNode = ElementRegister::GetInstance()->GetSpecificItemById<FrameNode>(nodeId);
+    auto frameNode = ElementRegister::GetInstance()->GetFrameNodeById(nodeId);
     CHECK_NULL_RETURN(frameNode, nullptr);
     if (frameNode->GetTag() != tag) {
         ElementRegister::GetInstance()->RemoveItemSilently(nodeId);
@@ -421,6 +424,7 @@ void FrameNode::InitializePatternAndContext()
     renderContext_->SetRequestFrame([weak = WeakClaim(this)] {
         auto frameNode = weak.Upgrade();
         CHECK_NULL_VOID(frameNode);
+        frameNode->MarkGeometryChanged();
         if (frameNode->IsOnMainTree()) {
             auto context = frameNode->GetContext();
             CHECK_NULL_VOID(context);
@@ -507,6 +511,9 @@ void FrameNode::DumpCommonInfo()
                             layoutProperty_->GetContentLayoutConstraint().value().ToString() : "NA"));
     }
     DumpOverlayInfo();
+    if (layoutResultCache_) {
+        DumpLog::GetInstance().AddDesc(std::string("LayoutResultCache: ").append(layoutResultCache_->ToString()));
+    }
     if (frameProxy_->Dump().compare("totalCount is 0") != 0) {
         DumpLog::GetInstance().AddDesc(std::string("FrameProxy: ").append(frameProxy_->Dump().c_str()));
     }
@@ -702,6 +709,7 @@ void FrameNode::FromJson(const std::unique_ptr<JsonValue>& json)
 
 void FrameNode::OnAttachToMainTree(bool recursive)
 {
+    MarkGeometryChanged();
     eventHub_->FireOnAppear();
     renderContext_->OnNodeAppear(recursive);
     pattern_->OnAttachToMainTree();
@@ -757,6 +765,7 @@ void FrameNode::OnConfigurationUpdate(const OnConfigurationChange& configuration
 
 void FrameNode::OnVisibleChange(bool isVisible)
 {
+    MarkGeometryChanged();
     pattern_->OnVisibleChange(isVisible);
     UpdateChildrenVisible(isVisible);
     TriggerVisibleAreaChangeCallback(true);
@@ -764,6 +773,7 @@ void FrameNode::OnVisibleChange(bool isVisible)
 
 void FrameNode::OnDetachFromMainTree(bool recursive)
 {
+    MarkGeometryChanged();
     if (auto focusHub = GetFocusHub()) {
         focusHub->RemoveSelf();
     }
@@ -803,6 +813,10 @@ void FrameNode::SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>&
         renderContext_->SyncGeometryProperties(RawPtr(dirty->GetGeometryNode()));
     }
 
+    if (geometryTransition || frameSizeChange || frameOffsetChange || contentSizeChange || contentOffsetChange) {
+        MarkGeometryChanged();
+    }
+
     // clean layout flag.
     layoutProperty_->CleanDirty();
     DirtySwapConfig config { frameSizeChange, frameOffsetChange, contentSizeChange, contentOffsetChange };
@@ -910,9 +924,9 @@ void FrameNode::SetOnAreaChangeCallback(OnAreaChangedFunc&& callback)
     eventHub_->SetOnAreaChanged(std::move(callback));
 }
 
-void FrameNode::TriggerOnAreaChangeCallback()
+void FrameNode::TriggerOnAreaChangeCallback(bool geometryChanged)
 {
-    if (eventHub_->HasOnAreaChanged() && lastFrameRect_ && lastParentOffsetToWindow_) {
+    if (geometryChanged && eventHub_->HasOnAreaChanged() && lastFrameRect_ && lastParentOffsetToWindow_) {
         auto currFrameRect = geometryNode_->GetFrameRect();
         auto currParentOffsetToWindow = GetOffsetRelativeToWindow() - currFrameRect.GetOffset();
         if (currFrameRect != *lastFrameRect_ || currParentOffsetToWindow != *lastParentOffsetToWindow_) {
@@ -925,7 +939,7 @@ void FrameNode::TriggerOnAreaChangeCallback()
     pattern_->OnAreaChangedInner();
 }
 
-void FrameNode::TriggerVisibleAreaChangeCallback(bool forceDisappear)
+void FrameNode::TriggerVisibleAreaChangeCallback(bool forceDisappear, VisibleRectCache* visibleRectCache)
 {
     auto context = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(context);
@@ -965,21 +979,13 @@ void FrameNode::TriggerVisibleAreaChangeCallback(bool forceDisappear)
 
     auto frameRect = GetTransformRectRelativeToWindow();
     auto visibleRect = frameRect;
-    RectF parentRect;
-    auto parentUi = GetParent();
-    if (!parentUi) {
+    if (!GetParent()) {
         visibleRect.SetWidth(0.0f);
         visibleRect.SetHeight(0.0f);
     }
-    while (parentUi) {
-        auto parentFrame = AceType::DynamicCast<FrameNode>(parentUi);
-        if (!parentFrame) {
-            parentUi = parentUi->GetParent();
-            continue;
-        }
-        parentRect = parentFrame->GetTransformRectRelativeToWindow();
-        visibleRect = visibleRect.Constrain(parentRect);
-        parentUi = parentUi->GetParent();
+    auto ancestorsRect = GetAncestorsVisibleRect(visibleRectCache);
+    if (ancestorsRect) {
+        visibleRect = visibleRect.Constrain(*ancestorsRect);
     }
 
     double currentVisibleRatio =
@@ -991,6 +997,60 @@ void FrameNode::TriggerVisibleAreaChangeCallback(bool forceDisappear)
     }
 }
 
+std::optional<RectF> FrameNode::GetAncestorsVisibleRect(VisibleRectCache* visibleRectCache) const
+{
+    // collect the ancestors up to the first one already in the cache, then intersect from the top down.
+    std::vector<RefPtr<FrameNode>> localAncestors;
+    auto& ancestors = visibleRectCache ? visibleRectCache->ancestors : localAncestors;
+    ancestors.clear();
+    std::optional<RectF> visibleRect;
+    auto parent = GetAncestorNodeOfFrame();
+    while (parent) {
+        if (visibleRectCache) {
+            auto iter = visibleRectCache->rects.find(parent->GetId());
+            if (iter != visibleRectCache->rects.end()) {
+                visibleRect = iter->second;
+                break;
+            }
+        }
+        ancestors.emplace_back(parent);
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+    for (auto iter = ancestors.rbegin(); iter != ancestors.rend(); ++iter) {
+        auto rect = (*iter)->GetTransformRectRelativeToWindow();
+        if (visibleRect) {
+            rect = rect.Constrain(*visibleRect);
+        }
+        visibleRect = rect;
+        if (visibleRectCache) {
+            visibleRectCache->rects.emplace((*iter)->GetId(), rect);
+        }
+    }
+    ancestors.clear();
+    return visibleRect;
+}
+
+void FrameNode::MarkGeometryChanged()
+{
+    geometryChangeSeq_ = geometryChangeCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+    MarkHitTestBoundsDirty();
+}
+
+bool FrameNode::IsGeometryChangedSince(uint64_t geometryChangeCount) const
+{
+    if (geometryChangeSeq_ > geometryChangeCount) {
+        return true;
+    }
+    auto parent = GetAncestorNodeOfFrame();
+    while (parent) {
+        if (parent->geometryChangeSeq_ > geometryChangeCount) {
+            return true;
+        }
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+    return false;
+}
+
 double FrameNode::CalculateCurrentVisibleRatio(const RectF& visibleRect, const RectF& renderRect)
 {
     if (!visibleRect.IsValid() || !renderRect.IsValid()) {
@@ -1059,6 +1119,7 @@ void FrameNode::SetActive(bool active)
         activeChanged = true;
     }
     if (activeChanged) {
+        MarkGeometryChanged();
         auto parent = GetAncestorNodeOfFrame();
         if (parent) {
             parent->MarkNeedSyncRenderTree();
@@ -1083,14 +1144,34 @@ void FrameNode::CreateLayoutTask(bool forceUseMainThread)
     UpdateLayoutPropertyFlag();
     SetSkipSyncGeometryNode(false);
     {
-        ACE_SCOPED_TRACE("Layout[%s][self:%d][parent:%d]", GetTag().c_str(), GetId(),
+        ACE_LAYOUT_SCOPED_TRACE("Layout[%s][self:%d][parent:%d]", GetTag().c_str(), GetId(),
             GetParent() ? GetParent()->GetId() : 0);
-        Measure(GetLayoutConstraint());
-        Layout();
+        {
+            FrameProfileScope profileScope(FramePhase::MEASURE, GetId(), GetTag());
+            Measure(GetLayoutConstraint());
+        }
+        {
+            FrameProfileScope profileScope(FramePhase::LAYOUT, GetId(), GetTag());
+            Layout();
+        }
     }
     SetRootMeasureNode(false);
 }
 
+RefPtr<LayoutWrapperNode> FrameNode::CreateParallelLayoutWrapper(LayoutConstraintF& rootConstraint)
+{
+    if (!isLayoutDirtyMarked_) {
+        return nullptr;
+    }
+    UpdateLayoutPropertyFlag();
+    // root constraint depends on pipeline context, so it must be resolved on ui thread.
+    rootConstraint = GetLayoutConstraint();
+    auto layoutWrapper = CreateLayoutWrapper();
+    CHECK_NULL_RETURN(layoutWrapper, nullptr);
+    layoutWrapper->SetRootMeasureNode();
+    return layoutWrapper;
+}
+
 std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
 {
     if (!isRenderDirtyMarked_) {
@@ -1306,6 +1387,7 @@ void FrameNode::RebuildRenderContextTree()
     for (const auto& child : children) {
         frameChildren_.emplace(child);
     }
+    MarkHitTestBoundsDirty();
     renderContext_->RebuildFrame(this, children);
     pattern_->OnRebuildFrame();
     needSyncRenderTree_ = false;
@@ -1568,6 +1650,9 @@ VectorF FrameNode::GetTransformScale() const
 
 bool FrameNode::IsOutOfTouchTestRegion(const PointF& parentRevertPoint, int32_t sourceType)
 {
+    if (IsOutOfHitTestBounds(parentRevertPoint)) {
+        return true;
+    }
     bool isInChildRegion = false;
     auto paintRect = renderContext_->GetPaintRectWithoutTransform();
     auto responseRegionList = GetResponseRegionList(paintRect, sourceType);
@@ -1605,6 +1690,122 @@ bool FrameNode::IsOutOfTouchTestRegion(const PointF& parentRevertPoint, int32_t
     return false;
 }
 
+// The bounds of the ancestors contain the ones of this node, they are dropped up to the first ancestor already
+// dirty: an ancestor is rebuilt together with its children, one left clean above it doesn't depend on this node.
+void FrameNode::MarkHitTestBoundsDirty()
+{
+    if (!isHitTestBoundsValid_) {
+        return;
+    }
+    isHitTestBoundsValid_ = false;
+    auto parent = GetAncestorNodeOfFrame();
+    while (parent && parent->isHitTestBoundsValid_) {
+        parent->isHitTestBoundsValid_ = false;
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+}
+
+bool FrameNode::IsOutOfHitTestBounds(const PointF& parentRevertPoint)
+{
+    UpdateHitTestBounds();
+    if (!isHitTestBounded_) {
+        return false;
+    }
+    auto revertPoint = parentRevertPoint;
+    renderContext_->GetPointWithRevert(revertPoint);
+    return !hitTestBounds_.IsInRegion(revertPoint);
+}
+
+namespace {
+void CombineHitTestBounds(std::optional<RectF>& bounds, const RectF& rect)
+{
+    auto left = std::min(rect.Left(), rect.Right());
+    auto right = std::max(rect.Left(), rect.Right());
+    auto top = std::min(rect.Top(), rect.Bottom());
+    auto bottom = std::max(rect.Top(), rect.Bottom());
+    if (bounds) {
+        left = std::min(left, bounds->Left());
+        right = std::max(right, bounds->Right());
+        top = std::min(top, bounds->Top());
+        bottom = std::max(bottom, bounds->Bottom());
+    }
+    bounds = RectF(left, top, right - left, bottom - top);
+}
+} // namespace
+
+// Bounds are rebuilt lazily after MarkHitTestBoundsDirty, only on the nodes it reached. They follow
+// IsOutOfTouchTestRegion: own response regions of every source type, plus children unless the node clips.
+void FrameNode::UpdateHitTestBounds()
+{
+    if (isHitTestBoundsValid_) {
+        return;
+    }
+    isHitTestBoundsValid_ = true;
+    isHitTestBounded_ = false;
+    if (IsHitTestCustomized()) {
+        return;
+    }
+    std::optional<RectF> bounds;
+    auto paintRect = renderContext_->GetPaintRectWithoutTransform();
+    for (auto sourceType : { SourceType::TOUCH, SourceType::MOUSE }) {
+        for (const auto& rect : GetResponseRegionList(paintRect, static_cast<int32_t>(sourceType))) {
+            CombineHitTestBounds(bounds, rect);
+        }
+    }
+    if (!renderContext_->GetClipEdge().value_or(false)) {
+        for (const auto& weakChild : frameChildren_) {
+            auto child = weakChild.Upgrade();
+            if (!child) {
+                continue;
+            }
+            auto childBounds = child->GetHitTestBoundsInParent();
+            if (!childBounds) {
+                return;
+            }
+            CombineHitTestBounds(bounds, *childBounds + paintRect.GetOffset());
+        }
+    }
+    CHECK_NULL_VOID(bounds);
+    hitTestBounds_ = bounds.value();
+    isHitTestBounded_ = true;
+}
+
+std::optional<RectF> FrameNode::GetHitTestBoundsInParent()
+{
+    UpdateHitTestBounds();
+    if (!isHitTestBounded_) {
+        return std::nullopt;
+    }
+    // GetPointWithRevert only applies translate, rotate and scale, probe it as an affine map and invert that.
+    PointF origin(0.0f, 0.0f);
+    PointF unitX(1.0f, 0.0f);
+    PointF unitY(0.0f, 1.0f);
+    renderContext_->GetPointWithRevert(origin);
+    renderContext_->GetPointWithRevert(unitX);
+    renderContext_->GetPointWithRevert(unitY);
+    auto xx = unitX.GetX() - origin.GetX();
+    auto xy = unitX.GetY() - origin.GetY();
+    auto yx = unitY.GetX() - origin.GetX();
+    auto yy = unitY.GetY() - origin.GetY();
+    if (NearZero(origin.GetX()) && NearZero(origin.GetY()) && NearEqual(xx, 1.0f) && NearZero(xy) &&
+        NearZero(yx) && NearEqual(yy, 1.0f)) {
+        return hitTestBounds_;
+    }
+    auto det = xx * yy - yx * xy;
+    if (NearZero(det)) {
+        return std::nullopt;
+    }
+    std::optional<RectF> bounds;
+    for (auto cornerX : { hitTestBounds_.Left(), hitTestBounds_.Right() }) {
+        for (auto cornerY : { hitTestBounds_.Top(), hitTestBounds_.Bottom() }) {
+            auto dx = cornerX - origin.GetX();
+            auto dy = cornerY - origin.GetY();
+            CombineHitTestBounds(bounds, RectF((dx * yy - dy * yx) / det, (dy * xx - dx * xy) / det, 0.0f, 0.0f));
+        }
+    }
+    return bounds;
+}
+
 HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& parentLocalPoint,
     const PointF& parentRevertPoint, const TouchRestrict& touchRestrict, TouchTestResult& result, int32_t touchId)
 {
@@ -1692,7 +1893,7 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
         }
 
         const auto& child = iter->Upgrade();
-        if (!child) {
+        if (!child || child->IsOutOfHitTestBounds(subRevertPoint)) {
             continue;
         }
         auto childHitResult =
@@ -2327,17 +2528,19 @@ bool FrameNode::RemoveImmediately() const
 std::vector<RefPtr<FrameNode>> FrameNode::GetNodesById(const std::unordered_set<int32_t>& set)
 {
     std::vector<RefPtr<FrameNode>> nodes;
+    GetNodesById(set, nodes);
+    return nodes;
+}
+
+void FrameNode::GetNodesById(const std::unordered_set<int32_t>& set, std::vector<RefPtr<FrameNode>>& nodes)
+{
+    nodes.clear();
     for (auto nodeId : set) {
-        auto uiNode = ElementRegister::GetInstance()->GetUINodeById(nodeId);
-        if (!uiNode) {
-            continue;
-        }
-        auto frameNode = DynamicCast<FrameNode>(uiNode);
+        auto frameNode = ElementRegister::GetInstance()->GetFrameNodeById(nodeId);
         if (frameNode) {
             nodes.emplace_back(frameNode);
         }
     }
-    return nodes;
 }
 
 int32_t FrameNode::GetNodeExpectedRate()
@@ -2486,7 +2689,7 @@ void FrameNode::UpdatePercentSensitive()
 // This will call child and self measure process.
 void FrameNode::Measure(const std::optional<LayoutConstraintF>& parentConstraint)
 {
-    ACE_SCOPED_TRACE("Measure[%s][self:%d][parent:%d]", GetTag().c_str(),
+    ACE_LAYOUT_SCOPED_TRACE("Measure[%s][self:%d][parent:%d]", GetTag().c_str(),
         GetId(), GetParent() ? GetParent()->GetId() : 0);
     isLayoutComplete_ = false;
     if (!oldGeometryNode_) {
@@ -2540,13 +2743,14 @@ void FrameNode::Measure(const std::optional<LayoutConstraintF>& parentConstraint
 
     if (isConstraintNotChanged_) {
         if (!CheckNeedForceMeasureAndLayout()) {
-            ACE_SCOPED_TRACE("SkipMeasure");
+            ACE_LAYOUT_SCOPED_TRACE("SkipMeasure");
             LOGD("%{public}s (depth: %{public}d) skip measure content", GetTag().c_str(), GetDepth());
             layoutAlgorithm_->SetSkipMeasure();
             return;
         }
     }
 
+    ReplayLayoutResult(preConstraint.has_value() && !isConstraintNotChanged_);
     auto size = layoutAlgorithm_->MeasureContent(layoutProperty_->CreateContentConstraint(), this);
     if (size.has_value()) {
         geometryNode_->SetContentSize(size.value());
@@ -2580,7 +2784,7 @@ void FrameNode::Measure(const std::optional<LayoutConstraintF>& parentConstraint
 // Called to perform layout children.
 void FrameNode::Layout()
 {
-    ACE_SCOPED_TRACE("Layout[%s][self:%d][parent:%d]", GetTag().c_str(),
+    ACE_LAYOUT_SCOPED_TRACE("Layout[%s][self:%d][parent:%d]", GetTag().c_str(),
         GetId(), GetParent() ? GetParent()->GetId() : 0);
     int64_t time = GetSysTimestamp();
     OffsetNodeToSafeArea();
@@ -2604,6 +2808,7 @@ void FrameNode::Layout()
             layoutProperty_->UpdateContentConstraint();
         }
         GetLayoutAlgorithm()->Layout(this);
+        RecordLayoutResult();
         if (overlayNode_) {
             LayoutOverlay();
         }
@@ -2674,6 +2879,10 @@ void FrameNode::SyncGeometryNode()
         }
     }
 
+    if (hasTransition || frameSizeChange || frameOffsetChange || contentSizeChange || contentOffsetChange) {
+        MarkGeometryChanged();
+    }
+
     // clean layout flag.
     layoutProperty_->CleanDirty();
 
@@ -2845,6 +3054,82 @@ const RefPtr<LayoutAlgorithmWrapper>& FrameNode::GetLayoutAlgorithm(bool needRes
     return layoutAlgorithm_;
 }
 
+namespace {
+// safe area insets and expansion move the node after its parent placed it, which a replayed offset can't tell.
+bool HasSafeAreaAdjustment(const RefPtr<LayoutProperty>& layoutProperty)
+{
+    return layoutProperty->GetSafeAreaInsets() || layoutProperty->GetSafeAreaExpandOpts();
+}
+} // namespace
+
+bool FrameNode::IsLayoutResultCacheable() const
+{
+    return pattern_ && pattern_->IsLayoutResultCacheable() && !overlayNode_ &&
+           !layoutProperty_->GetGeometryTransition() && !HasSafeAreaAdjustment(layoutProperty_);
+}
+
+void FrameNode::ReplayLayoutResult(bool constraintChanged)
+{
+    auto replay = AceType::DynamicCast<LayoutResultReplayAlgorithm>(layoutAlgorithm_->GetLayoutAlgorithm());
+    if (replay) {
+        layoutAlgorithm_->SetLayoutAlgorithm(replay->GetOriginAlgorithm());
+    }
+    if (!IsLayoutResultCacheable()) {
+        layoutResultCache_.reset();
+        return;
+    }
+    if (!layoutResultCache_) {
+        // most containers are only ever laid out with one constraint, they pay for a cache once it changes.
+        if (!constraintChanged) {
+            return;
+        }
+        layoutResultCache_ = std::make_unique<LayoutResultCache>();
+    }
+    auto flag = layoutProperty_->GetPropertyChangeFlag();
+    if (CheckNeedMeasure(flag) || CheckNeedLayout(flag) || CheckUpdateByChildRequest(flag)) {
+        layoutResultCache_->Invalidate();
+        return;
+    }
+    const auto& layoutConstraint = layoutProperty_->GetLayoutConstraint();
+    CHECK_NULL_VOID(layoutConstraint);
+    const auto* entry = layoutResultCache_->Find(layoutConstraint.value());
+    CHECK_NULL_VOID(entry);
+    layoutAlgorithm_->SetLayoutAlgorithm(
+        MakeRefPtr<LayoutResultReplayAlgorithm>(*entry, layoutAlgorithm_->GetLayoutAlgorithm()));
+}
+
+void FrameNode::RecordLayoutResult()
+{
+    CHECK_NULL_VOID(layoutResultCache_);
+    auto replay = AceType::DynamicCast<LayoutResultReplayAlgorithm>(layoutAlgorithm_->GetLayoutAlgorithm());
+    if (replay) {
+        if (replay->IsReplayed()) {
+            return;
+        }
+        layoutResultCache_->MarkReplayFailed(replay->GetEntry().constraint);
+    }
+    const auto& layoutConstraint = layoutProperty_->GetLayoutConstraint();
+    CHECK_NULL_VOID(layoutConstraint);
+    auto& entry = layoutResultCache_->StartRecord(layoutConstraint.value());
+    entry.frameSize = geometryNode_->GetFrameSize();
+    if (geometryNode_->GetContent()) {
+        entry.contentRect = geometryNode_->GetContentRect();
+    }
+    const auto& children = GetAllChildrenWithBuild(false);
+    entry.children.reserve(children.size());
+    for (const auto& child : children) {
+        const auto& childGeometryNode = child->GetGeometryNode();
+        const auto& childConstraint = childGeometryNode->GetParentLayoutConstraint();
+        // children hidden by the algorithm (e.g. displayPriority) are not replayed.
+        if (!child->IsActive() || !childConstraint || HasSafeAreaAdjustment(child->GetLayoutProperty())) {
+            layoutResultCache_->CancelRecord();
+            return;
+        }
+        entry.children.push_back({ child, childConstraint.value(), childGeometryNode->GetFrameSize(),
+            childGeometryNode->GetFrameOffset() });
+    }
+}
+
 void FrameNode::SetCacheCount(int32_t cacheCount, const std::optional<LayoutConstraintF>& itemConstraint)
 {
     frameProxy_->SetCacheCount(cacheCount, itemConstraint);
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_FRAME_NODE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_FRAME_NODE_H
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <utility>
@@ -40,6 +41,7 @@
 #include "core/components_ng/event/gesture_event_hub.h"
 #include "core/components_ng/event/input_event_hub.h"
 #include "core/components_ng/layout/layout_property.h"
+#include "core/components_ng/layout/layout_result_cache.h"
 #include "core/components_ng/property/accessibility_property.h"
 #include "core/components_ng/property/layout_constraint.h"
 #include "core/components_ng/property/property.h"
@@ -64,6 +66,7 @@ class FramePorxy;
 // FrameNode will display rendering region in the screen.
 class ACE_FORCE_EXPORT FrameNode : public UINode, public LayoutWrapper {
     DECLARE_ACE_TYPE(FrameNode, UINode, LayoutWrapper);
+    ACE_POOLED_ALLOCATION();
 
 public:
     // create a new child element with new element tree.
@@ -147,6 +150,10 @@ public:
 
     void CreateLayoutTask(bool forceUseMainThread = false);
 
+    // Snapshot this dirty root into a layout wrapper tree, which can be measured on background thread when all the
+    // layout algorithms inside allow it. The result is committed by LayoutWrapperNode::MountToHostOnMainThread.
+    RefPtr<LayoutWrapperNode> CreateParallelLayoutWrapper(LayoutConstraintF& rootConstraint);
+
     std::optional<UITask> CreateRenderTask(bool forceUseMainThread = false);
 
     void SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>& dirty);
@@ -156,7 +163,8 @@ public:
 
     void SetOnAreaChangeCallback(OnAreaChangedFunc&& callback);
 
-    void TriggerOnAreaChangeCallback();
+    // Fires the user onAreaChange callback only when |geometryChanged|, the pattern is always notified.
+    void TriggerOnAreaChangeCallback(bool geometryChanged = true);
 
     void OnConfigurationUpdate(const OnConfigurationChange& configurationChange) override;
 
@@ -174,7 +182,31 @@ public:
         visibleAreaInnerCallbacks_[ratio] = callback;
     }
 
-    void TriggerVisibleAreaChangeCallback(bool forceDisappear = false);
+    // Window rects of ancestors already intersected with their own ancestors, keyed by node id. Shared by all nodes
+    // handled in one visible area change pass so that each ancestor chain is walked once. The owner keeps it across
+    // passes and clears it in between, so that a pass reuses the storage of the previous one.
+    struct VisibleRectCache {
+        std::unordered_map<int32_t, RectF> rects;
+        // ancestors of the node being handled that are not in |rects| yet.
+        std::vector<RefPtr<FrameNode>> ancestors;
+
+        void Clear()
+        {
+            rects.clear();
+            ancestors.clear();
+        }
+    };
+
+    void TriggerVisibleAreaChangeCallback(bool forceDisappear = false, VisibleRectCache* visibleRectCache = nullptr);
+
+    // Counts every geometry change of every node, used to skip area change dispatch on frames without layout change.
+    static uint64_t GetGeometryChangeCount()
+    {
+        return geometryChangeCount_.load(std::memory_order_relaxed);
+    }
+
+    // Whether this node or any of its ancestors changed geometry after |geometryChangeCount| was taken.
+    bool IsGeometryChangedSince(uint64_t geometryChangeCount) const;
 
     void SetGeometryNode(const RefPtr<GeometryNode>& node);
 
@@ -358,6 +390,11 @@ public:
     void RemoveLastHotZoneRect() const;
 
     virtual bool IsOutOfTouchTestRegion(const PointF& parentLocalPoint, int32_t sourceType);
+    // Cheap reject before IsOutOfTouchTestRegion: the point misses every response region in this subtree.
+    bool IsOutOfHitTestBounds(const PointF& parentRevertPoint);
+    // Drops the hit test bounds cached on this node and its ancestors, called when its geometry, render properties,
+    // frame children or response regions change.
+    void MarkHitTestBoundsDirty();
     bool CheckRectIntersect(const RectF& dest, std::vector<RectF>& origin);
 
     bool IsLayoutDirtyMarked() const
@@ -365,6 +402,17 @@ public:
         return isLayoutDirtyMarked_;
     }
 
+    // Intrusive mark of UITaskScheduler's dirty layout index, which dedupes insertion without a lookup.
+    bool IsInDirtyLayoutIndex() const
+    {
+        return isInDirtyLayoutIndex_;
+    }
+
+    void SetInDirtyLayoutIndex(bool inIndex)
+    {
+        isInDirtyLayoutIndex_ = inIndex;
+    }
+
     bool HasPositionProp() const
     {
         CHECK_NULL_RETURN(renderContext_, false);
@@ -416,6 +464,11 @@ public:
         return isLayoutComplete_;
     }
 
+    const std::unique_ptr<LayoutResultCache>& GetLayoutResultCache() const
+    {
+        return layoutResultCache_;
+    }
+
     bool IsUserSet() const
     {
         return userSet_;
@@ -463,6 +516,8 @@ public:
     std::string ProvideRestoreInfo();
 
     static std::vector<RefPtr<FrameNode>> GetNodesById(const std::unordered_set<int32_t>& set);
+    // Replaces the content of |nodes|, keeping its capacity.
+    static void GetNodesById(const std::unordered_set<int32_t>& set, std::vector<RefPtr<FrameNode>>& nodes);
 
     void SetViewPort(RectF viewPort)
     {
@@ -581,6 +636,12 @@ public:
     virtual std::vector<RectF> GetResponseRegionList(const RectF& rect, int32_t sourceType);
     bool InResponseRegionList(const PointF& parentLocalPoint, const std::vector<RectF>& responseRegionList) const;
 
+    // nodes overriding TouchTest or IsOutOfTouchTestRegion hit outside their response regions, never prune them.
+    virtual bool IsHitTestCustomized() const
+    {
+        return false;
+    }
+
     bool IsFirstBuilding() const
     {
         return isFirstBuilding_;
@@ -632,6 +693,14 @@ private:
     RefPtr<PaintWrapper> CreatePaintWrapper();
     void LayoutOverlay();
 
+    void UpdateHitTestBounds();
+    std::optional<RectF> GetHitTestBoundsInParent();
+
+    // replay or record container layout results keyed by layout constraint, see LayoutResultCache.
+    bool IsLayoutResultCacheable() const;
+    void ReplayLayoutResult(bool constraintChanged);
+    void RecordLayoutResult();
+
     void OnGenerateOneDepthVisibleFrame(std::list<RefPtr<FrameNode>>& visibleList) override;
     void OnGenerateOneDepthVisibleFrameWithTransition(std::list<RefPtr<FrameNode>>& visibleList) override;
     void OnGenerateOneDepthAllFrame(std::list<RefPtr<FrameNode>>& allList) override;
@@ -664,6 +733,8 @@ private:
     void OnPixelRoundFinish(const SizeF& pixelGridRoundSize);
 
     double CalculateCurrentVisibleRatio(const RectF& visibleRect, const RectF& renderRect);
+    std::optional<RectF> GetAncestorsVisibleRect(VisibleRectCache* visibleRectCache) const;
+    void MarkGeometryChanged();
 
     // set costom background layoutConstraint
     void SetBackgroundLayoutConstraint(const RefPtr<FrameNode>& customNode);
@@ -702,10 +773,20 @@ private:
     RefPtr<GeometryNode> oldGeometryNode_;
     std::optional<bool> skipMeasureContent_;
     std::unique_ptr<FramePorxy> frameProxy_;
+    std::unique_ptr<LayoutResultCache> layoutResultCache_;
+
+    // union of the response regions in this subtree, in the space after GetPointWithRevert.
+    RectF hitTestBounds_;
+    bool isHitTestBoundsValid_ = false;
+    bool isHitTestBounded_ = false;
+
+    static std::atomic<uint64_t> geometryChangeCount_;
+    uint64_t geometryChangeSeq_ = 0;
 
     bool needSyncRenderTree_ = false;
 
     bool isLayoutDirtyMarked_ = false;
+    bool isInDirtyLayoutIndex_ = false;
     bool isRenderDirtyMarked_ = false;
     bool isMeasureBoundary_ = false;
     bool hasPendingRequest_ = false;
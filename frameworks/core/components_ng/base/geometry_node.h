@@ -38,6 +38,7 @@ namespace OHOS::Ace::NG {
 // GeometryNode acts as a physical property of the size and position of the component
 class ACE_EXPORT GeometryNode : public AceType {
     DECLARE_ACE_TYPE(GeometryNode, AceType)
+    ACE_POOLED_ALLOCATION();
 public:
     GeometryNode() = default;
     ~GeometryNode() override = default;
@@ -1195,6 +1195,51 @@ void GestureEventHub::SetMonopolizeEvents(bool monopolizeEvents)
     monopolizeEvents_ = monopolizeEvents;
 }
 
+void GestureEventHub::MarkHostHitTestBoundsDirty()
+{
+    auto host = GetFrameNode();
+    CHECK_NULL_VOID(host);
+    host->MarkHitTestBoundsDirty();
+}
+
+void GestureEventHub::SetResponseRegion(const std::vector<DimensionRect>& responseRegion)
+{
+    responseRegion_ = responseRegion;
+    if (!responseRegion_.empty()) {
+        isResponseRegion_ = true;
+    }
+    MarkHostHitTestBoundsDirty();
+}
+
+void GestureEventHub::SetMouseResponseRegion(const std::vector<DimensionRect>& mouseResponseRegion)
+{
+    mouseResponseRegion_ = mouseResponseRegion;
+    if (!mouseResponseRegion_.empty()) {
+        isResponseRegion_ = true;
+    }
+    MarkHostHitTestBoundsDirty();
+}
+
+void GestureEventHub::AddResponseRect(const DimensionRect& responseRect)
+{
+    responseRegion_.emplace_back(responseRect);
+    isResponseRegion_ = true;
+    MarkHostHitTestBoundsDirty();
+}
+
+void GestureEventHub::RemoveLastResponseRect()
+{
+    MarkHostHitTestBoundsDirty();
+    if (responseRegion_.empty()) {
+        isResponseRegion_ = false;
+        return;
+    }
+    responseRegion_.pop_back();
+    if (responseRegion_.empty()) {
+        isResponseRegion_ = false;
+    }
+}
+
 void GestureEventHub::ClearUserOnClick()
 {
     if (clickEventActuator_) {
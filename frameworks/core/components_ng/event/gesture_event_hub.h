@@ -368,39 +368,10 @@ public:
         return mouseResponseRegion_;
     }
 
-    void SetResponseRegion(const std::vector<DimensionRect>& responseRegion)
-    {
-        responseRegion_ = responseRegion;
-        if (!responseRegion_.empty()) {
-            isResponseRegion_ = true;
-        }
-    }
-
-    void SetMouseResponseRegion(const std::vector<DimensionRect>& mouseResponseRegion)
-    {
-        mouseResponseRegion_ = mouseResponseRegion;
-        if (!mouseResponseRegion_.empty()) {
-            isResponseRegion_ = true;
-        }
-    }
-
-    void AddResponseRect(const DimensionRect& responseRect)
-    {
-        responseRegion_.emplace_back(responseRect);
-        isResponseRegion_ = true;
-    }
-
-    void RemoveLastResponseRect()
-    {
-        if (responseRegion_.empty()) {
-            isResponseRegion_ = false;
-            return;
-        }
-        responseRegion_.pop_back();
-        if (responseRegion_.empty()) {
-            isResponseRegion_ = false;
-        }
-    }
+    void SetResponseRegion(const std::vector<DimensionRect>& responseRegion);
+    void SetMouseResponseRegion(const std::vector<DimensionRect>& mouseResponseRegion);
+    void AddResponseRect(const DimensionRect& responseRect);
+    void RemoveLastResponseRect();
 
     bool GetTouchable() const
     {
@@ -507,6 +478,8 @@ private:
         const RefPtr<TargetComponent>& targetComponent);
 
     void UpdateGestureHierarchy();
+    // response regions feed the hit test bounds of the host and its ancestors.
+    void MarkHostHitTestBoundsDirty();
 
     // old path.
     void UpdateExternalNGGestureRecognizer();
@@ -35,7 +35,7 @@ namespace OHOS::Ace::NG {
 namespace {
 RefPtr<ImageData> QueryDataFromCache(const ImageSourceInfo& src, bool& dataHit)
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
 #ifndef USE_ROSEN_DRAWING
     auto cachedData = ImageLoader::QueryImageDataFromImageCache(src);
     if (cachedData) {
@@ -407,6 +407,23 @@ std::optional<SizeF> ImageLoadingContext::GetSourceSize() const
     return { *sourceSizePtr_ };
 }
 
+void ImageLoadingContext::SetVisible(bool visible)
+{
+    if (visible_ == visible) {
+        return;
+    }
+    visible_ = visible;
+    if (syncLoad_) {
+        return;
+    }
+    auto state = stateManager_->GetCurrentState();
+    if (state == ImageLoadingState::DATA_LOADING) {
+        ImageProvider::UpdateTaskPriority(src_.GetKey(), visible);
+    } else if (state == ImageLoadingState::MAKE_CANVAS_IMAGE) {
+        ImageProvider::UpdateTaskPriority(canvasKey_, visible);
+    }
+}
+
 bool ImageLoadingContext::NeedAlt() const
 {
     auto state = stateManager_->GetCurrentState();
@@ -65,6 +65,12 @@ public:
     void SetImageFit(ImageFit imageFit);
     void SetAutoResize(bool needResize);
     void SetSourceSize(const std::optional<SizeF>& sourceSize = std::nullopt);
+    // background tasks of visible images run first
+    void SetVisible(bool visible);
+    bool IsVisible() const
+    {
+        return visible_;
+    }
 
     // callbacks that will be called by ImageProvider when load process finishes
     void DataReadyCallback(const RefPtr<ImageObject>& imageObj);
@@ -114,6 +120,7 @@ private:
 
     bool autoResize_ = true;
     bool syncLoad_ = false;
+    bool visible_ = true;
 
     RectF srcRect_;
     RectF dstRect_;
@@ -20,6 +20,7 @@
 
 #include "base/log/ace_trace.h"
 #include "base/memory/referenced.h"
+#include "core/common/container_scope.h"
 #include "core/components_ng/image_provider/adapter/image_decoder.h"
 #ifndef USE_ROSEN_DRAWING
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
@@ -58,6 +59,9 @@ void ImageProvider::CacheImageObject(const RefPtr<ImageObject>& obj)
 
 std::mutex ImageProvider::taskMtx_;
 std::unordered_map<std::string, ImageProvider::Task> ImageProvider::tasks_;
+std::array<std::map<ImageProvider::QueueKey, ImageProvider::QueuedTask, std::greater<>>, ImageProvider::STAGE_COUNT>
+    ImageProvider::queues_;
+uint64_t ImageProvider::taskSequence_ = 0;
 
 bool ImageProvider::PrepareImageData(const RefPtr<ImageObject>& imageObj)
 {
@@ -154,7 +158,7 @@ void ImageProvider::SuccessCallback(const RefPtr<CanvasImage>& canvasImage, cons
 
 void ImageProvider::CreateImageObjHelper(const ImageSourceInfo& src, bool sync)
 {
-    ACE_SCOPED_TRACE("CreateImageObj %s", src.ToString().c_str());
+    ACE_IMAGE_SCOPED_TRACE("CreateImageObj %s", src.ToString().c_str());
     // load image data
     auto imageLoader = ImageLoader::CreateImageLoader(src);
     if (!imageLoader) {
@@ -250,6 +254,58 @@ void ImageProvider::CancelTask(const std::string& key, const WeakPtr<ImageLoadin
     it->second.ctxs_.erase(ctx);
 }
 
+void ImageProvider::UpdateTaskPriority(const std::string& key, bool visible)
+{
+    std::scoped_lock<std::mutex> lock(taskMtx_);
+    auto it = tasks_.find(key);
+    CHECK_NULL_VOID(it != tasks_.end());
+    auto& queue = queues_[it->second.stage_];
+    auto queued = queue.find(it->second.queueKey_);
+    // task is already running
+    if (queued == queue.end() || queued->first.first == visible) {
+        return;
+    }
+    auto node = queue.extract(queued);
+    node.key() = { visible, node.key().second };
+    it->second.queueKey_ = node.key();
+    queue.insert(std::move(node));
+}
+
+void ImageProvider::PostToStage(
+    TaskStage stage, const std::string& key, const CancelableCallback<void()>& task, bool visible)
+{
+    auto& record = tasks_[key];
+    record.bgTask_ = task;
+    record.stage_ = stage;
+    record.queueKey_ = { visible, ++taskSequence_ };
+    queues_[stage].emplace(record.queueKey_, QueuedTask { task, ContainerScope::CurrentId() });
+    ImageUtils::PostToBg([stage] { ImageProvider::RunNextTask(stage); });
+}
+
+void ImageProvider::RunNextTask(TaskStage stage)
+{
+    QueuedTask task;
+    {
+        std::scoped_lock<std::mutex> lock(taskMtx_);
+        auto& queue = queues_[stage];
+        if (queue.empty()) {
+            return;
+        }
+        task = std::move(queue.begin()->second);
+        queue.erase(queue.begin());
+    }
+    // the runner may have been posted by another instance
+    ContainerScope scope(task.containerId);
+    // canceled tasks do nothing
+    task.callback();
+}
+
+bool ImageProvider::IsVisible(const WeakPtr<ImageLoadingContext>& ctxWp)
+{
+    auto ctx = ctxWp.Upgrade();
+    return !ctx || ctx->IsVisible();
+}
+
 void ImageProvider::CreateImageObject(const ImageSourceInfo& src, const WeakPtr<ImageLoadingContext>& ctx, bool sync)
 {
     if (!RegisterTask(src.GetKey(), ctx)) {
@@ -259,12 +315,12 @@ void ImageProvider::CreateImageObject(const ImageSourceInfo& src, const WeakPtr<
     if (sync) {
         CreateImageObjHelper(src, true);
     } else {
+        auto visible = IsVisible(ctx);
         std::scoped_lock<std::mutex> lock(taskMtx_);
         // wrap with [CancelableCallback] and record in [tasks_] map
         CancelableCallback<void()> task;
         task.Reset([src] { ImageProvider::CreateImageObjHelper(src); });
-        tasks_[src.GetKey()].bgTask_ = task;
-        ImageUtils::PostToBg(task);
+        PostToStage(LOAD, src.GetKey(), task, visible);
     }
 }
 
@@ -314,12 +370,12 @@ void ImageProvider::MakeCanvasImage(const RefPtr<ImageObject>& obj, const WeakPt
     if (sync) {
         MakeCanvasImageHelper(obj, size, key, forceResize, true);
     } else {
+        auto visible = IsVisible(ctxWp);
         std::scoped_lock<std::mutex> lock(taskMtx_);
         // wrap with [CancelableCallback] and record in [tasks_] map
         CancelableCallback<void()> task;
         task.Reset([key, obj, size, forceResize] { MakeCanvasImageHelper(obj, size, key, forceResize); });
-        tasks_[key].bgTask_ = task;
-        ImageUtils::PostToBg(task);
+        PostToStage(DECODE, key, task, visible);
     }
 }
 
@@ -16,7 +16,9 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_PROVIDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_PROVIDER_H
 
+#include <array>
 #include <functional>
+#include <map>
 #include <set>
 #include <unordered_map>
 
@@ -83,6 +85,9 @@ public:
     // cancel a scheduled background task
     static void CancelTask(const std::string& key, const WeakPtr<ImageLoadingContext>& ctx);
 
+    // move a task still waiting in its queue ahead of (or behind) the tasks of invisible images
+    static void UpdateTaskPriority(const std::string& key, bool visible);
+
     static RefPtr<ImageObject> BuildImageObject(const ImageSourceInfo& src, const RefPtr<ImageData>& data);
 
     static void CacheImageObject(const RefPtr<ImageObject>& obj);
@@ -113,13 +118,38 @@ private:
     static void SuccessCallback(const RefPtr<CanvasImage>& canvasImage, const std::string& key, bool sync = false);
     static void FailCallback(const std::string& key, const std::string& errorMsg, bool sync = false);
 
+    // Background tasks wait in a queue per stage: [LOAD] fetches data and parses the header, [DECODE] decodes to the
+    // target size and uploads. Every task posts one runner to the background executor, which runs whichever task of
+    // its stage comes first when it starts: tasks of visible images first, then the most recent ones. When flinging
+    // through a grid, images that just scrolled in are decoded before those that scrolled out, which are likely to
+    // be canceled before their turn.
+    enum TaskStage : uint32_t { LOAD = 0, DECODE, STAGE_COUNT };
+    // (visible, sequence), ordered by std::greater so that the first entry runs next
+    using QueueKey = std::pair<bool, uint64_t>;
+
+    struct QueuedTask {
+        CancelableCallback<void()> callback;
+        int32_t containerId = -1;
+    };
+
+    // REQUIRE: [taskMtx_] is locked
+    static void PostToStage(TaskStage stage, const std::string& key, const CancelableCallback<void()>& task,
+        bool visible);
+    static void RunNextTask(TaskStage stage);
+    static bool IsVisible(const WeakPtr<ImageLoadingContext>& ctxWp);
+
     struct Task {
         CancelableCallback<void()> bgTask_;
         std::set<WeakPtr<ImageLoadingContext>> ctxs_;
+        TaskStage stage_ = LOAD;
+        // position in the queue of [stage_] while waiting to run
+        QueueKey queueKey_;
     };
 
     static std::mutex taskMtx_;
     static std::unordered_map<std::string, Task> tasks_;
+    static std::array<std::map<QueueKey, QueuedTask, std::greater<>>, STAGE_COUNT> queues_;
+    static uint64_t taskSequence_;
 };
 
 } // namespace OHOS::Ace::NG
@@ -49,6 +49,7 @@ class FrameNode;
 
 class ACE_FORCE_EXPORT LayoutProperty : public Property {
     DECLARE_ACE_TYPE(LayoutProperty, Property);
+    ACE_POOLED_ALLOCATION();
 
 public:
     LayoutProperty() = default;
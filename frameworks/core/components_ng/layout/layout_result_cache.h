@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_LAYOUT_RESULT_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_LAYOUT_RESULT_CACHE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base/geometry/ng/offset_t.h"
+#include "base/geometry/ng/rect_t.h"
+#include "base/geometry/ng/size_t.h"
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "base/utils/noncopyable.h"
+#include "core/components_ng/base/geometry_node.h"
+#include "core/components_ng/layout/layout_algorithm.h"
+#include "core/components_ng/layout/layout_wrapper.h"
+#include "core/components_ng/property/layout_constraint.h"
+
+namespace OHOS::Ace::NG {
+// The placement of one child recorded by LayoutResultEntry.
+struct LayoutResultChild {
+    WeakPtr<LayoutWrapper> wrapper;
+    LayoutConstraintF constraint;
+    SizeF frameSize;
+    OffsetF frameOffset;
+};
+
+// What a container layout algorithm produced for one layout constraint.
+struct LayoutResultEntry {
+    LayoutConstraintF constraint;
+    SizeF frameSize;
+    std::optional<RectF> contentRect;
+    std::vector<LayoutResultChild> children;
+};
+
+// LayoutResultCache keeps the last few layout results of a node keyed by its layout constraint, so that a
+// constraint flipping back and forth (window resize, rotation) does not re-run the container layout algorithm.
+// Entries only stay valid while the node's properties are unchanged, the owner drops them on any layout flag.
+// Dropped and evicted entries are kept for the next record, so that a warm cache records without allocating.
+class LayoutResultCache {
+public:
+    static constexpr size_t MAX_ENTRY_COUNT = 4;
+
+    LayoutResultCache() = default;
+    ~LayoutResultCache() = default;
+
+    // Returns the entry recorded for |constraint| and moves it to the front, or nullptr on a miss.
+    const LayoutResultEntry* Find(const LayoutConstraintF& constraint)
+    {
+        for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+            if (iter->constraint == constraint) {
+                entries_.splice(entries_.begin(), entries_, iter);
+                ++hitCount_;
+                return &entries_.front();
+            }
+        }
+        ++missCount_;
+        return nullptr;
+    }
+
+    // Returns the cleared entry at the front to record the result for |constraint| into. It reuses the entry
+    // recorded for |constraint|, a dropped one or the least recently used one, children keep their capacity.
+    LayoutResultEntry& StartRecord(const LayoutConstraintF& constraint)
+    {
+        auto iter = std::find_if(entries_.begin(), entries_.end(),
+            [&constraint](const LayoutResultEntry& item) { return item.constraint == constraint; });
+        if (iter != entries_.end()) {
+            entries_.splice(entries_.begin(), entries_, iter);
+        } else if (!spareEntries_.empty()) {
+            entries_.splice(entries_.begin(), spareEntries_, spareEntries_.begin());
+        } else if (entries_.size() >= MAX_ENTRY_COUNT) {
+            entries_.splice(entries_.begin(), entries_, std::prev(entries_.end()));
+        } else {
+            entries_.emplace_front();
+        }
+        auto& entry = entries_.front();
+        entry.constraint = constraint;
+        entry.frameSize.Reset();
+        entry.contentRect.reset();
+        entry.children.clear();
+        return entry;
+    }
+
+    // The result being recorded into the front entry can't be replayed, drop it.
+    void CancelRecord()
+    {
+        if (!entries_.empty()) {
+            spareEntries_.splice(spareEntries_.begin(), entries_, entries_.begin());
+        }
+    }
+
+    // The children of the entry replayed for |constraint| no longer match what was recorded, count it as a miss.
+    void MarkReplayFailed(const LayoutConstraintF& constraint)
+    {
+        auto iter = std::find_if(entries_.begin(), entries_.end(),
+            [&constraint](const LayoutResultEntry& item) { return item.constraint == constraint; });
+        if (iter != entries_.end()) {
+            spareEntries_.splice(spareEntries_.begin(), entries_, iter);
+        }
+        --hitCount_;
+        ++missCount_;
+    }
+
+    void Invalidate()
+    {
+        if (entries_.empty()) {
+            return;
+        }
+        spareEntries_.splice(spareEntries_.begin(), entries_);
+        ++invalidateCount_;
+    }
+
+    size_t GetEntryCount() const
+    {
+        return entries_.size();
+    }
+
+    uint32_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint32_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    std::string ToString() const
+    {
+        auto total = hitCount_ + missCount_;
+        auto hitRate = total == 0 ? 0 : hitCount_ * 100 / total;
+        return std::string("hit: ")
+            .append(std::to_string(hitCount_))
+            .append(", miss: ")
+            .append(std::to_string(missCount_))
+            .append(", hitRate: ")
+            .append(std::to_string(hitRate))
+            .append("%, invalidate: ")
+            .append(std::to_string(invalidateCount_))
+            .append(", entries: ")
+            .append(std::to_string(entries_.size()));
+    }
+
+private:
+    std::list<LayoutResultEntry> entries_;
+    // entries_ and spareEntries_ hold at most MAX_ENTRY_COUNT entries together.
+    std::list<LayoutResultEntry> spareEntries_;
+    uint32_t hitCount_ = 0;
+    uint32_t missCount_ = 0;
+    uint32_t invalidateCount_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(LayoutResultCache);
+};
+
+// LayoutResultReplayAlgorithm applies a cached LayoutResultEntry instead of running the origin algorithm. Children
+// are still measured with their recorded constraints, if any of them comes back with a different size the origin
+// algorithm takes over for the whole measure and layout pass. The entry is copied, the LayoutResultCache of the node
+// reuses the storage of its entries in place and may be dropped while the algorithm is still referenced.
+class ACE_EXPORT LayoutResultReplayAlgorithm : public LayoutAlgorithm {
+    DECLARE_ACE_TYPE(LayoutResultReplayAlgorithm, LayoutAlgorithm);
+
+public:
+    LayoutResultReplayAlgorithm(const LayoutResultEntry& entry, const RefPtr<LayoutAlgorithm>& origin)
+        : entry_(entry), origin_(origin)
+    {}
+    ~LayoutResultReplayAlgorithm() override = default;
+
+    std::optional<SizeF> MeasureContent(
+        const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper) override
+    {
+        if (!origin_) {
+            return std::nullopt;
+        }
+        return origin_->MeasureContent(contentConstraint, layoutWrapper);
+    }
+
+    void Measure(LayoutWrapper* layoutWrapper) override
+    {
+        replayed_ = Replay(layoutWrapper);
+        if (!replayed_ && origin_) {
+            origin_->Measure(layoutWrapper);
+        }
+    }
+
+    void Layout(LayoutWrapper* layoutWrapper) override
+    {
+        if (!replayed_) {
+            if (origin_) {
+                origin_->Layout(layoutWrapper);
+            }
+            return;
+        }
+        const auto& geometryNode = layoutWrapper->GetGeometryNode();
+        if (entry_.contentRect) {
+            geometryNode->SetContentOffset(entry_.contentRect->GetOffset());
+        }
+        const auto& children = layoutWrapper->GetAllChildrenWithBuild(false);
+        auto iter = entry_.children.begin();
+        for (const auto& child : children) {
+            if (iter == entry_.children.end()) {
+                break;
+            }
+            child->GetGeometryNode()->SetFrameOffset(iter->frameOffset);
+            child->Layout();
+            ++iter;
+        }
+    }
+
+    bool IsReplayed() const
+    {
+        return replayed_;
+    }
+
+    const LayoutResultEntry& GetEntry() const
+    {
+        return entry_;
+    }
+
+    const RefPtr<LayoutAlgorithm>& GetOriginAlgorithm() const
+    {
+        return origin_;
+    }
+
+private:
+    bool Replay(LayoutWrapper* layoutWrapper)
+    {
+        const auto& children = layoutWrapper->GetAllChildrenWithBuild();
+        if (children.size() != entry_.children.size()) {
+            return false;
+        }
+        auto iter = entry_.children.begin();
+        for (const auto& child : children) {
+            if (iter->wrapper.Upgrade() != child) {
+                return false;
+            }
+            ++iter;
+        }
+        iter = entry_.children.begin();
+        for (const auto& child : children) {
+            child->Measure(iter->constraint);
+            if (!child->IsActive() || child->GetGeometryNode()->GetFrameSize() != iter->frameSize) {
+                return false;
+            }
+            ++iter;
+        }
+        const auto& geometryNode = layoutWrapper->GetGeometryNode();
+        geometryNode->SetFrameSize(entry_.frameSize);
+        if (entry_.contentRect) {
+            geometryNode->SetContentSize(entry_.contentRect->GetSize());
+        }
+        return true;
+    }
+
+    const LayoutResultEntry entry_;
+    RefPtr<LayoutAlgorithm> origin_;
+    bool replayed_ = false;
+
+    ACE_DISALLOW_COPY_AND_MOVE(LayoutResultReplayAlgorithm);
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_LAYOUT_RESULT_CACHE_H
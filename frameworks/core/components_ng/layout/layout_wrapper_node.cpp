@@ -371,7 +371,7 @@ void LayoutWrapperNode::BuildLazyItem()
     if (!lazyBuildFunction_) {
         return;
     }
-    ACE_FUNCTION_TRACE();
+    ACE_LAYOUT_SCOPED_TRACE(__func__);
     lazyBuildFunction_(Claim(this));
     lazyBuildFunction_ = nullptr;
 }
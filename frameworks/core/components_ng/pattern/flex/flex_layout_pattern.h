@@ -51,6 +51,11 @@ public:
         return false;
     }
 
+    bool IsLayoutResultCacheable() const override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<FlexLayoutPattern>();
+    }
+
     FocusPattern GetFocusPattern() const override
     {
         return { FocusType::SCOPE, true };
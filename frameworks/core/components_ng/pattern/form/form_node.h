@@ -35,6 +35,11 @@ public:
         const PointF& parentRevertPoint, const TouchRestrict& touchRestrict,
         TouchTestResult& result, int32_t touchId) override;
 
+    bool IsHitTestCustomized() const override
+    {
+        return true;
+    }
+
     static RefPtr<FormNode> GetOrCreateFormNode(
         const std::string& tag, int32_t nodeId, const std::function<RefPtr<Pattern>(void)>& patternCreator);
 
@@ -14,6 +14,8 @@
  */
 #include "core/components_ng/pattern/grid/grid_layout_info.h"
 
+#include <algorithm>
+
 #include "base/utils/utils.h"
 
 namespace OHOS::Ace::NG {
@@ -89,6 +91,7 @@ void GridLayoutInfo::MoveItemsForward(int32_t from, int32_t to, int32_t itemInde
 
 void GridLayoutInfo::SwapItems(int32_t itemIndex, int32_t insertIndex)
 {
+    ResetLineHeightIndex();
     currentMovingItemPosition_ = currentMovingItemPosition_ == -1 ? itemIndex : currentMovingItemPosition_;
     auto insertPositon = insertIndex;
     // drag from another grid
@@ -127,20 +130,48 @@ void GridLayoutInfo::UpdateEndLine(float mainSize, float mainGap)
 
 float GridLayoutInfo::GetCurrentOffsetOfRegularGrid(float mainGap) const
 {
-    float lineHeight = 0.0f;
-    for (const auto& item : lineHeightMap_) {
-        auto line = gridMatrix_.find(item.first);
-        if (line == gridMatrix_.end()) {
-            continue;
+    float lineHeight = GetLineHeightIndex().GetFirstMeasuredLineHeight();
+    auto lines = startIndex_ / crossCount_;
+    return lines * (lineHeight + mainGap) - currentOffset_;
+}
+
+void GridLineHeightIndex::Build(
+    const std::map<int32_t, std::map<int32_t, int32_t>>& gridMatrix, const std::map<int32_t, float>& lineHeightMap)
+{
+    lines_.clear();
+    lines_.reserve(lineHeightMap.size());
+    prefixHeights_.clear();
+    prefixHeights_.reserve(lineHeightMap.size() + 1);
+    prefixHeights_.push_back(0.0);
+    measuredLineCount_ = 0;
+    measuredItemCount_ = 0;
+    measuredHeight_ = 0.0f;
+    firstMeasuredLineHeight_ = 0.0f;
+    // both maps are ordered by line, walk them together instead of looking up every line.
+    auto line = gridMatrix.begin();
+    for (const auto& [lineIndex, lineHeight] : lineHeightMap) {
+        lines_.push_back(lineIndex);
+        prefixHeights_.push_back(prefixHeights_.back() + lineHeight);
+        while (line != gridMatrix.end() && line->first < lineIndex) {
+            ++line;
         }
-        if (line->second.empty()) {
+        if (line == gridMatrix.end() || line->first != lineIndex || line->second.empty()) {
             continue;
         }
-        lineHeight = item.second;
-        break;
+        if (measuredLineCount_ == 0) {
+            firstMeasuredLineHeight_ = lineHeight;
+        }
+        ++measuredLineCount_;
+        measuredItemCount_ += line->second.rbegin()->second - line->second.begin()->second + 1;
+        measuredHeight_ += lineHeight;
     }
-    auto lines = startIndex_ / crossCount_;
-    return lines * (lineHeight + mainGap) - currentOffset_;
+    valid_ = true;
+}
+
+float GridLineHeightIndex::GetHeightBefore(int32_t line, float mainGap) const
+{
+    auto count = std::lower_bound(lines_.begin(), lines_.end(), line) - lines_.begin();
+    return static_cast<float>(prefixHeights_[count] + count * static_cast<double>(mainGap));
 }
 
 float GridLayoutInfo::GetContentOffset(float mainGap) const
@@ -149,22 +180,10 @@ float GridLayoutInfo::GetContentOffset(float mainGap) const
         return GetCurrentOffsetOfRegularGrid(mainGap);
     }
 
-    float heightSum = 0;
-    int32_t itemCount = 0;
+    const auto& lineHeightIndex = GetLineHeightIndex();
+    float heightSum = lineHeightIndex.GetMeasuredHeight(mainGap);
+    int32_t itemCount = lineHeightIndex.GetMeasuredItemCount();
     float height = 0;
-    for (const auto& item : lineHeightMap_) {
-        auto line = gridMatrix_.find(item.first);
-        if (line == gridMatrix_.end()) {
-            continue;
-        }
-        if (line->second.empty()) {
-            continue;
-        }
-        auto lineStart = line->second.begin()->second;
-        auto lineEnd = line->second.rbegin()->second;
-        itemCount += (lineEnd - lineStart + 1);
-        heightSum += item.second + mainGap;
-    }
     if (itemCount == 0) {
         return 0;
     }
@@ -178,41 +197,18 @@ float GridLayoutInfo::GetContentOffset(float mainGap) const
 
 float GridLayoutInfo::GetContentHeight(float mainGap) const
 {
+    const auto& lineHeightIndex = GetLineHeightIndex();
     if (!hasBigItem_) {
-        float lineHeight = 0.0f;
-        for (const auto& item : lineHeightMap_) {
-            auto line = gridMatrix_.find(item.first);
-            if (line == gridMatrix_.end()) {
-                continue;
-            }
-            if (line->second.empty()) {
-                continue;
-            }
-            lineHeight = item.second;
-            break;
-        }
+        float lineHeight = lineHeightIndex.GetFirstMeasuredLineHeight();
         auto lines = (childrenCount_) / crossCount_;
         if (childrenCount_ % crossCount_ == 0) {
             return lines * lineHeight + (lines - 1) * mainGap;
         }
         return (lines + 1) * lineHeight + lines * mainGap;
     }
-    float heightSum = 0;
-    int32_t itemCount = 0;
+    float heightSum = lineHeightIndex.GetMeasuredHeight(mainGap);
+    int32_t itemCount = lineHeightIndex.GetMeasuredItemCount();
     float estimatedHeight = 0;
-    for (const auto& item : lineHeightMap_) {
-        auto line = gridMatrix_.find(item.first);
-        if (line == gridMatrix_.end()) {
-            continue;
-        }
-        if (line->second.empty()) {
-            continue;
-        }
-        auto lineStart = line->second.begin()->second;
-        auto lineEnd = line->second.rbegin()->second;
-        itemCount += (lineEnd - lineStart + 1);
-        heightSum += item.second + mainGap;
-    }
     if (itemCount == 0) {
         return 0;
     }
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <optional>
+#include <vector>
 
 #include "base/geometry/axis.h"
 #include "base/geometry/ng/rect_t.h"
@@ -26,6 +27,69 @@
 
 namespace OHOS::Ace::NG {
 
+// Sums over the lines of a laid out Grid, so that the offset and the height of the content are found in O(log n)
+// instead of walking [lineHeightMap_] and looking up [gridMatrix_] for every line on each scroll.
+class GridLineHeightIndex {
+public:
+    GridLineHeightIndex() = default;
+    ~GridLineHeightIndex() = default;
+    // Copies start empty, the copy of GridLayoutInfo handed to a layout algorithm changes its maps.
+    GridLineHeightIndex(const GridLineHeightIndex& /* other */) {}
+    GridLineHeightIndex& operator=(const GridLineHeightIndex& /* other */)
+    {
+        Reset();
+        return *this;
+    }
+
+    void Build(const std::map<int32_t, std::map<int32_t, int32_t>>& gridMatrix,
+        const std::map<int32_t, float>& lineHeightMap);
+
+    void Reset()
+    {
+        valid_ = false;
+    }
+
+    bool IsValid() const
+    {
+        return valid_;
+    }
+
+    // sum of (lineHeight + mainGap) of the lines before [line]
+    float GetHeightBefore(int32_t line, float mainGap) const;
+
+    float GetTotalHeight(float mainGap) const
+    {
+        return GetHeightBefore(lines_.empty() ? 0 : lines_.back() + 1, mainGap) - mainGap;
+    }
+
+    // the following only count lines which are both in [gridMatrix_] and [lineHeightMap_]
+    int32_t GetMeasuredItemCount() const
+    {
+        return measuredItemCount_;
+    }
+
+    float GetMeasuredHeight(float mainGap) const
+    {
+        return measuredHeight_ + measuredLineCount_ * mainGap;
+    }
+
+    float GetFirstMeasuredLineHeight() const
+    {
+        return firstMeasuredLineHeight_;
+    }
+
+private:
+    // line indexes of [lineHeightMap_] in ascending order
+    std::vector<int32_t> lines_;
+    // prefixHeights_[i] is the sum of the heights of lines_[0, i)
+    std::vector<double> prefixHeights_;
+    int32_t measuredLineCount_ = 0;
+    int32_t measuredItemCount_ = 0;
+    float measuredHeight_ = 0.0f;
+    float firstMeasuredLineHeight_ = 0.0f;
+    bool valid_ = false;
+};
+
 // Try not to add more variables in [GridLayoutInfo] because the more state variables, the more problematic and the
 // harder it is to maintain
 struct GridLayoutInfo {
@@ -74,21 +138,27 @@ struct GridLayoutInfo {
     // should only be used when all children of Grid are in gridMatrix_
     float GetStartLineOffset(float mainGap) const
     {
-        float totalHeight = 0;
-        for (auto iter = lineHeightMap_.begin(); iter != lineHeightMap_.end() && iter->first < startMainLineIndex_;
-             ++iter) {
-            totalHeight += (iter->second + mainGap);
-        }
-        return totalHeight - currentOffset_;
+        return GetLineHeightIndex().GetHeightBefore(startMainLineIndex_, mainGap) - currentOffset_;
     }
 
     float GetTotalLineHeight(float mainGap) const
     {
-        float totalHeight = 0.0f;
-        for (auto iter = lineHeightMap_.begin(); iter != lineHeightMap_.end(); ++iter) {
-            totalHeight += (iter->second + mainGap);
+        return GetLineHeightIndex().GetTotalHeight(mainGap);
+    }
+
+    // Built on first use after layout, so it must not be used while the maps are being changed.
+    const GridLineHeightIndex& GetLineHeightIndex() const
+    {
+        if (!lineHeightIndex_.IsValid()) {
+            lineHeightIndex_.Build(gridMatrix_, lineHeightMap_);
         }
-        return totalHeight - mainGap;
+        return lineHeightIndex_;
+    }
+
+    // should be called after changing [gridMatrix_] or [lineHeightMap_] outside of a layout algorithm
+    void ResetLineHeightIndex()
+    {
+        lineHeightIndex_.Reset();
     }
 
     void ResetPositionFlags()
@@ -165,6 +235,7 @@ private:
     void MoveItemsForward(int32_t from, int32_t to, int32_t itemIndex);
     int32_t currentMovingItemPosition_ = -1;
     std::map<int32_t, int32_t> positionItemIndexMap_;
+    mutable GridLineHeightIndex lineHeightIndex_;
 };
 
 } // namespace OHOS::Ace::NG
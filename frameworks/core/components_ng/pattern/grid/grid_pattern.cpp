@@ -1384,22 +1384,10 @@ float GridPattern::GetAverageHeight() const
     auto viewScopeSize = geometryNode->GetPaddingSize();
     auto layoutProperty = host->GetLayoutProperty<GridLayoutProperty>();
 
-    float heightSum = 0;
-    int32_t itemCount = 0;
     auto mainGap = GridUtils::GetMainGap(layoutProperty, viewScopeSize, info.axis_);
-    for (const auto& item : info.lineHeightMap_) {
-        auto line = info.gridMatrix_.find(item.first);
-        if (line == info.gridMatrix_.end()) {
-            continue;
-        }
-        if (line->second.empty()) {
-            continue;
-        }
-        auto lineStart = line->second.begin()->second;
-        auto lineEnd = line->second.rbegin()->second;
-        itemCount += (lineEnd - lineStart + 1);
-        heightSum += item.second + mainGap;
-    }
+    const auto& lineHeightIndex = info.GetLineHeightIndex();
+    float heightSum = lineHeightIndex.GetMeasuredHeight(mainGap);
+    int32_t itemCount = lineHeightIndex.GetMeasuredItemCount();
     if (itemCount == 0) {
         return 0;
     }
@@ -1449,9 +1437,9 @@ void GridPattern::UpdateScrollBarOffset()
         }
     }
     if (info.startMainLineIndex_ != 0 && info.startIndex_ == 0) {
-        for (int32_t lineIndex = info.startMainLineIndex_ - 1; lineIndex >= 0; lineIndex--) {
-            offset += info.lineHeightMap_.find(lineIndex)->second;
-        }
+        const auto& lineHeightIndex = info.GetLineHeightIndex();
+        offset += lineHeightIndex.GetHeightBefore(info.startMainLineIndex_, 0.0f) -
+                  lineHeightIndex.GetHeightBefore(0, 0.0f);
     }
     auto viewSize = geometryNode->GetFrameSize();
     UpdateScrollBarRegion(offset, estimatedHeight, Size(viewSize.Width(), viewSize.Height()), Offset(0.0f, 0.0f));
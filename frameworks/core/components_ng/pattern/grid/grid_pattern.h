@@ -132,6 +132,7 @@ public:
         gridLayoutInfo_.endMainLineIndex_ = 0;
         gridLayoutInfo_.ResetPositionFlags();
         gridLayoutInfo_.irregularItemsPosition_.clear();
+        gridLayoutInfo_.ResetLineHeightIndex();
     }
 
     void ResetPositionFlags()
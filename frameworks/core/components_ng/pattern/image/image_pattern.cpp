@@ -519,6 +519,7 @@ void ImagePattern::OnVisibleChange(bool visible)
     if (!visible) {
         CloseSelectOverlay();
     }
+    UpdateLoadingPriority(visible);
     // control svg / gif animation
     if (image_) {
         image_->ControlAnimation(visible);
@@ -527,6 +528,26 @@ void ImagePattern::OnVisibleChange(bool visible)
     }
 }
 
+void ImagePattern::OnActive()
+{
+    UpdateLoadingPriority(true);
+}
+
+void ImagePattern::OnInActive()
+{
+    UpdateLoadingPriority(false);
+}
+
+void ImagePattern::UpdateLoadingPriority(bool visible)
+{
+    if (loadingCtx_) {
+        loadingCtx_->SetVisible(visible);
+    }
+    if (altLoadingCtx_) {
+        altLoadingCtx_->SetVisible(visible);
+    }
+}
+
 void ImagePattern::OnAttachToFrameNode()
 {
     auto host = GetHost();
@@ -86,6 +86,8 @@ public:
     void OnWindowHide() override;
     void OnWindowShow() override;
     void OnVisibleChange(bool isVisible) override;
+    void OnActive() override;
+    void OnInActive() override;
     void OnRecycle() override;
     void OnReuse() override;
 
@@ -142,6 +144,7 @@ private:
     void PrepareAnimation(const RefPtr<CanvasImage>& image);
     void SetRedrawCallback(const RefPtr<CanvasImage>& image);
     void RegisterVisibleAreaChange();
+    void UpdateLoadingPriority(bool visible);
 
     void InitCopy();
     void HandleCopy();
@@ -51,6 +51,12 @@ public:
         return { FocusType::SCOPE, true };
     }
 
+    // Row and Column only, subclasses such as pickers keep their own layout state.
+    bool IsLayoutResultCacheable() const override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<LinearLayoutPattern>();
+    }
+
     ScopeFocusAlgorithm GetScopeFocusAlgorithm() override
     {
         return { isVertical_, true, ScopeType::FLEX };
@@ -89,7 +89,7 @@ int32_t ListLanesLayoutAlgorithm::LayoutALineForward(LayoutWrapper* layoutWrappe
         ++currentIndex;
         if (isGroup) {
             if (wrapper->GetHostNode()) {
-                ACE_SCOPED_TRACE("[MeasureListForwardItemGroup:%d][self:%d][parent:%d]", currentIndex,
+                ACE_LAYOUT_SCOPED_TRACE("[MeasureListForwardItemGroup:%d][self:%d][parent:%d]", currentIndex,
                     wrapper->GetHostNode()->GetId(), wrapper->GetHostNode()->GetParent() ?
                         wrapper->GetHostNode()->GetParent()->GetId() : 0);
             }
@@ -98,7 +98,7 @@ int32_t ListLanesLayoutAlgorithm::LayoutALineForward(LayoutWrapper* layoutWrappe
             wrapper->Measure(groupLayoutConstraint_);
         } else {
             if (wrapper->GetHostNode()) {
-                ACE_SCOPED_TRACE("[MeasureListForwardItem:%d][self:%d][parent:%d]", currentIndex,
+                ACE_LAYOUT_SCOPED_TRACE("[MeasureListForwardItem:%d][self:%d][parent:%d]", currentIndex,
                     wrapper->GetHostNode()->GetId(), wrapper->GetHostNode()->GetParent() ?
                         wrapper->GetHostNode()->GetParent()->GetId() : 0);
             }
@@ -145,7 +145,7 @@ int32_t ListLanesLayoutAlgorithm::LayoutALineBackward(LayoutWrapper* layoutWrapp
         cnt++;
         if (isGroup) {
             if (wrapper->GetHostNode()) {
-                ACE_SCOPED_TRACE("[MeasureListBackwardItemGroup:%d][self:%d][parent:%d]", currentIndex,
+                ACE_LAYOUT_SCOPED_TRACE("[MeasureListBackwardItemGroup:%d][self:%d][parent:%d]", currentIndex,
                     wrapper->GetHostNode()->GetId(), wrapper->GetHostNode()->GetParent() ?
                         wrapper->GetHostNode()->GetParent()->GetId() : 0);
             }
@@ -154,7 +154,7 @@ int32_t ListLanesLayoutAlgorithm::LayoutALineBackward(LayoutWrapper* layoutWrapp
             wrapper->Measure(groupLayoutConstraint_);
         } else {
             if (wrapper->GetHostNode()) {
-                ACE_SCOPED_TRACE("[MeasureListBackwardItem:%d][self:%d][parent:%d]", currentIndex,
+                ACE_LAYOUT_SCOPED_TRACE("[MeasureListBackwardItem:%d][self:%d][parent:%d]", currentIndex,
                     wrapper->GetHostNode()->GetId(), wrapper->GetHostNode()->GetParent() ?
                         wrapper->GetHostNode()->GetParent()->GetId() : 0);
             }
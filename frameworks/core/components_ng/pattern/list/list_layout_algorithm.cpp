@@ -795,7 +795,7 @@ int32_t ListLayoutAlgorithm::LayoutALineForward(LayoutWrapper* layoutWrapper,
         SetListItemGroupParam(wrapper, startPos, true, listLayoutProperty, false);
     }
     {
-        ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem:%d", currentIndex);
+        ACE_LAYOUT_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem:%d", currentIndex);
         wrapper->Measure(childLayoutConstraint_);
     }
     float mainLen = GetMainAxisSize(wrapper->GetGeometryNode()->GetMarginFrameSize(), axis_);
@@ -820,7 +820,7 @@ int32_t ListLayoutAlgorithm::LayoutALineBackward(LayoutWrapper* layoutWrapper,
         SetListItemGroupParam(wrapper, endPos, false, listLayoutProperty, false);
     }
     {
-        ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem:%d", currentIndex);
+        ACE_LAYOUT_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem:%d", currentIndex);
         wrapper->Measure(childLayoutConstraint_);
     }
     float mainLen = GetMainAxisSize(wrapper->GetGeometryNode()->GetMarginFrameSize(), axis_);
@@ -1490,7 +1490,8 @@ void ListLayoutAlgorithm::PostIdleTask(RefPtr<FrameNode> frameNode, const ListPr
     pattern->SetPredictLayoutParam(param);
     auto context = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(context);
-    context->AddPredictTask([weak = WeakClaim(RawPtr(frameNode))](int64_t deadline, bool canUseLongPredictTask) {
+    auto weak = WeakClaim(RawPtr(frameNode));
+    context->AddPredictTask([weak](int64_t deadline, bool canUseLongPredictTask) {
         ACE_SCOPED_TRACE("List predict");
         auto frameNode = weak.Upgrade();
         CHECK_NULL_VOID(frameNode);
@@ -1516,7 +1517,7 @@ void ListLayoutAlgorithm::PostIdleTask(RefPtr<FrameNode> frameNode, const ListPr
             ListLayoutAlgorithm::PostIdleTask(frameNode, param);
             pattern->SetPredictLayoutParam(param);
         }
-    });
+    }, PredictTaskPriority::HIGH, weak, "List predict");
 }
 
 float ListLayoutAlgorithm::GetStopOnScreenOffset(V2::ScrollSnapAlign scrollSnapAlign)
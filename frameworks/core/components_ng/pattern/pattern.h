@@ -68,6 +68,7 @@ private:
 // Pattern is the base class for different measure, layout and paint behavior.
 class Pattern : public virtual AceType {
     DECLARE_ACE_TYPE(Pattern, AceType);
+    ACE_POOLED_ALLOCATION();
 
 public:
     Pattern() = default;
@@ -227,6 +228,13 @@ public:
         return false;
     }
 
+    // Whether the layout algorithm only places children by its layout constraint and properties, keeps no state
+    // in the pattern, so that FrameNode can replay a cached result for a previously seen constraint.
+    virtual bool IsLayoutResultCacheable() const
+    {
+        return false;
+    }
+
     virtual bool IsRenderBoundary() const
     {
         return true;
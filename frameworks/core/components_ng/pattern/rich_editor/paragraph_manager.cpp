@@ -15,57 +15,50 @@
 
 #include "core/components_ng/pattern/rich_editor/paragraph_manager.h"
 
+#include <algorithm>
+
 #include "base/utils/utils.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 
 namespace OHOS::Ace::NG {
 float ParagraphManager::GetHeight() const
 {
-    float res = 0.0f;
-    for (auto&& info : paragraphs_) {
-        res += info.paragraph->GetHeight();
-    }
-    return res;
+    return tops_.back();
 }
 
 int32_t ParagraphManager::GetIndex(Offset offset) const
 {
     CHECK_NULL_RETURN(!paragraphs_.empty(), 0);
-    int idx = 0;
-    for (auto it = paragraphs_.begin(); it != paragraphs_.end(); ++it, ++idx) {
-        auto&& info = *it;
-        if (GreatNotEqual(offset.GetY(), info.paragraph->GetHeight())) {
-            if (idx == static_cast<int>(paragraphs_.size()) - 1) {
-                // in the last line
-                return info.end;
-            }
-            // get offset relative to each paragraph
-            offset.SetY(offset.GetY() - info.paragraph->GetHeight());
-        } else {
-            return info.paragraph->GetGlyphIndexByCoordinate(offset) + info.start;
-        }
+    // the first paragraph whose bottom is not above the offset
+    auto y = static_cast<float>(offset.GetY());
+    auto bottom = std::lower_bound(tops_.begin() + 1, tops_.end(), y,
+        [](float paragraphBottom, float y) { return GreatNotEqual(y, paragraphBottom); });
+    if (bottom == tops_.end()) {
+        // below the last line
+        return paragraphs_.back().end;
     }
-    return paragraphs_.back().paragraph->GetGlyphIndexByCoordinate(offset) + paragraphs_.back().start;
+    auto idx = std::distance(tops_.begin() + 1, bottom);
+    auto&& info = paragraphs_[idx];
+    // get offset relative to the paragraph
+    offset.SetY(offset.GetY() - tops_[idx]);
+    return info.paragraph->GetGlyphIndexByCoordinate(offset) + info.start;
 }
 
 std::vector<RectF> ParagraphManager::GetRects(int32_t start, int32_t end) const
 {
     std::vector<RectF> res;
-    float y = 0.0f;
-    for (auto&& info : paragraphs_) {
+    // paragraphs are sorted by range, skip those ending before |start|.
+    auto it = std::upper_bound(paragraphs_.begin(), paragraphs_.end(), start,
+        [](int32_t index, const ParagraphInfo& info) { return index < info.end; });
+    for (; it != paragraphs_.end() && it->start <= end; ++it) {
         std::vector<RectF> rects;
-        if (info.start > end) {
-            break;
-        }
-        if (info.end > start) {
-            auto relativeStart = (start < info.start) ? 0 : start - info.start;
-            info.paragraph->GetRectsForRange(relativeStart, end - info.start, rects);
-
-            for (auto&& rect : rects) {
-                rect.SetTop(rect.Top() + y);
-            }
-            res.insert(res.end(), rects.begin(), rects.end());
+        auto relativeStart = (start < it->start) ? 0 : start - it->start;
+        it->paragraph->GetRectsForRange(relativeStart, end - it->start, rects);
+        auto y = tops_[std::distance(paragraphs_.begin(), it)];
+        for (auto&& rect : rects) {
+            rect.SetTop(rect.Top() + y);
         }
-        y += info.paragraph->GetHeight();
+        res.insert(res.end(), rects.begin(), rects.end());
     }
     return res;
 }
@@ -73,42 +66,45 @@ std::vector<RectF> ParagraphManager::GetRects(int32_t start, int32_t end) const
 std::vector<RectF> ParagraphManager::GetPlaceholderRects() const
 {
     std::vector<RectF> res;
-    float y = 0.0f;
-    for (auto&& info : paragraphs_) {
+    for (size_t i = 0; i < paragraphs_.size(); ++i) {
         std::vector<RectF> rects;
-        info.paragraph->GetRectsForPlaceholders(rects);
+        paragraphs_[i].paragraph->GetRectsForPlaceholders(rects);
         for (auto& rect : rects) {
-            rect.SetTop(rect.Top() + y);
+            rect.SetTop(rect.Top() + tops_[i]);
         }
-        y += info.paragraph->GetHeight();
-
         res.insert(res.end(), rects.begin(), rects.end());
     }
     return res;
 }
 
-OffsetF ParagraphManager::ComputeCursorOffset(int32_t index, float& selectLineHeight, bool downStreamFirst) const
+int32_t ParagraphManager::FindParagraph(int32_t index, float& y) const
 {
-    CHECK_NULL_RETURN(!paragraphs_.empty(), {});
-    auto it = paragraphs_.begin();
-    float y = 0.0f;
-    while (it != paragraphs_.end()) {
-        if (index >= it->start && index < it->end) {
-            break;
-        }
-        y += it->paragraph->GetHeight();
-        ++it;
+    auto it = std::upper_bound(paragraphs_.begin(), paragraphs_.end(), index,
+        [](int32_t index, const ParagraphInfo& info) { return index < info.end; });
+    if (it != paragraphs_.end() && index >= it->start) {
+        auto idx = static_cast<int32_t>(std::distance(paragraphs_.begin(), it));
+        y = tops_[idx];
+        return idx;
     }
-
     if (index == paragraphs_.back().end) {
-        --it;
-        y -= it->paragraph->GetHeight();
+        // the end of the text belongs to the last paragraph
+        auto idx = static_cast<int32_t>(paragraphs_.size()) - 1;
+        y = tops_[idx];
+        return idx;
     }
+    y = tops_.back();
+    return -1;
+}
 
-    CHECK_NULL_RETURN(it != paragraphs_.end(), OffsetF(0.0f, y));
+OffsetF ParagraphManager::ComputeCursorOffset(int32_t index, float& selectLineHeight, bool downStreamFirst) const
+{
+    CHECK_NULL_RETURN(!paragraphs_.empty(), {});
+    float y = 0.0f;
+    auto idx = FindParagraph(index, y);
+    CHECK_NULL_RETURN(idx >= 0, OffsetF(0.0f, y));
 
-    int32_t relativeIndex = index - it->start;
-    auto&& paragraph = it->paragraph;
+    int32_t relativeIndex = index - paragraphs_[idx].start;
+    auto&& paragraph = paragraphs_[idx].paragraph;
     CaretMetricsF metrics;
     auto computeSuccess = false;
     if (downStreamFirst) {
@@ -128,25 +124,12 @@ OffsetF ParagraphManager::ComputeCursorInfoByClick(
     int32_t index, float& selectLineHeight, const OffsetF& lastTouchOffset) const
 {
     CHECK_NULL_RETURN(!paragraphs_.empty(), {});
-    auto it = paragraphs_.begin();
     float y = 0.0f;
-    while (it != paragraphs_.end()) {
-        if (index >= it->start && index < it->end) {
-            break;
-        }
-        y += it->paragraph->GetHeight();
-        ++it;
-    }
-
-    if (index == paragraphs_.back().end) {
-        --it;
-        y -= it->paragraph->GetHeight();
-    }
-
-    CHECK_NULL_RETURN(it != paragraphs_.end(), OffsetF(0.0f, y));
+    auto idx = FindParagraph(index, y);
+    CHECK_NULL_RETURN(idx >= 0, OffsetF(0.0f, y));
 
-    int32_t relativeIndex = index - it->start;
-    auto&& paragraph = it->paragraph;
+    int32_t relativeIndex = index - paragraphs_[idx].start;
+    auto&& paragraph = paragraphs_[idx].paragraph;
 
     CaretMetricsF caretCaretMetric;
     paragraph->CalcCaretMetricsByPosition(relativeIndex, caretCaretMetric, lastTouchOffset);
@@ -155,9 +138,74 @@ OffsetF ParagraphManager::ComputeCursorInfoByClick(
             static_cast<float>(caretCaretMetric.offset.GetY() + y) };
 }
 
+void ParagraphManager::AddParagraph(ParagraphInfo&& info)
+{
+    CHECK_NULL_VOID(info.paragraph);
+    tops_.emplace_back(tops_.back() + info.paragraph->GetHeight());
+    paragraphs_.emplace_back(std::move(info));
+}
+
 void ParagraphManager::Reset()
 {
     paragraphs_.clear();
+    tops_ = { 0.0f };
+    previousRecords_ = std::move(records_);
+    records_.clear();
+}
+
+RefPtr<Paragraph> ParagraphManager::FindRecord(const LayoutRecords& records, const LayoutKey& key, size_t hash)
+{
+    auto range = records.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.first == key) {
+            return it->second.second;
+        }
+    }
+    return nullptr;
+}
+
+RefPtr<Paragraph> ParagraphManager::GetReusableParagraph(const LayoutKey& key) const
+{
+    auto hash = key.Hash();
+    auto paragraph = FindRecord(previousRecords_, key, hash);
+    return paragraph ? paragraph : FindRecord(records_, key, hash);
+}
+
+void ParagraphManager::RecordParagraph(LayoutKey&& key, const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID(paragraph);
+    auto hash = key.Hash();
+    records_.emplace(hash, std::make_pair(std::move(key), paragraph));
+}
+
+void ParagraphManager::FinishLayout()
+{
+    previousRecords_.clear();
+}
+
+bool ParagraphManager::SpanLayoutKey::operator==(const SpanLayoutKey& other) const
+{
+    return content == other.content && needRemoveNewLine == other.needRemoveNewLine &&
+           selectedStart == other.selectedStart && selectedEnd == other.selectedEnd &&
+           ParagraphCacheKey::IsSameTextStyle(textStyle, other.textStyle);
+}
+
+bool ParagraphManager::LayoutKey::operator==(const LayoutKey& other) const
+{
+    return maxWidth == other.maxWidth && minWidth == other.minWidth && selfIdealWidth == other.selfIdealWidth &&
+           fontGeneration == other.fontGeneration && spans == other.spans && paragraphStyle == other.paragraphStyle &&
+           ParagraphCacheKey::IsSameTextStyle(textStyle, other.textStyle);
+}
+
+size_t ParagraphManager::LayoutKey::Hash() const
+{
+    // hash the contents, equal contents with another style are told apart by operator==.
+    size_t seed = std::hash<float> {}(maxWidth);
+    for (const auto& span : spans) {
+        HashCombine(seed, span.content);
+        HashCombine(seed, span.textStyle.GetFontSize().Value());
+    }
+    return seed;
 }
 
 std::string ParagraphManager::ParagraphInfo::ToString() const
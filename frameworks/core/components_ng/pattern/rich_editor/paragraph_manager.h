@@ -15,13 +15,19 @@
 
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_RICH_EDITOR_PARAGRAPH_MANAGER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_RICH_EDITOR_PARAGRAPH_MANAGER_H
-#include <list>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/geometry/offset.h"
 #include "base/memory/ace_type.h"
+#include "core/components/common/properties/text_style.h"
 #include "core/components_ng/render/paragraph.h"
 namespace OHOS::Ace::NG {
+// ParagraphManager keeps the paragraphs of a rich editor in text order, together with the y offset and the text
+// range of each one, so that hit tests and range queries find their paragraphs by binary search.
 class ParagraphManager : public virtual AceType {
     DECLARE_ACE_TYPE(ParagraphManager, AceType);
 
@@ -33,15 +39,43 @@ public:
 
         std::string ToString() const;
     };
+
+    // What a span contributes to its paragraph.
+    struct SpanLayoutKey {
+        std::string content;
+        TextStyle textStyle;
+        bool needRemoveNewLine = false;
+        int32_t selectedStart = -1;
+        int32_t selectedEnd = -1;
+
+        bool operator==(const SpanLayoutKey& other) const;
+    };
+
+    // Everything a paragraph of plain spans is built and laid out from. A paragraph whose key did not change since
+    // the previous layout is reused, so that an edit only shapes the paragraph it touches.
+    struct LayoutKey {
+        std::vector<SpanLayoutKey> spans;
+        TextStyle textStyle;
+        ParagraphStyle paragraphStyle;
+        float maxWidth = 0.0f;
+        float minWidth = 0.0f;
+        std::optional<float> selfIdealWidth;
+        uint32_t fontGeneration = 0;
+
+        bool operator==(const LayoutKey& other) const;
+        size_t Hash() const;
+    };
+
     std::optional<double> minParagraphFontSize = std::nullopt;
 
     int32_t GetIndex(Offset offset) const;
     float GetHeight() const;
 
-    const std::list<ParagraphInfo>& GetParagraphs() const
+    const std::vector<ParagraphInfo>& GetParagraphs() const
     {
         return paragraphs_;
     }
+    // Clears the paragraphs, those recorded by RecordParagraph stay reusable until the layout is finished.
     void Reset();
 
     std::vector<RectF> GetRects(int32_t start, int32_t end) const;
@@ -49,13 +83,27 @@ public:
     OffsetF ComputeCursorOffset(int32_t index, float& selectLineHeight, bool downStreamFirst = false) const;
     OffsetF ComputeCursorInfoByClick(int32_t index, float& selectLineHeight, const OffsetF& lastTouchOffset) const;
 
-    void AddParagraph(ParagraphInfo&& info)
-    {
-        paragraphs_.emplace_back(std::move(info));
-    }
+    // The paragraph must have been laid out, its height is recorded here.
+    void AddParagraph(ParagraphInfo&& info);
+
+    // Returns a paragraph of this or the previous layout built from |key|, nullptr if there is none.
+    RefPtr<Paragraph> GetReusableParagraph(const LayoutKey& key) const;
+    void RecordParagraph(LayoutKey&& key, const RefPtr<Paragraph>& paragraph);
+    // Releases the paragraphs of the previous layout which were not reused.
+    void FinishLayout();
 
 private:
-    std::list<ParagraphInfo> paragraphs_;
+    using LayoutRecords = std::unordered_multimap<size_t, std::pair<LayoutKey, RefPtr<Paragraph>>>;
+
+    // Returns the position of the paragraph containing |index| and its y offset, -1 if there is none.
+    int32_t FindParagraph(int32_t index, float& y) const;
+    static RefPtr<Paragraph> FindRecord(const LayoutRecords& records, const LayoutKey& key, size_t hash);
+
+    std::vector<ParagraphInfo> paragraphs_;
+    // tops_[i] is the y offset of paragraph i, the last element is the total height.
+    std::vector<float> tops_ = { 0.0f };
+    LayoutRecords records_;
+    LayoutRecords previousRecords_;
 };
 } // namespace OHOS::Ace::NG
 #endif
@@ -56,6 +56,7 @@ std::optional<SizeF> RichEditorLayoutAlgorithm::MeasureContent(
 {
     pManager_->Reset();
     if (spans_.empty()) {
+        pManager_->FinishLayout();
         auto pipeline = PipelineContext::GetCurrentContext();
         CHECK_NULL_RETURN(pipeline, std::nullopt);
         auto richEditorTheme = pipeline->GetTheme<RichEditorTheme>();
@@ -72,6 +73,7 @@ std::optional<SizeF> RichEditorLayoutAlgorithm::MeasureContent(
         // layout each paragraph
         SetSpans(group);
         SetParagraph(nullptr);
+        layoutKey_.reset();
         auto size = TextLayoutAlgorithm::MeasureContent(contentConstraint, layoutWrapper);
         if (size) {
             res.SetWidth(std::max(size->Width(), res.Width()));
@@ -88,6 +90,9 @@ std::optional<SizeF> RichEditorLayoutAlgorithm::MeasureContent(
         pManager_->AddParagraph({ .paragraph = paragraph,
             .start = firstSpan->position - StringUtils::ToWstring(firstSpan->content).length(),
             .end = (*group.rbegin())->position });
+        if (layoutKey_) {
+            pManager_->RecordParagraph(std::move(layoutKey_.value()), paragraph);
+        }
         std::for_each(group.begin(), group.end(), [&](RefPtr<SpanItem>& item) {
             auto imageSpanItem = AceType::DynamicCast<ImageSpanItem>(item);
             if (imageSpanItem && imageSpanItem->placeholderIndex >= 0) {
@@ -100,6 +105,7 @@ std::optional<SizeF> RichEditorLayoutAlgorithm::MeasureContent(
             }
         });
     }
+    pManager_->FinishLayout();
     if (!res.IsPositive()) {
         return std::nullopt;
     }
@@ -185,6 +191,64 @@ ParagraphStyle RichEditorLayoutAlgorithm::GetParagraphStyle(
     return style;
 }
 
+RefPtr<Paragraph> RichEditorLayoutAlgorithm::GetReusableParagraph(const TextStyle& textStyle,
+    const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+    LayoutWrapper* layoutWrapper)
+{
+    layoutKey_ = CreateLayoutKey(textStyle, layoutProperty, contentConstraint, layoutWrapper);
+    CHECK_NULL_RETURN(layoutKey_, nullptr);
+    auto paragraph = pManager_->GetReusableParagraph(layoutKey_.value());
+    CHECK_NULL_RETURN(paragraph, nullptr);
+    // span positions are updated while building, keep them in step with the text in front of the paragraph.
+    auto position = GetPreviousLength();
+    for (auto&& span : GetSpans()) {
+        position += static_cast<int32_t>(StringUtils::ToWstring(span->content).length());
+        span->position = position;
+    }
+    return paragraph;
+}
+
+std::optional<ParagraphManager::LayoutKey> RichEditorLayoutAlgorithm::CreateLayoutKey(const TextStyle& textStyle,
+    const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+    LayoutWrapper* layoutWrapper)
+{
+    CHECK_NULL_RETURN(layoutWrapper, std::nullopt);
+    auto frameNode = layoutWrapper->GetHostNode();
+    CHECK_NULL_RETURN(frameNode, std::nullopt);
+    auto pattern = frameNode->GetPattern<TextPattern>();
+    CHECK_NULL_RETURN(pattern, std::nullopt);
+    if (pattern->GetTextDetectEnable() && !pattern->GetAISpanMap().empty()) {
+        return std::nullopt;
+    }
+    auto pipeline = frameNode->GetContext();
+    CHECK_NULL_RETURN(pipeline, std::nullopt);
+    auto theme = pipeline->GetTheme<TextTheme>();
+    ParagraphManager::LayoutKey key;
+    for (auto&& span : GetSpans()) {
+        // image and placeholder spans are measured with their nodes, so their paragraphs are always rebuilt.
+        if (!span || AceType::TypeId(span) != SpanItem::TypeId() || !span->children.empty()) {
+            return std::nullopt;
+        }
+        ParagraphManager::SpanLayoutKey spanKey;
+        spanKey.content = span->content;
+        spanKey.needRemoveNewLine = span->needRemoveNewLine;
+#ifdef ENABLE_DRAG_FRAMEWORK
+        spanKey.selectedStart = span->selectedStart;
+        spanKey.selectedEnd = span->selectedEnd;
+#endif // ENABLE_DRAG_FRAMEWORK
+        spanKey.textStyle = CreateTextStyleUsingTheme(span->fontStyle, span->textLineStyle, theme);
+        spanKey.textStyle.SetHalfLeading(pipeline->GetHalfLeading());
+        key.spans.emplace_back(std::move(spanKey));
+    }
+    key.textStyle = textStyle;
+    key.paragraphStyle = GetParagraphStyle(textStyle, layoutProperty->GetContent().value_or(""));
+    key.maxWidth = contentConstraint.maxSize.Width();
+    key.minWidth = contentConstraint.minSize.Width();
+    key.selfIdealWidth = contentConstraint.selfIdealSize.Width();
+    key.fontGeneration = ParagraphCache::GetInstance().GetFontGeneration();
+    return key;
+}
+
 int32_t RichEditorLayoutAlgorithm::GetPreviousLength() const
 {
     auto&& paragraphs = pManager_->GetParagraphs();
@@ -51,6 +51,13 @@ private:
     void GetPlaceholderRects(std::vector<RectF>& rectF) override;
     int32_t GetPreviousLength() const override;
     ParagraphStyle GetParagraphStyle(const TextStyle& textStyle, const std::string& content) const override;
+    RefPtr<Paragraph> GetReusableParagraph(const TextStyle& textStyle,
+        const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+        LayoutWrapper* layoutWrapper) override;
+    // Returns nullopt if the paragraph of the current span group depends on more than its spans.
+    std::optional<ParagraphManager::LayoutKey> CreateLayoutKey(const TextStyle& textStyle,
+        const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+        LayoutWrapper* layoutWrapper);
 
     void ApplyIndent(const TextStyle& textStyle, double width) override
     { // do nothing
@@ -58,6 +65,8 @@ private:
 
     std::vector<std::list<RefPtr<SpanItem>>> spans_;
     ParagraphManager* pManager_;
+    // key of the span group being measured
+    std::optional<ParagraphManager::LayoutKey> layoutKey_;
     OffsetF parentGlobalOffset_;
     RectF richTextRect_;
 
@@ -235,7 +235,7 @@ public:
         return caretSpanIndex_;
     }
 
-    const std::list<ParagraphManager::ParagraphInfo>& GetParagraphs() const
+    const std::vector<ParagraphManager::ParagraphInfo>& GetParagraphs() const
     {
         return paragraphs_.GetParagraphs();
     }
@@ -44,6 +44,11 @@ public:
         return false;
     }
 
+    bool IsLayoutResultCacheable() const override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<StackPattern>();
+    }
+
     FocusPattern GetFocusPattern() const override
     {
         return { FocusType::SCOPE, true };
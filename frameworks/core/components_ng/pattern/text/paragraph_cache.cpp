@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/text/paragraph_cache.h"
+
+#include "base/log/log.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr size_t DEFAULT_BYTE_LIMIT = 4 * 1024 * 1024;
+constexpr size_t DEFAULT_COUNT_LIMIT = 2048;
+constexpr size_t SHARD_COUNT = 4;
+// rough memory of a shaped paragraph: glyphs, positions and clusters per character, plus line and run metrics.
+constexpr size_t BYTES_PER_CHARACTER = 64;
+constexpr size_t BYTES_PER_PARAGRAPH = 2048;
+constexpr double TRIM_RATIO = 0.5;
+constexpr int32_t MEMORY_LEVEL_MODERATE = 0;
+} // namespace
+
+bool ParagraphCacheKey::IsSameTextStyle(const TextStyle& lhs, const TextStyle& rhs)
+{
+    // fields not covered by TextStyle::operator== but still pushed into the paragraph.
+    return lhs == rhs && lhs.GetWhiteSpace() == rhs.GetWhiteSpace() &&
+           lhs.HasHeightOverride() == rhs.HasHeightOverride() && lhs.GetHalfLeading() == rhs.GetHalfLeading();
+}
+
+bool ParagraphCacheKey::operator==(const ParagraphCacheKey& other) const
+{
+    return content == other.content && fontCollection == other.fontCollection && dipScale == other.dipScale &&
+           fontScale == other.fontScale && logicScale == other.logicScale && maxWidth == other.maxWidth &&
+           minWidth == other.minWidth && selfIdealWidth == other.selfIdealWidth &&
+           paragraphStyle == other.paragraphStyle && IsSameTextStyle(textStyle, other.textStyle);
+}
+
+size_t ParagraphCacheKey::Hash() const
+{
+    // hash the fields labels differ in most, a collision is caught by operator== on lookup.
+    size_t seed = std::hash<std::string> {}(content);
+    HashCombine(seed, reinterpret_cast<uintptr_t>(fontCollection));
+    HashCombine(seed, maxWidth);
+    HashCombine(seed, minWidth);
+    HashCombine(seed, selfIdealWidth.value_or(-1.0f));
+    HashCombine(seed, paragraphStyle.fontSize);
+    HashCombine(seed, paragraphStyle.maxLines);
+    HashCombine(seed, static_cast<int32_t>(paragraphStyle.align));
+    HashCombine(seed, textStyle.GetFontSize().Value());
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontSize().Unit()));
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontWeight()));
+    HashCombine(seed, textStyle.GetTextColor().GetValue());
+    for (const auto& family : textStyle.GetFontFamilies()) {
+        HashCombine(seed, family);
+    }
+    HashCombine(seed, fontScale);
+    return seed;
+}
+
+ParagraphCache& ParagraphCache::GetInstance()
+{
+    static ParagraphCache instance;
+    return instance;
+}
+
+ParagraphCache::ParagraphCache() : cache_(DEFAULT_BYTE_LIMIT, DEFAULT_COUNT_LIMIT, SHARD_COUNT) {}
+
+RefPtr<Paragraph> ParagraphCache::Get(const ParagraphCacheKey& key)
+{
+    auto entry = cache_.Get(key.Hash());
+    if (!entry || !(entry->key == key)) {
+        return nullptr;
+    }
+    return entry->paragraph;
+}
+
+void ParagraphCache::Put(const ParagraphCacheKey& key, const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID(paragraph);
+    if (key.content.size() > MAX_CONTENT_LENGTH) {
+        return;
+    }
+    auto entry = std::make_shared<Entry>();
+    entry->key = key;
+    entry->paragraph = paragraph;
+    auto size = BYTES_PER_PARAGRAPH + key.content.size() * BYTES_PER_CHARACTER;
+    // a label colliding with a cached one replaces it, which only costs the other label a miss.
+    cache_.Put(key.Hash(), entry, size);
+}
+
+void ParagraphCache::Clear()
+{
+    cache_.Clear();
+}
+
+void ParagraphCache::OnFontChanged()
+{
+    ++fontGeneration_;
+    cache_.Clear();
+}
+
+void ParagraphCache::NotifyMemoryLevel(int32_t level)
+{
+    LOGI("paragraph cache trim on memory level %{public}d, %{public}s", level, GetMetrics().ToString().c_str());
+    if (level <= MEMORY_LEVEL_MODERATE) {
+        cache_.Trim(TRIM_RATIO);
+        return;
+    }
+    cache_.Clear();
+}
+
+void ParagraphCache::SetByteLimit(size_t byteLimit)
+{
+    cache_.SetByteLimit(byteLimit);
+}
+
+CacheMetrics ParagraphCache::GetMetrics() const
+{
+    return cache_.GetMetrics();
+}
+} // namespace OHOS::Ace::NG
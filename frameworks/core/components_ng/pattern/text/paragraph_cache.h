@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_PARAGRAPH_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_PARAGRAPH_CACHE_H
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base/memory/referenced.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "core/common/lru/gdsf_cache.h"
+#include "core/components/common/properties/text_style.h"
+#include "core/components_ng/render/paragraph.h"
+
+namespace OHOS::Ace::NG {
+// Everything a plain text paragraph is shaped and laid out from.
+struct ParagraphCacheKey {
+    std::string content;
+    TextStyle textStyle;
+    ParagraphStyle paragraphStyle;
+    const FontCollection* fontCollection = nullptr;
+    double dipScale = 1.0;
+    double fontScale = 1.0;
+    double logicScale = 1.0;
+    // widths of the layout constraint, the paragraph is laid out to fit them.
+    float maxWidth = 0.0f;
+    float minWidth = 0.0f;
+    std::optional<float> selfIdealWidth;
+
+    bool operator==(const ParagraphCacheKey& other) const;
+    size_t Hash() const;
+
+    // TextStyle::operator== leaves out fields that still change how the text is shaped.
+    static bool IsSameTextStyle(const TextStyle& lhs, const TextStyle& rhs);
+};
+
+// ParagraphCache shares built and laid out paragraphs among text nodes showing the same label, so that list items
+// repeating "Buy" or a timestamp are shaped once. A cached paragraph is shared and must not be laid out again.
+class ACE_EXPORT ParagraphCache final {
+public:
+    // only short labels are worth sharing, long text is rarely repeated.
+    static constexpr size_t MAX_CONTENT_LENGTH = 256;
+
+    static ParagraphCache& GetInstance();
+
+    // Returns nullptr on a miss.
+    RefPtr<Paragraph> Get(const ParagraphCacheKey& key);
+    void Put(const ParagraphCacheKey& key, const RefPtr<Paragraph>& paragraph);
+    void Clear();
+    // Drops the paragraphs shaped before a font was loaded or changed.
+    void OnFontChanged();
+    // Counts OnFontChanged, for paragraphs kept outside of the cache.
+    uint32_t GetFontGeneration() const
+    {
+        return fontGeneration_;
+    }
+    void NotifyMemoryLevel(int32_t level);
+    void SetByteLimit(size_t byteLimit);
+    CacheMetrics GetMetrics() const;
+
+private:
+    // keyed by ParagraphCacheKey::Hash, the full key is kept to tell colliding labels apart on a hit.
+    struct Entry {
+        ParagraphCacheKey key;
+        RefPtr<Paragraph> paragraph;
+    };
+
+    ParagraphCache();
+    ~ParagraphCache() = default;
+
+    GDSFCache<std::shared_ptr<const Entry>, size_t> cache_;
+    std::atomic<uint32_t> fontGeneration_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ParagraphCache);
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_PARAGRAPH_CACHE_H
@@ -22,6 +22,7 @@
 #include "core/components/common/layout/constants.h"
 #include "core/components/common/properties/text_style.h"
 #include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/text_pattern.h"
 #include "core/components_ng/pattern/text/text_styles.h"
 #include "core/components_ng/property/property.h"
@@ -249,6 +250,7 @@ void SpanItem::UpdateTextStyleForAISpan(
 void SpanItem::FontRegisterCallback(const RefPtr<FrameNode>& frameNode, const TextStyle& textStyle)
 {
     auto callback = [weakNode = WeakPtr<FrameNode>(frameNode)] {
+        ParagraphCache::GetInstance().OnFontChanged();
         auto frameNode = weakNode.Upgrade();
         CHECK_NULL_VOID(frameNode);
         frameNode->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
@@ -148,6 +148,8 @@ bool TextLayoutAlgorithm::AddPropertiesAndAnimations(TextStyle& textStyle,
 void TextLayoutAlgorithm::FontRegisterCallback(const RefPtr<FrameNode>& frameNode, const TextStyle& textStyle)
 {
     auto callback = [weakNode = WeakPtr<FrameNode>(frameNode)] {
+        // paragraphs shaped with the fallback font are stale once the custom font is loaded.
+        ParagraphCache::GetInstance().OnFontChanged();
         auto frameNode = weakNode.Upgrade();
         CHECK_NULL_VOID(frameNode);
         frameNode->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
@@ -538,6 +540,19 @@ std::list<RefPtr<SpanItem>>&& TextLayoutAlgorithm::GetSpanItemChildren()
 bool TextLayoutAlgorithm::BuildParagraph(TextStyle& textStyle, const RefPtr<TextLayoutProperty>& layoutProperty,
     const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline, LayoutWrapper* layoutWrapper)
 {
+    auto cacheKey = CreateParagraphCacheKey(textStyle, layoutProperty, contentConstraint, pipeline, layoutWrapper);
+    if (cacheKey) {
+        auto paragraph = ParagraphCache::GetInstance().Get(cacheKey.value());
+        if (paragraph) {
+            paragraph_ = paragraph;
+            return true;
+        }
+    }
+    auto reusableParagraph = GetReusableParagraph(textStyle, layoutProperty, contentConstraint, layoutWrapper);
+    if (reusableParagraph) {
+        paragraph_ = reusableParagraph;
+        return true;
+    }
     if (!textStyle.GetAdaptTextSize()) {
         if (!CreateParagraphAndLayout(
                 textStyle, layoutProperty->GetContent().value_or(""), contentConstraint, layoutWrapper)) {
@@ -560,9 +575,55 @@ bool TextLayoutAlgorithm::BuildParagraph(TextStyle& textStyle, const RefPtr<Text
             paragraph_->Layout(std::ceil(paragraphNewWidth));
         }
     }
+    if (cacheKey) {
+        ParagraphCache::GetInstance().Put(cacheKey.value(), paragraph_);
+    }
     return true;
 }
 
+std::optional<ParagraphCacheKey> TextLayoutAlgorithm::CreateParagraphCacheKey(const TextStyle& textStyle,
+    const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+    const RefPtr<PipelineContext>& pipeline, LayoutWrapper* layoutWrapper)
+{
+    // subclasses build their paragraphs differently, adaptive font sizes try several styles per measure.
+    if (AceType::TypeId(this) != TextLayoutAlgorithm::TypeId() || !spanItemChildren_.empty() ||
+        textStyle.GetAdaptTextSize() || IncludeImageSpan(layoutWrapper) ||
+        layoutProperty->GetHeightAdaptivePolicyValue(TextHeightAdaptivePolicy::MAX_LINES_FIRST) !=
+            TextHeightAdaptivePolicy::MAX_LINES_FIRST) {
+        return std::nullopt;
+    }
+    const auto& content = layoutProperty->GetContent();
+    if (content && content->size() > ParagraphCache::MAX_CONTENT_LENGTH) {
+        return std::nullopt;
+    }
+    auto fontCollection = FontCollection::Current();
+    CHECK_NULL_RETURN(fontCollection, std::nullopt);
+    auto frameNode = layoutWrapper->GetHostNode();
+    CHECK_NULL_RETURN(frameNode, std::nullopt);
+    auto pattern = frameNode->GetPattern<TextPattern>();
+    CHECK_NULL_RETURN(pattern, std::nullopt);
+    if (pattern->GetTextDetectEnable() && !pattern->GetAISpanMap().empty()) {
+        return std::nullopt;
+    }
+    // the style is only copied once the paragraph is known to be cacheable.
+    ParagraphCacheKey key;
+    key.content = content.value_or("");
+    // same as CreateParagraph
+    key.paragraphStyle = GetParagraphStyle(textStyle, key.content);
+    if (Container::GreatOrEqualAPIVersion(PlatformVersion::VERSION_ELEVEN)) {
+        key.paragraphStyle.fontSize = textStyle.GetFontSize().ConvertToPx();
+    }
+    key.textStyle = textStyle;
+    key.fontCollection = AceType::RawPtr(fontCollection);
+    key.dipScale = pipeline->GetDipScale();
+    key.fontScale = pipeline->GetFontScale();
+    key.logicScale = pipeline->GetLogicScale();
+    key.maxWidth = GetMaxMeasureSize(contentConstraint).Width();
+    key.minWidth = contentConstraint.minSize.Width();
+    key.selfIdealWidth = contentConstraint.selfIdealSize.Width();
+    return key;
+}
+
 bool TextLayoutAlgorithm::BuildParagraphAdaptUseMinFontSize(TextStyle& textStyle,
     const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
     const RefPtr<PipelineContext>& pipeline, LayoutWrapper* layoutWrapper)
@@ -24,6 +24,7 @@
 
 #include "core/components_ng/layout/box_layout_algorithm.h"
 #include "core/components_ng/layout/layout_wrapper.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/span_node.h"
 #include "core/components_ng/pattern/text/text_layout_property.h"
 #include "core/components_ng/pattern/text/text_styles.h"
@@ -91,6 +92,14 @@ protected:
 
     virtual void UpdateParagraphForAISpan(const TextStyle& textStyle, LayoutWrapper* layoutWrapper);
 
+    // Returns a paragraph laid out by an earlier measure from the same inputs, nullptr to build a new one.
+    virtual RefPtr<Paragraph> GetReusableParagraph(const TextStyle& textStyle,
+        const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+        LayoutWrapper* layoutWrapper)
+    {
+        return nullptr;
+    }
+
     virtual OffsetF GetContentOffset(LayoutWrapper* layoutWrapper);
 
 private:
@@ -111,6 +120,10 @@ private:
     bool BuildParagraph(TextStyle& textStyle, const RefPtr<TextLayoutProperty>& layoutProperty,
         const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline,
         LayoutWrapper* layoutWrapper);
+    // Returns nullopt when the paragraph depends on more than plain text and style and can not be shared.
+    std::optional<ParagraphCacheKey> CreateParagraphCacheKey(const TextStyle& textStyle,
+        const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
+        const RefPtr<PipelineContext>& pipeline, LayoutWrapper* layoutWrapper);
     bool BuildParagraphAdaptUseMinFontSize(TextStyle& textStyle, const RefPtr<TextLayoutProperty>& layoutProperty,
         const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline,
         LayoutWrapper* layoutWrapper);
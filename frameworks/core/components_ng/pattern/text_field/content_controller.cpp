@@ -41,17 +41,15 @@ std::string ContentController::PreprocessString(int32_t startIndex, int32_t endI
     auto textField = DynamicCast<TextFieldPattern>(pattern);
     CHECK_NULL_RETURN(textField, value);
     auto property = textField->GetLayoutProperty<TextFieldLayoutProperty>();
-    auto selectValue = GetSelectedValue(startIndex, endIndex);
     if (property->GetTextInputType().has_value() &&
         property->GetTextInputType().value() == TextInputType::EMAIL_ADDRESS &&
-        content_.find('@') != std::string::npos && value.find('@') != std::string::npos &&
+        GetTextValue().find('@') != std::string::npos && value.find('@') != std::string::npos &&
         GetSelectedValue(startIndex, endIndex).find('@') == std::string::npos) {
         tmp.erase(std::remove_if(tmp.begin(), tmp.end(), [](char c) { return c == '@'; }), tmp.end());
     }
-    auto wideText = GetWideText();
     auto wideTmp = StringUtils::ToWstring(tmp);
     auto maxLength = static_cast<uint32_t>(textField->GetMaxLength());
-    auto curLength = static_cast<uint32_t>(wideText.length());
+    auto curLength = static_cast<uint32_t>(content_.Length());
     auto addLength = static_cast<uint32_t>(wideTmp.length());
     auto delLength = static_cast<uint32_t>(std::abs(endIndex - startIndex));
     addLength = std::min(addLength, maxLength - curLength + delLength);
@@ -68,26 +66,58 @@ void ContentController::ReplaceSelectedValue(int32_t startIndex, int32_t endInde
 {
     FormatIndex(startIndex, endIndex);
     auto tmp = PreprocessString(startIndex, endIndex, value);
-    auto wideText = GetWideText();
-    content_ = StringUtils::ToString(wideText.substr(0, startIndex)) + tmp +
-               StringUtils::ToString(wideText.substr(endIndex, static_cast<int32_t>(wideText.length()) - endIndex));
+    content_.Replace(startIndex, endIndex, StringUtils::ToWstring(tmp));
+    OnContentChanged();
     FilterValue();
 }
 
 std::string ContentController::GetSelectedValue(int32_t startIndex, int32_t endIndex)
 {
     FormatIndex(startIndex, endIndex);
-    auto wideText = GetWideText();
-    return StringUtils::ToString(wideText.substr(startIndex, endIndex - startIndex));
+    return StringUtils::ToString(content_.Substr(startIndex, endIndex - startIndex));
 }
 
 void ContentController::FormatIndex(int32_t& startIndex, int32_t& endIndex)
 {
     startIndex = std::min(startIndex, endIndex);
     endIndex = std::max(startIndex, endIndex);
-    auto wideText = GetWideText();
-    startIndex = std::clamp(startIndex, 0, static_cast<int32_t>(wideText.length()));
-    endIndex = std::clamp(endIndex, 0, static_cast<int32_t>(wideText.length()));
+    auto length = static_cast<int32_t>(content_.Length());
+    startIndex = std::clamp(startIndex, 0, length);
+    endIndex = std::clamp(endIndex, 0, length);
+}
+
+void ContentController::UpdateTextValue(std::string&& value)
+{
+    wideText_ = StringUtils::ToWstring(value);
+    content_ = TextRope(wideText_);
+    textValue_ = std::move(value);
+    wideTextValid_ = true;
+    textValueValid_ = true;
+}
+
+bool ContentController::NeedFilterTextInputStyle()
+{
+    auto pattern = pattern_.Upgrade();
+    CHECK_NULL_RETURN(pattern, false);
+    auto textField = DynamicCast<TextFieldPattern>(pattern);
+    CHECK_NULL_RETURN(textField, false);
+    auto property = textField->GetLayoutProperty<TextFieldLayoutProperty>();
+    if (!property->GetTextInputType().has_value()) {
+        return false;
+    }
+    switch (property->GetTextInputType().value()) {
+        case TextInputType::NUMBER:
+        case TextInputType::PHONE:
+        case TextInputType::EMAIL_ADDRESS:
+        case TextInputType::URL:
+        case TextInputType::VISIBLE_PASSWORD:
+        case TextInputType::NEW_PASSWORD:
+        case TextInputType::NUMBER_PASSWORD:
+        case TextInputType::SCREEN_LOCK_PASSWORD:
+            return true;
+        default:
+            return false;
+    }
 }
 
 void ContentController::FilterTextInputStyle(bool& textChanged, std::string& result)
@@ -139,25 +169,30 @@ void ContentController::FilterTextInputStyle(bool& textChanged, std::string& res
 
 void ContentController::FilterValue()
 {
-    bool textChanged = false;
-    auto result = content_;
     auto pattern = pattern_.Upgrade();
     CHECK_NULL_VOID(pattern);
     auto textField = DynamicCast<TextFieldPattern>(pattern);
     CHECK_NULL_VOID(textField);
     auto property = textField->GetLayoutProperty<TextFieldLayoutProperty>();
-    if (property->GetInputFilter().has_value() && !content_.empty()) {
-        textChanged |= FilterWithEvent(property->GetInputFilter().value(), result);
-    }
-    FilterTextInputStyle(textChanged, result);
-    if (textChanged) {
-        content_ = result;
+    auto hasInputFilter = property->GetInputFilter().has_value() && !IsEmpty();
+    // filters work on the whole text, only flatten it when there is one to apply.
+    if (hasInputFilter || NeedFilterTextInputStyle()) {
+        bool textChanged = false;
+        auto result = GetTextValue();
+        if (hasInputFilter) {
+            textChanged |= FilterWithEvent(property->GetInputFilter().value(), result);
+        }
+        FilterTextInputStyle(textChanged, result);
+        if (textChanged) {
+            UpdateTextValue(std::move(result));
+        }
     }
     auto maxLength =
         property->HasMaxLength() ? property->GetMaxLengthValue(Infinity<uint32_t>()) : Infinity<uint32_t>();
-    auto textWidth = static_cast<int32_t>(GetWideText().length());
+    auto textWidth = static_cast<int32_t>(content_.Length());
     if (GreatNotEqual(textWidth, maxLength)) {
-        content_ = StringUtils::ToString(GetWideText().substr(0, maxLength));
+        content_.Erase(maxLength, content_.Length() - maxLength);
+        OnContentChanged();
     }
 }
 
@@ -261,18 +296,18 @@ bool ContentController::FilterWithEvent(const std::string& filter, std::string&
 
 void ContentController::erase(int32_t startIndex, int32_t length)
 {
-    auto wideText = GetWideText().erase(startIndex, length);
-    content_ = StringUtils::ToString(wideText);
+    content_.Erase(startIndex, length);
+    OnContentChanged();
 }
 
 std::string ContentController::GetValueBeforeIndex(int32_t index)
 {
-    return StringUtils::ToString(GetWideText().substr(0, index));
+    return StringUtils::ToString(content_.Substr(0, index));
 }
 
 std::string ContentController::GetValueAfterIndex(int32_t index)
 {
-    return StringUtils::ToString(GetWideText().substr(index, GetWideText().length() - index));
+    return StringUtils::ToString(content_.Substr(index, content_.Length()));
 }
 
 std::string ContentController::GetSelectedLimitValue(int32_t& index, int32_t& startIndex)
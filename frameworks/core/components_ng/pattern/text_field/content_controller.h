@@ -24,6 +24,7 @@
 #include "base/utils/string_utils.h"
 #include "core/common/ime/text_input_type.h"
 #include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/pattern/text_field/text_rope.h"
 
 namespace OHOS::Ace::NG {
 class ContentController : public virtual AceType {
@@ -41,45 +42,79 @@ public:
     void FilterValue();
     std::string GetSelectedLimitValue(int32_t& index, int32_t& startIndex);
 
-    std::wstring GetWideText()
+    // The flat strings are built on first use after an edit and kept until the next one.
+    const std::wstring& GetWideText()
     {
-        return StringUtils::ToWstring(content_);
+        if (!wideTextValid_) {
+            wideText_ = content_.ToWstring();
+            wideTextValid_ = true;
+        }
+        return wideText_;
     }
 
-    std::string GetTextValue()
+    size_t GetWideTextLength() const
     {
-        return content_;
+        return content_.Length();
+    }
+
+    const std::string& GetTextValue()
+    {
+        if (!textValueValid_) {
+            textValue_ = StringUtils::ToString(GetWideText());
+            textValueValid_ = true;
+        }
+        return textValue_;
     }
 
-    bool IsEmpty()
+    bool IsEmpty() const
     {
-        return content_.empty();
+        return content_.Empty();
     }
 
     void SetTextValue(std::string&& value)
     {
-        content_ = value;
+        UpdateTextValue(std::move(value));
         FilterValue();
     }
 
     void SetTextValue(const std::string& value)
     {
-        content_ = value;
+        UpdateTextValue(std::string(value));
         FilterValue();
     }
 
     void SetTextValueOnly(std::string&& value)
     {
-        content_ = value;
+        UpdateTextValue(std::move(value));
+    }
+
+    // Undo records keep the rope itself, which shares its storage with the content instead of copying the text.
+    const TextRope& GetSnapshot() const
+    {
+        return content_;
+    }
+
+    void RestoreSnapshot(const TextRope& snapshot)
+    {
+        content_ = snapshot;
+        OnContentChanged();
+        FilterValue();
     }
 
     void Reset()
     {
-        content_ = "";
+        UpdateTextValue("");
     }
 
 private:
     void FormatIndex(int32_t& startIndex, int32_t& endIndex);
+    void UpdateTextValue(std::string&& value);
+    void OnContentChanged()
+    {
+        wideTextValid_ = false;
+        textValueValid_ = false;
+    }
+    bool NeedFilterTextInputStyle();
     void FilterTextInputStyle(bool& textChanged, std::string& result);
     bool FilterWithEvent(const std::string& filter, std::string& result);
     std::string PreprocessString(int32_t startIndex, int32_t endIndex, const std::string& value);
@@ -88,7 +123,11 @@ private:
     static bool FilterWithEmail(std::string& result);
     static bool FilterWithAscii(std::string& result);
 
-    std::string content_;
+    TextRope content_;
+    std::wstring wideText_;
+    std::string textValue_;
+    bool wideTextValid_ = true;
+    bool textValueValid_ = true;
     WeakPtr<Pattern> pattern_;
 };
 } // namespace OHOS::Ace::NG
@@ -828,7 +828,7 @@ void TextFieldPattern::HandleOnUndoAction()
         return;
     }
     auto textEditingValue = operationRecords_.back(); // record应该包含光标、select状态、文本
-    contentController_->SetTextValue(textEditingValue.text);
+    contentController_->RestoreSnapshot(textEditingValue.text);
     selectController_->UpdateCaretIndex(textEditingValue.caretPosition);
     auto layoutProperty = GetLayoutProperty<TextFieldLayoutProperty>();
     CHECK_NULL_VOID(layoutProperty);
@@ -843,7 +843,7 @@ void TextFieldPattern::HandleOnRedoAction()
         return;
     }
     auto textEditingValue = redoOperationRecords_.back();
-    contentController_->SetTextValue(textEditingValue.text);
+    contentController_->RestoreSnapshot(textEditingValue.text);
     selectController_->UpdateCaretIndex(textEditingValue.caretPosition);
     redoOperationRecords_.pop_back();
     operationRecords_.push_back(textEditingValue);
@@ -856,7 +856,7 @@ void TextFieldPattern::HandleOnRedoAction()
 
 void TextFieldPattern::HandleOnSelectAll(bool isKeyEvent, bool inlineStyle)
 {
-    auto textSize = static_cast<int32_t>(contentController_->GetWideText().length());
+    auto textSize = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (inlineStyle) {
         if (contentController_->GetWideText().rfind(L".") < textSize - FIND_TEXT_ZERO_INDEX) {
             textSize = contentController_->GetWideText().rfind(L".");
@@ -942,12 +942,12 @@ void TextFieldPattern::HandleOnPaste()
         }
         std::wstring pasteData = StringUtils::ToWstring(data);
         textfield->StripNextLine(pasteData);
-        auto originLength = static_cast<int32_t>(textfield->contentController_->GetWideText().length());
+        auto originLength = static_cast<int32_t>(textfield->contentController_->GetWideTextLength());
         textfield->contentController_->ReplaceSelectedValue(start, end, StringUtils::ToString(pasteData));
-        auto caretMoveLength = static_cast<int32_t>(textfield->contentController_->GetWideText().length()) -
+        auto caretMoveLength = static_cast<int32_t>(textfield->contentController_->GetWideTextLength()) -
                                originLength;
         auto newCaretPosition = std::clamp(std::max(start, end) + caretMoveLength, 0,
-            static_cast<int32_t>(textfield->contentController_->GetWideText().length()));
+            static_cast<int32_t>(textfield->contentController_->GetWideTextLength()));
         textfield->ResetObscureTickCountDown();
         textfield->selectController_->UpdateCaretIndex(newCaretPosition);
         textfield->UpdateEditingValueToRecord();
@@ -1061,8 +1061,8 @@ void TextFieldPattern::UpdateSelection(int32_t start, int32_t end)
 {
     auto startIndex = std::min(start, end);
     auto endIndex = std::max(start, end);
-    startIndex = std::clamp(startIndex, 0, static_cast<int32_t>(contentController_->GetWideText().length()));
-    endIndex = std::clamp(endIndex, 0, static_cast<int32_t>(contentController_->GetWideText().length()));
+    startIndex = std::clamp(startIndex, 0, static_cast<int32_t>(contentController_->GetWideTextLength()));
+    endIndex = std::clamp(endIndex, 0, static_cast<int32_t>(contentController_->GetWideTextLength()));
     if (startIndex != selectController_->GetStartIndex() || endIndex != selectController_->GetEndIndex()) {
         FireOnSelectionChange(startIndex, endIndex);
         selectController_->UpdateHandleIndex(startIndex, endIndex);
@@ -1748,7 +1748,7 @@ void TextFieldPattern::OnModifyDone()
         paintProperty->UpdateBackgroundColor(renderContext->GetBackgroundColorValue());
     }
 
-    auto textWidth = static_cast<int32_t>(contentController_->GetWideText().length());
+    auto textWidth = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (SelectOverlayIsOn()) {
         needToRefreshSelectOverlay_ = true;
         UpdateSelection(std::clamp(selectController_->GetStartIndex(), 0, textWidth),
@@ -2021,7 +2021,7 @@ void TextFieldPattern::HandleLongPress(GestureEvent& info)
 void TextFieldPattern::UpdateCaretPositionWithClamp(const int32_t& pos)
 {
     selectController_->UpdateCaretIndex(
-        std::clamp(pos, 0, static_cast<int32_t>(contentController_->GetWideText().length())));
+        std::clamp(pos, 0, static_cast<int32_t>(contentController_->GetWideTextLength())));
 }
 
 void TextFieldPattern::ProcessOverlay(bool isUpdateMenu, bool animation, bool isShowMenu, bool isHiddenHandle)
@@ -2285,7 +2285,7 @@ int32_t TextFieldPattern::UpdateCaretPositionOnHandleMove(const OffsetF& localOf
             position = std::min(static_cast<int32_t>(selectController_->GetEndIndex() +
                                                      GetGraphemeClusterLength(contentController_->GetWideText(),
                                                          selectController_->GetEndIndex())),
-                static_cast<int32_t>(contentController_->GetWideText().length()));
+                static_cast<int32_t>(contentController_->GetWideTextLength()));
         } else {
             Offset offset(localOffset.GetX() - textRect_.GetX(), 0.0f);
             position = ConvertTouchOffsetToCaretPosition(offset);
@@ -2813,13 +2813,13 @@ void TextFieldPattern::InsertValueOperation(const std::string& insertValue)
     }
     int32_t caretMoveLength = 0;
     if (IsSelected()) {
-        auto originLength = static_cast<int32_t>(contentController_->GetWideText().length()) - (end - start);
+        auto originLength = static_cast<int32_t>(contentController_->GetWideTextLength()) - (end - start);
         contentController_->ReplaceSelectedValue(start, end, insertValue);
-        caretMoveLength = abs(static_cast<int32_t>(contentController_->GetWideText().length()) - originLength);
+        caretMoveLength = abs(static_cast<int32_t>(contentController_->GetWideTextLength()) - originLength);
     } else {
-        auto originLength = static_cast<int32_t>(contentController_->GetWideText().length());
+        auto originLength = static_cast<int32_t>(contentController_->GetWideTextLength());
         contentController_->InsertValue(selectController_->GetCaretIndex(), insertValue);
-        caretMoveLength = abs(static_cast<int32_t>(contentController_->GetWideText().length()) - originLength);
+        caretMoveLength = abs(static_cast<int32_t>(contentController_->GetWideTextLength()) - originLength);
     }
     auto wideInsertValue = StringUtils::ToWstring(insertValue);
     selectController_->UpdateCaretIndex(caretStart + caretMoveLength);
@@ -2855,7 +2855,7 @@ void TextFieldPattern::InsertValue(const std::string& insertValue)
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     auto maxlength = GetMaxLength();
-    auto originLength = static_cast<uint32_t>(contentController_->GetWideText().length());
+    auto originLength = static_cast<uint32_t>(contentController_->GetWideTextLength());
     auto pattern = host->GetPattern<TextFieldPattern>();
     CHECK_NULL_VOID(pattern);
     auto textFieldLayoutProperty = host->GetLayoutProperty<TextFieldLayoutProperty>();
@@ -2933,8 +2933,8 @@ void TextFieldPattern::UpdateEditingValueToRecord()
         }
         operationRecords_.erase(operationRecords_.begin());
     }
-    TextEditingValueNG record {
-        .text = contentController_->GetTextValue(),
+    TextEditingRecord record {
+        .text = contentController_->GetSnapshot(),
         .caretPosition = selectController_->GetCaretIndex(),
     };
     operationRecords_.emplace_back(record);
@@ -3004,7 +3004,7 @@ int32_t TextFieldPattern::GetWordLength(int32_t originCaretPosition, int32_t dir
     if (contentController_->IsEmpty()) {
         return 0;
     }
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (originCaretPosition < 0 || originCaretPosition > textLength) {
         return 0;
     }
@@ -3099,7 +3099,7 @@ int32_t TextFieldPattern::GetLineEndPosition(int32_t originCaretPosition, bool n
 
 bool TextFieldPattern::CharLineChanged(int32_t caretPosition)
 {
-    if (caretPosition < 0 || caretPosition > static_cast<int32_t>(contentController_->GetWideText().length())) {
+    if (caretPosition < 0 || caretPosition > static_cast<int32_t>(contentController_->GetWideTextLength())) {
         return true;
     }
     CaretMetricsF caretMetrics;
@@ -3133,7 +3133,7 @@ bool TextFieldPattern::CursorMoveLeftWord()
         return true;
     }
     int32_t originCaretPosition = selectController_->GetCaretIndex();
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     int32_t leftWordLength = GetWordLength(originCaretPosition, 0);
     if (leftWordLength < 0 || leftWordLength > textLength || selectController_->GetCaretIndex() - leftWordLength < 0) {
         return false;
@@ -3153,7 +3153,7 @@ bool TextFieldPattern::CursorMoveLineBegin()
     if (selectController_->GetCaretIndex() == 0) {
         return true;
     }
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     int32_t originCaretPosition = selectController_->GetCaretIndex();
     int32_t lineBeginPosition = GetLineBeginPosition(originCaretPosition);
     if (lineBeginPosition < 0 || lineBeginPosition > textLength) {
@@ -3213,11 +3213,11 @@ bool TextFieldPattern::CursorMoveRight()
 
 bool TextFieldPattern::CursorMoveRightWord()
 {
-    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideText().length())) {
+    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideTextLength())) {
         return true;
     }
     int32_t originCaretPosition = selectController_->GetCaretIndex();
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     int32_t rightWordLength = GetWordLength(originCaretPosition, 1);
     if (rightWordLength < 0 || rightWordLength > textLength ||
         rightWordLength + selectController_->GetCaretIndex() > textLength) {
@@ -3234,11 +3234,11 @@ bool TextFieldPattern::CursorMoveRightWord()
 
 bool TextFieldPattern::CursorMoveLineEnd()
 {
-    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideText().length())) {
+    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideTextLength())) {
         return true;
     }
     int32_t originCaretPosition = selectController_->GetCaretIndex();
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     int32_t lineEndPosition = GetLineEndPosition(originCaretPosition);
     if (lineEndPosition < 0 || lineEndPosition > textLength) {
         return false;
@@ -3256,7 +3256,7 @@ bool TextFieldPattern::CursorMoveLineEnd()
 
 bool TextFieldPattern::CursorMoveToParagraphEnd()
 {
-    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideText().length())) {
+    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideTextLength())) {
         return true;
     }
     auto originCaretPosition = selectController_->GetCaretIndex();
@@ -3268,11 +3268,11 @@ bool TextFieldPattern::CursorMoveToParagraphEnd()
 bool TextFieldPattern::CursorMoveEnd()
 {
     // ctrl end, caret to the very end
-    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideText().length())) {
+    if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideTextLength())) {
         return true;
     }
     int32_t originCaretPosition = selectController_->GetCaretIndex();
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     UpdateCaretPositionWithClamp(textLength);
     OnCursorMoveDone();
     return originCaretPosition != selectController_->GetCaretIndex();
@@ -3349,7 +3349,7 @@ void TextFieldPattern::HandleCounterBorder()
     auto textFieldTheme = GetTheme();
     CHECK_NULL_VOID(textFieldTheme);
     auto maxLength = GetMaxLength();
-    auto currentLength = static_cast<uint32_t>(contentController_->GetWideText().length());
+    auto currentLength = static_cast<uint32_t>(contentController_->GetWideTextLength());
     BorderWidthProperty currentBorderWidth;
     if (layoutProperty->GetBorderWidthProperty() != nullptr) {
         currentBorderWidth = *(layoutProperty->GetBorderWidthProperty());
@@ -3615,7 +3615,7 @@ void TextFieldPattern::DeleteForward(int32_t length)
         Delete(selectController_->GetStartIndex(), selectController_->GetEndIndex());
         return;
     }
-    if (selectController_->GetCaretIndex() >= static_cast<int32_t>(contentController_->GetWideText().length())) {
+    if (selectController_->GetCaretIndex() >= static_cast<int32_t>(contentController_->GetWideTextLength())) {
         return;
     }
     deleteForwardOperations_.emplace(length);
@@ -3719,7 +3719,7 @@ void TextFieldPattern::HandleSelectionLeftWord()
     if (selectController_->GetCaretIndex() == 0) {
         return;
     }
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     int32_t leftWordLength = GetWordLength(selectController_->GetCaretIndex(), 0);
     if (leftWordLength < 0 || leftWordLength > textLength || selectController_->GetCaretIndex() - leftWordLength < 0) {
         return;
@@ -3738,7 +3738,7 @@ void TextFieldPattern::HandleSelectionLineBegin()
     if (selectController_->GetCaretIndex()) {
         return;
     }
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     int32_t lineBeginPosition = GetLineBeginPosition(selectController_->GetCaretIndex());
     if (lineBeginPosition < 0 || lineBeginPosition > textLength) {
         return;
@@ -3770,7 +3770,7 @@ void TextFieldPattern::HandleSelectionRight()
 {
     // if currently not in select mode, reset baseOffset and move destinationOffset and caret position
     if (!IsSelected()) {
-        if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideText().length())) {
+        if (selectController_->GetCaretIndex() == static_cast<int32_t>(contentController_->GetWideTextLength())) {
             return;
         }
         UpdateSelection(selectController_->GetCaretIndex());
@@ -3788,7 +3788,7 @@ void TextFieldPattern::HandleSelectionRight()
 
 void TextFieldPattern::HandleSelectionRightWord()
 {
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (selectController_->GetCaretIndex() == textLength) {
         return;
     }
@@ -3808,7 +3808,7 @@ void TextFieldPattern::HandleSelectionRightWord()
 
 void TextFieldPattern::HandleSelectionLineEnd()
 {
-    int32_t textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (selectController_->GetCaretIndex() == textLength) {
         return;
     }
@@ -3828,7 +3828,7 @@ void TextFieldPattern::HandleSelectionLineEnd()
 void TextFieldPattern::HandleSelectionEnd()
 {
     // shift end, select to the end of current line
-    int32_t endPos = static_cast<int32_t>(contentController_->GetWideText().length());
+    int32_t endPos = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (selectController_->GetCaretIndex() == endPos) {
         return;
     }
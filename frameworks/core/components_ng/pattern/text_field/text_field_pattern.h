@@ -58,6 +58,7 @@
 #include "core/components_ng/pattern/text_field/text_field_paint_method.h"
 #include "core/components_ng/pattern/text_field/text_field_paint_property.h"
 #include "core/components_ng/pattern/text_field/text_input_response_area.h"
+#include "core/components_ng/pattern/text_field/text_rope.h"
 #include "core/components_ng/pattern/text_field/text_select_controller.h"
 #include "core/components_ng/pattern/text_field/text_selector.h"
 #include "core/components_ng/pattern/text_input/text_input_layout_algorithm.h"
@@ -122,6 +123,12 @@ struct PreInlineState {
     bool hasBorderColor = false;
 };
 
+// An undo or redo step, the text shares its storage with the content it was recorded from.
+struct TextEditingRecord {
+    TextRope text;
+    int32_t caretPosition = 0;
+};
+
 struct ShowSelectOverlayParams {
     std::optional<RectF> firstHandle;
     std::optional<RectF> secondHandle;
@@ -807,7 +814,7 @@ public:
     bool IsSelectAll()
     {
         return abs(selectController_->GetStartIndex() - selectController_->GetEndIndex()) >=
-               static_cast<int32_t>(contentController_->GetWideText().length());
+               static_cast<int32_t>(contentController_->GetWideTextLength());
     }
 
     void StopEditing();
@@ -997,7 +1004,7 @@ public:
 
     int32_t GetContentWideTextLength()
     {
-        return static_cast<int32_t>(contentController_->GetWideText().length());
+        return static_cast<int32_t>(contentController_->GetWideTextLength());
     }
 
     void ShowMenu();
@@ -1257,8 +1264,8 @@ private:
     DragStatus dragStatus_ = DragStatus::NONE; // The status of the dragged initiator
     std::vector<std::string> dragContents_;
     RefPtr<Clipboard> clipboard_;
-    std::vector<TextEditingValueNG> operationRecords_;
-    std::vector<TextEditingValueNG> redoOperationRecords_;
+    std::vector<TextEditingRecord> operationRecords_;
+    std::vector<TextEditingRecord> redoOperationRecords_;
     std::vector<MenuOptionsParam> menuOptionItems_;
     BorderRadiusProperty borderRadius_;
     PasswordModeStyle passwordModeStyle_;
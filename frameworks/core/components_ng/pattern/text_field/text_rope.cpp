@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/text_field/text_rope.h"
+
+#include <algorithm>
+
+namespace OHOS::Ace::NG {
+TextRope::TextRope(const std::wstring& text) : root_(Build(text, 0, text.length())) {}
+
+void TextRope::Insert(size_t index, const std::wstring& text)
+{
+    if (text.empty()) {
+        return;
+    }
+    index = std::min(index, Length());
+    // typing lands in one leaf most of the time, which is copied instead of splitting the tree.
+    auto leafLength = GetLeafLength(root_, index, 0);
+    if (leafLength > 0 && leafLength + text.length() <= MAX_LEAF_LENGTH) {
+        root_ = InsertInLeaf(root_, index, text);
+        return;
+    }
+    auto [left, right] = Split(root_, index);
+    root_ = Join(Join(left, Build(text, 0, text.length())), right);
+}
+
+void TextRope::Erase(size_t index, size_t length)
+{
+    index = std::min(index, Length());
+    length = std::min(length, Length() - index);
+    if (length == 0) {
+        return;
+    }
+    // keep the leaf if something is left of it.
+    if (GetLeafLength(root_, index, length) > length) {
+        root_ = EraseInLeaf(root_, index, length);
+        return;
+    }
+    auto [left, rest] = Split(root_, index);
+    auto right = Split(rest, length).second;
+    root_ = Join(left, right);
+}
+
+void TextRope::Replace(size_t start, size_t end, const std::wstring& text)
+{
+    start = std::min(start, Length());
+    end = std::clamp(end, start, Length());
+    Erase(start, end - start);
+    Insert(start, text);
+}
+
+std::wstring TextRope::Substr(size_t index, size_t length) const
+{
+    index = std::min(index, Length());
+    length = std::min(length, Length() - index);
+    std::wstring result;
+    result.reserve(length);
+    AppendTo(root_, index, length, result);
+    return result;
+}
+
+std::wstring TextRope::ToWstring() const
+{
+    return Substr(0, Length());
+}
+
+TextRope::NodePtr TextRope::MakeLeaf(std::wstring&& text)
+{
+    if (text.empty()) {
+        return nullptr;
+    }
+    auto node = std::make_shared<Node>();
+    node->length = text.length();
+    node->text = std::move(text);
+    return node;
+}
+
+TextRope::NodePtr TextRope::MakeNode(const NodePtr& left, const NodePtr& right)
+{
+    if (!left) {
+        return right;
+    }
+    if (!right) {
+        return left;
+    }
+    auto node = std::make_shared<Node>();
+    node->left = left;
+    node->right = right;
+    node->length = left->length + right->length;
+    node->height = std::max(left->height, right->height) + 1;
+    return node;
+}
+
+TextRope::NodePtr TextRope::Build(const std::wstring& text, size_t begin, size_t end)
+{
+    if (end - begin <= MAX_LEAF_LENGTH) {
+        return MakeLeaf(text.substr(begin, end - begin));
+    }
+    // halves differ by at most one character, so their heights differ by at most one.
+    auto middle = begin + (end - begin) / 2;
+    return MakeNode(Build(text, begin, middle), Build(text, middle, end));
+}
+
+TextRope::NodePtr TextRope::Join(const NodePtr& left, const NodePtr& right)
+{
+    if (!left) {
+        return right;
+    }
+    if (!right) {
+        return left;
+    }
+    if (left->IsLeaf() && right->IsLeaf() && left->length + right->length <= MAX_LEAF_LENGTH) {
+        return MakeLeaf(left->text + right->text);
+    }
+    if (left->height > right->height + 1) {
+        return Balance(left->left, Join(left->right, right));
+    }
+    if (right->height > left->height + 1) {
+        return Balance(Join(left, right->left), right->right);
+    }
+    return MakeNode(left, right);
+}
+
+TextRope::NodePtr TextRope::Balance(const NodePtr& left, const NodePtr& right)
+{
+    auto leftHeight = GetHeight(left);
+    auto rightHeight = GetHeight(right);
+    if (leftHeight > rightHeight + 1) {
+        if (GetHeight(left->left) >= GetHeight(left->right)) {
+            return MakeNode(left->left, MakeNode(left->right, right));
+        }
+        return MakeNode(MakeNode(left->left, left->right->left), MakeNode(left->right->right, right));
+    }
+    if (rightHeight > leftHeight + 1) {
+        if (GetHeight(right->right) >= GetHeight(right->left)) {
+            return MakeNode(MakeNode(left, right->left), right->right);
+        }
+        return MakeNode(MakeNode(left, right->left->left), MakeNode(right->left->right, right->right));
+    }
+    return MakeNode(left, right);
+}
+
+std::pair<TextRope::NodePtr, TextRope::NodePtr> TextRope::Split(const NodePtr& node, size_t index)
+{
+    if (!node || index == 0) {
+        return { nullptr, node };
+    }
+    if (index >= node->length) {
+        return { node, nullptr };
+    }
+    if (node->IsLeaf()) {
+        return { MakeLeaf(node->text.substr(0, index)), MakeLeaf(node->text.substr(index)) };
+    }
+    auto leftLength = node->left->length;
+    if (index <= leftLength) {
+        auto [left, right] = Split(node->left, index);
+        return { left, Join(right, node->right) };
+    }
+    auto [left, right] = Split(node->right, index - leftLength);
+    return { Join(node->left, left), right };
+}
+
+TextRope::NodePtr TextRope::InsertInLeaf(const NodePtr& node, size_t index, const std::wstring& text)
+{
+    if (node->IsLeaf()) {
+        auto leafText = node->text;
+        leafText.insert(index, text);
+        return MakeLeaf(std::move(leafText));
+    }
+    auto leftLength = node->left->length;
+    if (index <= leftLength) {
+        return MakeNode(InsertInLeaf(node->left, index, text), node->right);
+    }
+    return MakeNode(node->left, InsertInLeaf(node->right, index - leftLength, text));
+}
+
+TextRope::NodePtr TextRope::EraseInLeaf(const NodePtr& node, size_t index, size_t length)
+{
+    if (node->IsLeaf()) {
+        auto leafText = node->text;
+        leafText.erase(index, length);
+        return MakeLeaf(std::move(leafText));
+    }
+    auto leftLength = node->left->length;
+    if (index + length <= leftLength) {
+        return MakeNode(EraseInLeaf(node->left, index, length), node->right);
+    }
+    return MakeNode(node->left, EraseInLeaf(node->right, index - leftLength, length));
+}
+
+size_t TextRope::GetLeafLength(const NodePtr& node, size_t index, size_t length)
+{
+    auto current = node.get();
+    while (current && !current->IsLeaf()) {
+        auto leftLength = current->left->length;
+        if (index + length <= leftLength) {
+            current = current->left.get();
+        } else if (index >= leftLength) {
+            index -= leftLength;
+            current = current->right.get();
+        } else {
+            return 0;
+        }
+    }
+    return current ? current->length : 0;
+}
+
+void TextRope::AppendTo(const NodePtr& node, size_t index, size_t length, std::wstring& result)
+{
+    if (!node || length == 0) {
+        return;
+    }
+    if (node->IsLeaf()) {
+        result.append(node->text, index, length);
+        return;
+    }
+    auto leftLength = node->left->length;
+    if (index < leftLength) {
+        auto leftPart = std::min(length, leftLength - index);
+        AppendTo(node->left, index, leftPart, result);
+        AppendTo(node->right, 0, length - leftPart, result);
+        return;
+    }
+    AppendTo(node->right, index - leftLength, length, result);
+}
+} // namespace OHOS::Ace::NG
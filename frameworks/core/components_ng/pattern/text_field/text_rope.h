@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_ROPE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_ROPE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace OHOS::Ace::NG {
+// TextRope stores wide text in a balanced tree of short chunks, every node caching the length of its subtree, so
+// locating an index and editing cost O(log n) plus the size of the edit, whatever the length of the text.
+// Nodes are immutable and shared, copying a rope only copies its root, so undo records cost no more than the edit
+// that produced them. Indices are in units of the wide text, the same as StringUtils::ToWstring.
+class TextRope final {
+public:
+    static constexpr size_t MAX_LEAF_LENGTH = 512;
+
+    TextRope() = default;
+    explicit TextRope(const std::wstring& text);
+    ~TextRope() = default;
+
+    size_t Length() const
+    {
+        return root_ ? root_->length : 0;
+    }
+
+    bool Empty() const
+    {
+        return Length() == 0;
+    }
+
+    // Indices out of range are clamped to the text.
+    void Insert(size_t index, const std::wstring& text);
+    void Erase(size_t index, size_t length);
+    void Replace(size_t start, size_t end, const std::wstring& text);
+    std::wstring Substr(size_t index, size_t length) const;
+    std::wstring ToWstring() const;
+
+    void Clear()
+    {
+        root_.reset();
+    }
+
+    // Whether both ropes are copies of one another, without comparing the text.
+    bool IsSameStorage(const TextRope& other) const
+    {
+        return root_ == other.root_;
+    }
+
+private:
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    struct Node {
+        NodePtr left;
+        NodePtr right;
+        // only leaves hold text
+        std::wstring text;
+        size_t length = 0;
+        int32_t height = 0;
+
+        bool IsLeaf() const
+        {
+            return !left;
+        }
+    };
+
+    static int32_t GetHeight(const NodePtr& node)
+    {
+        return node ? node->height : -1;
+    }
+
+    static NodePtr MakeLeaf(std::wstring&& text);
+    static NodePtr MakeNode(const NodePtr& left, const NodePtr& right);
+    static NodePtr Build(const std::wstring& text, size_t begin, size_t end);
+    // Concatenates two balanced trees and keeps the result balanced, merging adjacent short leaves.
+    static NodePtr Join(const NodePtr& left, const NodePtr& right);
+    static NodePtr Balance(const NodePtr& left, const NodePtr& right);
+    static std::pair<NodePtr, NodePtr> Split(const NodePtr& node, size_t index);
+    // Edit the single leaf holding the range and copy the path to it, the shape of the tree does not change.
+    static NodePtr InsertInLeaf(const NodePtr& node, size_t index, const std::wstring& text);
+    static NodePtr EraseInLeaf(const NodePtr& node, size_t index, size_t length);
+    // Length of the leaf an edit in [index, index + length] would land in, 0 if the range spans several leaves.
+    static size_t GetLeafLength(const NodePtr& node, size_t index, size_t length);
+    static void AppendTo(const NodePtr& node, size_t index, size_t length, std::wstring& result);
+
+    NodePtr root_;
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_ROPE_H
@@ -36,7 +36,7 @@ void TextSelectController::UpdateHandleIndex(int32_t firstHandleIndex, int32_t s
 
 void TextSelectController::UpdateCaretIndex(int32_t index)
 {
-    auto newIndex = std::clamp(index, 0, static_cast<int32_t>(contentController_->GetWideText().length()));
+    auto newIndex = std::clamp(index, 0, static_cast<int32_t>(contentController_->GetWideTextLength()));
     caretInfo_.index = newIndex;
     firstHandleInfo_.index = newIndex;
     secondHandleInfo_.index = newIndex;
@@ -163,13 +163,13 @@ void TextSelectController::UpdateSelectByOffset(const Offset& localOffset)
     bool smartSelect = AdjustWordSelection(pos, start, end, localOffset);
     if (!smartSelect && !paragraph_->GetWordBoundary(pos, start, end)) {
         start = pos;
-        end = std::min(static_cast<int32_t>(contentController_->GetWideText().length()),
+        end = std::min(static_cast<int32_t>(contentController_->GetWideTextLength()),
             pos + GetGraphemeClusterLength(contentController_->GetWideText(), pos, true));
     }
 
     UpdateHandleIndex(start, end);
     auto index = ConvertTouchOffsetToPosition(localOffset);
-    auto textLength = static_cast<int32_t>(contentController_->GetWideText().length());
+    auto textLength = static_cast<int32_t>(contentController_->GetWideTextLength());
     if (index == textLength && GreatNotEqual(localOffset.GetX(), caretInfo_.rect.GetOffset().GetX())) {
         UpdateHandleIndex(GetCaretIndex());
     }
@@ -320,7 +320,7 @@ void TextSelectController::MoveSecondHandleToContentRect(int32_t index)
 
 void TextSelectController::MoveCaretToContentRect(int32_t index, TextAffinity textAffinity)
 {
-    index = std::clamp(index, 0, static_cast<int32_t>(contentController_->GetWideText().length()));
+    index = std::clamp(index, 0, static_cast<int32_t>(contentController_->GetWideTextLength()));
     CaretMetricsF CaretMetrics;
     caretInfo_.index = index;
     firstHandleInfo_.index = index;
@@ -344,7 +344,7 @@ void TextSelectController::MoveCaretToContentRect(int32_t index, TextAffinity te
     float boundaryAdjustment = 0.0f;
     auto textRect = textFiled->GetTextRect();
     if (GreatNotEqual(textRect.Width(), contentRect_.Width()) && GreatNotEqual(contentRect_.Width(), 0.0) &&
-        caretInfo_.index < static_cast<int32_t>(contentController_->GetWideText().length())) {
+        caretInfo_.index < static_cast<int32_t>(contentController_->GetWideTextLength())) {
         boundaryAdjustment = paragraph_->GetCharacterWidth(caretInfo_.index);
     }
 
@@ -511,7 +511,7 @@ bool TextSelectController::AdjustWordSelection(
 
 bool TextSelectController::IsClickAtBoundary(int32_t index, const OHOS::Ace::Offset& touchOffset)
 {
-    if (InputAIChecker::IsSingleClickAtBoundary(index, contentController_->GetWideText().length())) {
+    if (InputAIChecker::IsSingleClickAtBoundary(index, contentController_->GetWideTextLength())) {
         return true;
     }
 
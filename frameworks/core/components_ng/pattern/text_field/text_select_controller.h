@@ -133,7 +133,7 @@ public:
     {
         return firstHandleInfo_.index == 0 && secondHandleInfo_.index >= 0 &&
                abs(firstHandleInfo_.index - secondHandleInfo_.index) ==
-                   static_cast<int32_t>(contentController_->GetWideText().length());
+                   static_cast<int32_t>(contentController_->GetWideTextLength());
     }
 
     void UpdateParagraph(const RefPtr<Paragraph>& paragraph)
@@ -173,7 +173,7 @@ public:
 
     bool CaretAtLast() const
     {
-        return caretInfo_.index == static_cast<int32_t>(contentController_->GetWideText().length());
+        return caretInfo_.index == static_cast<int32_t>(contentController_->GetWideTextLength());
     }
 
     void ResetHandles();
@@ -129,10 +129,23 @@ void WaterFlowLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
 
     InitialItemsCrossSize(layoutProperty, idealSize, layoutWrapper->GetTotalChildCount());
     mainSize_ = GetMainAxisSize(idealSize, axis);
+    if (layoutInfo_.jumpIndex_ < 0) {
+        // scrolled into the space kept for the items skipped by a jump with none of the items laid out shown, jumps
+        // to the one estimated at the offset.
+        layoutInfo_.jumpIndex_ = layoutInfo_.GetEstimatedItemByOffset(mainSize_, mainGap_);
+    }
     if (layoutInfo_.jumpIndex_ >= 0 && layoutInfo_.jumpIndex_ < layoutWrapper->GetTotalChildCount()) {
         auto crossIndex = layoutInfo_.GetCrossIndex(layoutInfo_.jumpIndex_);
         if (crossIndex == -1) {
-            // jump to out of cache
+            // jump to out of cache, FillViewport starts from the estimated position of the item and places it exactly.
+            if (layoutInfo_.EstimateItemsBefore(layoutInfo_.jumpIndex_, mainGap_)) {
+                layoutInfo_.currentOffset_ = -GetItemPosition(layoutInfo_.jumpIndex_).startMainPos;
+                auto startIndex = layoutInfo_.GetStartIndexByOffset(layoutInfo_.currentOffset_, layoutInfo_.jumpIndex_);
+                layoutInfo_.startIndex_ = startIndex == -1 ? layoutInfo_.jumpIndex_ : startIndex;
+            } else {
+                // the items after the estimated ones are dropped when jumping into them.
+                layoutInfo_.startIndex_ = std::min(layoutInfo_.startIndex_, layoutInfo_.jumpIndex_);
+            }
         } else {
             auto item = layoutInfo_.waterFlowItems_[crossIndex][layoutInfo_.jumpIndex_];
             // first line
@@ -288,11 +301,15 @@ FlowItemPosition WaterFlowLayoutAlgorithm::GetItemPosition(int32_t index)
     if (crossIndex != -1) {
         return { crossIndex, layoutInfo_.GetStartMainPos(crossIndex, index) };
     }
+    if (layoutInfo_.IsEstimatedItem(index)) {
+        // filling down from the items laid out before the estimated ones.
+        return layoutInfo_.GetFirstEstimatedItemPosition(mainGap_);
+    }
     auto itemIndex = layoutInfo_.GetCrossIndexForNextItem();
     if (itemIndex.lastItemIndex < 0) {
         return { itemIndex.crossIndex, 0.0f };
     }
-    auto mainHeight = layoutInfo_.GetMainHeight(itemIndex.crossIndex, itemIndex.lastItemIndex);
+    auto mainHeight = layoutInfo_.GetCrossEndPos(itemIndex.crossIndex);
     return { itemIndex.crossIndex, mainHeight + mainGap_ };
 }
 
@@ -309,6 +326,9 @@ void WaterFlowLayoutAlgorithm::FillViewport(float mainSize, LayoutWrapper* layou
 
     layoutInfo_.UpdateStartIndex();
     auto layoutProperty = AceType::DynamicCast<WaterFlowLayoutProperty>(layoutWrapper->GetLayoutProperty());
+    if (MeasureEstimatedItemsAbove(mainSize, layoutProperty, layoutWrapper)) {
+        layoutInfo_.UpdateStartIndex();
+    }
     auto currentIndex = layoutInfo_.startIndex_;
     auto position = GetItemPosition(currentIndex);
     while (LessNotEqual(position.startMainPos + layoutInfo_.currentOffset_, mainSize) || layoutInfo_.jumpIndex_ >= 0) {
@@ -320,7 +340,10 @@ void WaterFlowLayoutAlgorithm::FillViewport(float mainSize, LayoutWrapper* layou
         auto itemSize = itemWrapper->GetGeometryNode()->GetMarginFrameSize();
         auto itemHeight = GetMainAxisSize(itemSize, axis_);
         auto item = layoutInfo_.waterFlowItems_[position.crossIndex].find(currentIndex);
-        if (item == layoutInfo_.waterFlowItems_[position.crossIndex].end()) {
+        if (layoutInfo_.IsEstimatedItem(currentIndex)) {
+            // only its cross moves, placing the items of every cross again would move the items shown.
+            layoutInfo_.UpdateFirstEstimatedItem(position.crossIndex, itemHeight, mainGap_);
+        } else if (item == layoutInfo_.waterFlowItems_[position.crossIndex].end()) {
             layoutInfo_.waterFlowItems_[position.crossIndex][currentIndex] =
                 std::make_pair(position.startMainPos, itemHeight);
         } else {
@@ -351,6 +374,37 @@ void WaterFlowLayoutAlgorithm::FillViewport(float mainSize, LayoutWrapper* layou
     }
 }
 
+bool WaterFlowLayoutAlgorithm::MeasureEstimatedItemsAbove(
+    float mainSize, const RefPtr<WaterFlowLayoutProperty>& layoutProperty, LayoutWrapper* layoutWrapper)
+{
+    bool measured = false;
+    // from the bottom up, so that each item keeps its end above the items measured before it.
+    while (layoutInfo_.HasEstimatedItems()) {
+        auto crossIndex = layoutInfo_.GetCrossIndexForLastEstimatedItem();
+        if (crossIndex == -1) {
+            break;
+        }
+        auto endPos = layoutInfo_.estimatedCrossEnds_[crossIndex] + layoutInfo_.currentOffset_;
+        if (LessOrEqual(endPos, 0.0f)) {
+            break;
+        }
+        // shown from the top down, FillViewport measures them after the items laid out before.
+        if (GreatOrEqual(endPos, mainSize) && layoutInfo_.IsItemBeforeEstimatesShown()) {
+            break;
+        }
+        auto index = layoutInfo_.estimatedEndIndex_ - 1;
+        auto itemWrapper = layoutWrapper->GetOrCreateChildByIndex(GetChildIndexWithFooter(index));
+        if (!itemWrapper) {
+            break;
+        }
+        itemWrapper->Measure(CreateChildConstraint(crossIndex, layoutProperty, itemWrapper));
+        auto itemHeight = GetMainAxisSize(itemWrapper->GetGeometryNode()->GetMarginFrameSize(), axis_);
+        layoutInfo_.UpdateLastEstimatedItem(crossIndex, itemHeight, mainGap_);
+        measured = true;
+    }
+    return measured;
+}
+
 void WaterFlowLayoutAlgorithm::ModifyCurrentOffsetWhenReachEnd(float mainSize, LayoutWrapper* layoutWrapper)
 {
     auto maxItemHeight = layoutInfo_.GetMaxMainHeight();
@@ -25,17 +25,14 @@ class ACE_EXPORT WaterFlowLayoutAlgorithm : public LayoutAlgorithm {
     DECLARE_ACE_TYPE(WaterFlowLayoutAlgorithm, LayoutAlgorithm);
 
 public:
-    explicit WaterFlowLayoutAlgorithm(WaterFlowLayoutInfo layoutInfo) : layoutInfo_(std::move(layoutInfo)) {}
+    // lays out [layoutInfo] in place, it belongs to the pattern of the node laid out.
+    explicit WaterFlowLayoutAlgorithm(WaterFlowLayoutInfo& layoutInfo) : layoutInfo_(layoutInfo) {}
     ~WaterFlowLayoutAlgorithm() override = default;
 
     void Measure(LayoutWrapper* layoutWrapper) override;
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
-    WaterFlowLayoutInfo GetLayoutInfo()
-    {
-        return std::move(layoutInfo_);
-    }
     void SetCanOverScroll(bool canOverScroll)
     {
         canOverScroll_ = canOverScroll;
@@ -44,6 +41,10 @@ public:
 private:
     FlowItemPosition GetItemPosition(int32_t index);
     void FillViewport(float mainSize, LayoutWrapper* layoutWrapper);
+    // Measures the estimated items shown above the items laid out after them, when scrolling back after a jump.
+    // Returns false when there are none.
+    bool MeasureEstimatedItemsAbove(
+        float mainSize, const RefPtr<WaterFlowLayoutProperty>& layoutProperty, LayoutWrapper* layoutWrapper);
     void ModifyCurrentOffsetWhenReachEnd(float mainSize, LayoutWrapper* layoutWrapper);
     LayoutConstraintF CreateChildConstraint(int32_t crossIndex, const RefPtr<WaterFlowLayoutProperty>& layoutProperty,
         const RefPtr<LayoutWrapper>& childLayoutWrapper);
@@ -65,7 +66,7 @@ private:
     float mainSize_ = 0.0f;
     float footerMainSize_ = 0.0f;
     bool canOverScroll_ = false;
-    WaterFlowLayoutInfo layoutInfo_;
+    WaterFlowLayoutInfo& layoutInfo_;
 };
 } // namespace OHOS::Ace::NG
 #endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_WATERFLOW_WATER_FLOW_LAYOUT_ALGORITHM_H
@@ -16,6 +16,8 @@
 #include "core/components_ng/pattern/waterflow/water_flow_layout_info.h"
 
 #include <algorithm>
+#include <limits>
+#include <optional>
 
 namespace OHOS::Ace::NG {
 int32_t WaterFlowLayoutInfo::GetCrossIndex(int32_t itemIndex)
@@ -32,28 +34,45 @@ int32_t WaterFlowLayoutInfo::GetCrossIndex(int32_t itemIndex)
 void WaterFlowLayoutInfo::UpdateStartIndex()
 {
     auto nextPosition = GetCrossIndexForNextItem();
-    auto mainHeight = GetMainHeight(nextPosition.crossIndex, nextPosition.lastItemIndex);
+    auto mainHeight = GetCrossEndPos(nextPosition.crossIndex);
     // need more items for currentOffset_
     if (LessOrEqual(currentOffset_ + mainHeight, 0.0f)) {
         return;
     }
 
+    startIndex_ = GetStartIndexByOffset(currentOffset_, startIndex_);
+}
+
+int32_t WaterFlowLayoutInfo::GetStartIndexByOffset(float offset, int32_t nearIndex) const
+{
+    auto isShown = [offset](const std::pair<const int32_t, std::pair<float, float>>& item) {
+        auto itemEnd = item.second.first + item.second.second;
+        // FlowItem that have not been loaded at the beginning of each cross need to be selected as startIndex_ for
+        // the ClearCache later.
+        return GreatOrEqual(itemEnd + offset, 0.0f) || (NearZero(itemEnd) && NearZero(offset));
+    };
     int32_t tempStartIndex = -1;
     for (const auto& crossItems : waterFlowItems_) {
-        for (const auto& iter : crossItems.second) {
-            if (GreatOrEqual(iter.second.first + iter.second.second + currentOffset_, 0.0f)) {
-                tempStartIndex = tempStartIndex != -1 ? std::min(tempStartIndex, iter.first) : iter.first;
-                break;
-            }
-            // FlowItem that have not been loaded at the beginning of each cross need to be selected as startIndex_ for
-            // the ClearCache later.
-            if (NearZero(iter.second.first + iter.second.second) && NearZero(currentOffset_)) {
-                tempStartIndex = tempStartIndex != -1 ? std::min(tempStartIndex, iter.first) : iter.first;
-                break;
-            }
+        if (crossItems.second.empty()) {
+            continue;
+        }
+        // items of a cross are placed one after another, so whether they are shown only changes once. Search from
+        // [nearIndex] instead of the first item, scrolling only moves the start index by a few lines.
+        auto iter = crossItems.second.lower_bound(nearIndex);
+        if (iter == crossItems.second.end()) {
+            --iter;
+        }
+        while (iter != crossItems.second.begin() && isShown(*std::prev(iter))) {
+            --iter;
+        }
+        while (iter != crossItems.second.end() && !isShown(*iter)) {
+            ++iter;
+        }
+        if (iter != crossItems.second.end()) {
+            tempStartIndex = tempStartIndex != -1 ? std::min(tempStartIndex, iter->first) : iter->first;
         }
     }
-    startIndex_ = tempStartIndex;
+    return tempStartIndex;
 }
 
 int32_t WaterFlowLayoutInfo::GetEndIndexByOffset(float offset) const
@@ -76,11 +95,10 @@ float WaterFlowLayoutInfo::GetMaxMainHeight() const
 {
     float result = 0.0f;
     for (const auto& crossItems : waterFlowItems_) {
-        if (crossItems.second.empty()) {
+        auto [lastItemIndex, crossMainHeight] = GetLastItemOfCross(crossItems.first);
+        if (lastItemIndex < 0) {
             continue;
         }
-        auto lastItem = crossItems.second.rbegin();
-        auto crossMainHeight = lastItem->second.first + lastItem->second.second;
         if (NearEqual(result, 0.0f)) {
             result = crossMainHeight;
         }
@@ -121,16 +139,38 @@ float WaterFlowLayoutInfo::GetStartMainPos(int32_t crossIndex, int32_t itemIndex
     return result;
 }
 
+float WaterFlowLayoutInfo::GetCrossEndPos(int32_t crossIndex) const
+{
+    return GetLastItemOfCross(crossIndex).second;
+}
+
+std::pair<int32_t, float> WaterFlowLayoutInfo::GetLastItemOfCross(int32_t crossIndex) const
+{
+    std::pair<int32_t, float> lastItem = { -1, 0.0f };
+    auto cross = waterFlowItems_.find(crossIndex);
+    if (cross != waterFlowItems_.end() && !cross->second.empty()) {
+        auto item = cross->second.rbegin();
+        lastItem = { item->first, item->second.first + item->second.second };
+    }
+    if (!HasEstimatedItems() || lastItem.first >= estimatedEndIndex_ ||
+        crossIndex >= static_cast<int32_t>(estimatedCrossEnds_.size())) {
+        return lastItem;
+    }
+    if (GreatNotEqual(estimatedCrossEnds_[crossIndex], lastItem.second)) {
+        lastItem = { estimatedEndIndex_ - 1, estimatedCrossEnds_[crossIndex] };
+    }
+    return lastItem;
+}
+
 bool WaterFlowLayoutInfo::IsAllCrossReachend(float mainSize) const
 {
     bool result = true;
     for (const auto& crossItems : waterFlowItems_) {
-        if (crossItems.second.empty()) {
+        auto [lastItemIndex, lastOffset] = GetLastItemOfCross(crossItems.first);
+        if (lastItemIndex < 0) {
             result = false;
             break;
         }
-        auto lastItem = crossItems.second.rbegin();
-        auto lastOffset = lastItem->second.first + lastItem->second.second;
         if (LessNotEqual(lastOffset + currentOffset_, mainSize)) {
             result = false;
             break;
@@ -145,22 +185,20 @@ FlowItemIndex WaterFlowLayoutInfo::GetCrossIndexForNextItem() const
     auto minHeight = -1.0f;
     auto crossSize = static_cast<int32_t>(waterFlowItems_.size());
     for (int32_t i = 0; i < crossSize; ++i) {
-        const auto& crossItems = waterFlowItems_.at(i);
-        if (crossItems.empty()) {
+        auto [lastItemIndex, lastOffset] = GetLastItemOfCross(i);
+        if (lastItemIndex < 0) {
             position.crossIndex = i;
             position.lastItemIndex = -1;
             break;
         }
-        auto lastItem = crossItems.rbegin();
-        auto lastOffset = lastItem->second.first + lastItem->second.second;
         if (NearEqual(minHeight, -1.0f)) {
             minHeight = lastOffset;
             position.crossIndex = i;
-            position.lastItemIndex = lastItem->first;
+            position.lastItemIndex = lastItemIndex;
         }
         if (LessNotEqual(lastOffset, minHeight)) {
             position.crossIndex = i;
-            position.lastItemIndex = lastItem->first;
+            position.lastItemIndex = lastItemIndex;
             minHeight = lastOffset;
             // first item height in this cross is 0
             if (NearZero(minHeight)) {
@@ -183,6 +221,7 @@ void WaterFlowLayoutInfo::Reset()
     startIndex_ = 0;
     endIndex_ = 0;
     waterFlowItems_.clear();
+    ClearEstimatedItems();
 }
 
 void WaterFlowLayoutInfo::Reset(int32_t resetFrom)
@@ -201,14 +240,15 @@ int32_t WaterFlowLayoutInfo::GetCrossCount() const
 int32_t WaterFlowLayoutInfo::GetMainCount() const
 {
     int32_t maxMainCount = 0;
+    if (endIndex_ < startIndex_) {
+        return maxMainCount;
+    }
     for (const auto& crossItems : waterFlowItems_) {
         if (crossItems.second.empty()) {
             continue;
         }
-        auto mainCount = static_cast<int32_t>(std::count_if(crossItems.second.begin(), crossItems.second.end(),
-            [start = startIndex_, end = endIndex_](const std::pair<const int, std::pair<float, float>>& crossItem) {
-                return crossItem.first >= start && crossItem.first <= end;
-            }));
+        auto mainCount = static_cast<int32_t>(
+            std::distance(crossItems.second.lower_bound(startIndex_), crossItems.second.upper_bound(endIndex_)));
         maxMainCount = std::max(maxMainCount, mainCount);
     }
     return maxMainCount;
@@ -220,11 +260,266 @@ void WaterFlowLayoutInfo::ClearCacheAfterIndex(int32_t currentIndex)
         if (crossItems.second.empty()) {
             continue;
         }
-        auto clearFrom = std::find_if(crossItems.second.begin(), crossItems.second.end(),
-            [currentIndex](const std::pair<const int, std::pair<float, float>>& crossItem) {
-                return crossItem.first > currentIndex;
-            });
-        crossItems.second.erase(clearFrom, crossItems.second.end());
+        crossItems.second.erase(crossItems.second.upper_bound(currentIndex), crossItems.second.end());
+    }
+    // the items after the estimated ones are gone, the space kept for them is not needed anymore.
+    if (currentIndex < estimatedEndIndex_) {
+        ClearEstimatedItems();
+    }
+}
+
+void WaterFlowLayoutInfo::ClearEstimatedItems()
+{
+    estimatedStartIndex_ = -1;
+    estimatedEndIndex_ = -1;
+    estimatedHeight_ = 0.0f;
+    estimatedCrossEnds_.clear();
+}
+
+bool WaterFlowLayoutInfo::EstimateItemsBefore(int32_t itemIndex, float mainGap)
+{
+    if (HasEstimatedItems()) {
+        // a single run of items is estimated, the one estimated before grows up to [itemIndex].
+        ClearCacheAfterIndex(estimatedStartIndex_ - 1);
+    }
+    int32_t lastItemIndex = -1;
+    size_t itemCount = 0;
+    float heightSum = 0.0f;
+    // where the next item of each cross starts, the same as GetItemPosition.
+    std::vector<float> crossStartPos;
+    crossStartPos.reserve(waterFlowItems_.size());
+    for (const auto& crossItems : waterFlowItems_) {
+        if (crossItems.second.empty()) {
+            crossStartPos.emplace_back(0.0f);
+            continue;
+        }
+        auto lastItem = crossItems.second.rbegin();
+        lastItemIndex = std::max(lastItemIndex, lastItem->first);
+        crossStartPos.emplace_back(lastItem->second.first + lastItem->second.second + mainGap);
+        itemCount += crossItems.second.size();
+        for (const auto& item : crossItems.second) {
+            heightSum += item.second.second;
+        }
+    }
+    if (itemCount == 0 || itemIndex <= lastItemIndex + 1) {
+        return false;
+    }
+    estimatedStartIndex_ = lastItemIndex + 1;
+    estimatedEndIndex_ = itemIndex;
+    estimatedHeight_ = heightSum / static_cast<float>(itemCount);
+    auto itemMainSize = estimatedHeight_ + mainGap;
+    auto placeInShortestCross = [&crossStartPos, itemMainSize]() {
+        // the first cross when several are as short.
+        *std::min_element(crossStartPos.begin(), crossStartPos.end()) += itemMainSize;
+    };
+    // every item goes to the shortest cross. Once the crosses are within an item of each other they take turns,
+    // so whole turns are placed at once.
+    auto itemsLeft = estimatedEndIndex_ - estimatedStartIndex_;
+    while (itemsLeft > 0) {
+        auto [shortest, longest] = std::minmax_element(crossStartPos.begin(), crossStartPos.end());
+        if (!LessNotEqual(*shortest + itemMainSize, *longest)) {
+            break;
+        }
+        placeInShortestCross();
+        --itemsLeft;
+    }
+    auto crossCount = static_cast<int32_t>(crossStartPos.size());
+    auto turns = itemsLeft / crossCount;
+    for (auto& startPos : crossStartPos) {
+        startPos += static_cast<float>(turns) * itemMainSize;
+    }
+    for (itemsLeft -= turns * crossCount; itemsLeft > 0; --itemsLeft) {
+        placeInShortestCross();
+    }
+    estimatedCrossEnds_.clear();
+    for (auto startPos : crossStartPos) {
+        estimatedCrossEnds_.emplace_back(startPos - mainGap);
+    }
+    TAG_LOGD(AceLogTag::ACE_WATERFLOW, "estimate items from %{public}d to %{public}d, height %{public}f",
+        estimatedStartIndex_, estimatedEndIndex_ - 1, estimatedHeight_);
+    return true;
+}
+
+float WaterFlowLayoutInfo::GetEstimatedStartPos(
+    const std::map<int32_t, std::pair<float, float>>& crossItems, float mainGap) const
+{
+    auto item = crossItems.lower_bound(estimatedStartIndex_);
+    if (item == crossItems.begin()) {
+        return 0.0f;
+    }
+    --item;
+    return item->second.first + item->second.second + mainGap;
+}
+
+bool WaterFlowLayoutInfo::IsItemBeforeEstimatesShown() const
+{
+    for (const auto& crossItems : waterFlowItems_) {
+        auto item = crossItems.second.lower_bound(estimatedStartIndex_);
+        if (item == crossItems.second.begin()) {
+            continue;
+        }
+        --item;
+        if (GreatNotEqual(item->second.first + item->second.second + currentOffset_, 0.0f)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int32_t WaterFlowLayoutInfo::GetEstimatedItemByOffset(float mainSize, float mainGap) const
+{
+    if (!HasEstimatedItems() || IsItemBeforeEstimatesShown()) {
+        return -1;
+    }
+    bool inEstimates = false;
+    auto estimatedStartPos = std::numeric_limits<float>::max();
+    for (const auto& crossItems : waterFlowItems_) {
+        auto item = crossItems.second.lower_bound(estimatedEndIndex_);
+        if (item != crossItems.second.end() && LessNotEqual(item->second.first + currentOffset_, mainSize)) {
+            return -1;
+        }
+        auto crossIndex = static_cast<size_t>(crossItems.first);
+        if (crossIndex < estimatedCrossEnds_.size() &&
+            GreatNotEqual(estimatedCrossEnds_[crossIndex] + currentOffset_, 0.0f)) {
+            inEstimates = true;
+        }
+        estimatedStartPos = std::min(estimatedStartPos, GetEstimatedStartPos(crossItems.second, mainGap));
+    }
+    if (!inEstimates) {
+        return -1;
+    }
+    // the estimated items take turns in the crosses, a line of them for each item main size above the offset.
+    auto itemMainSize = estimatedHeight_ + mainGap;
+    auto lines = GreatNotEqual(itemMainSize, 0.0f)
+                     ? static_cast<int64_t>(std::max(-currentOffset_ - estimatedStartPos, 0.0f) / itemMainSize)
+                     : 0;
+    auto index = estimatedStartIndex_ + lines * GetCrossCount();
+    return static_cast<int32_t>(std::clamp<int64_t>(index, estimatedStartIndex_, estimatedEndIndex_ - 1));
+}
+
+FlowItemPosition WaterFlowLayoutInfo::GetFirstEstimatedItemPosition(float mainGap) const
+{
+    FlowItemPosition position = { -1, 0.0f };
+    for (const auto& crossItems : waterFlowItems_) {
+        auto startPos = GetEstimatedStartPos(crossItems.second, mainGap);
+        if (position.crossIndex == -1 || LessNotEqual(startPos, position.startMainPos)) {
+            position = { crossItems.first, startPos };
+        }
+    }
+    return position;
+}
+
+void WaterFlowLayoutInfo::UpdateFirstEstimatedItem(int32_t crossIndex, float itemHeight, float mainGap)
+{
+    if (!HasEstimatedItems() || crossIndex < 0 || crossIndex >= static_cast<int32_t>(estimatedCrossEnds_.size())) {
+        return;
+    }
+    auto& crossItems = waterFlowItems_[crossIndex];
+    auto startPos = GetEstimatedStartPos(crossItems, mainGap);
+    crossItems.emplace(estimatedStartIndex_, std::make_pair(startPos, itemHeight));
+    ++estimatedStartIndex_;
+    // the items after it in the cross are not shown while filling down to them, they make room for it.
+    auto overflow = startPos + itemHeight - estimatedCrossEnds_[crossIndex];
+    if (GreatNotEqual(overflow, 0.0f)) {
+        MoveItemsAfterEstimates(crossIndex, overflow);
+    }
+    if (!HasEstimatedItems()) {
+        MeetItemsBeforeEstimates(mainGap);
+    }
+}
+
+int32_t WaterFlowLayoutInfo::GetCrossIndexForLastEstimatedItem() const
+{
+    int32_t crossIndex = -1;
+    for (int32_t i = 0; i < static_cast<int32_t>(estimatedCrossEnds_.size()); ++i) {
+        // the last cross when several end as late, the opposite of the items laid out one after another.
+        if (crossIndex == -1 || GreatOrEqual(estimatedCrossEnds_[i], estimatedCrossEnds_[crossIndex])) {
+            crossIndex = i;
+        }
+    }
+    return crossIndex;
+}
+
+void WaterFlowLayoutInfo::UpdateLastEstimatedItem(int32_t crossIndex, float itemHeight, float mainGap)
+{
+    if (!HasEstimatedItems() || crossIndex < 0 || crossIndex >= static_cast<int32_t>(estimatedCrossEnds_.size())) {
+        return;
+    }
+    --estimatedEndIndex_;
+    auto startPos = estimatedCrossEnds_[crossIndex] - itemHeight;
+    waterFlowItems_[crossIndex].emplace(estimatedEndIndex_, std::make_pair(startPos, itemHeight));
+    estimatedCrossEnds_[crossIndex] = startPos - mainGap;
+    MoveItemsAfterEstimatesDown(crossIndex, mainGap);
+    if (!HasEstimatedItems()) {
+        MeetItemsBeforeEstimates(mainGap);
+    }
+}
+
+void WaterFlowLayoutInfo::MoveItemsAfterEstimates(int32_t crossIndex, float delta)
+{
+    if (NearZero(delta)) {
+        return;
+    }
+    auto& crossItems = waterFlowItems_[crossIndex];
+    for (auto item = crossItems.lower_bound(estimatedEndIndex_); item != crossItems.end(); ++item) {
+        item->second.first += delta;
+    }
+    estimatedCrossEnds_[crossIndex] += delta;
+}
+
+void WaterFlowLayoutInfo::MoveItemsAfterEstimatesDown(int32_t crossIndex, float mainGap)
+{
+    auto& crossItems = waterFlowItems_[crossIndex];
+    auto overlap = GetEstimatedStartPos(crossItems, mainGap) - (estimatedCrossEnds_[crossIndex] + mainGap);
+    if (!GreatNotEqual(overlap, 0.0f)) {
+        return;
+    }
+    if (IsItemBeforeEstimatesShown()) {
+        MoveItemsAfterEstimates(crossIndex, overlap);
+        return;
+    }
+    for (int32_t i = 0; i < static_cast<int32_t>(estimatedCrossEnds_.size()); ++i) {
+        MoveItemsAfterEstimates(i, overlap);
+    }
+    currentOffset_ -= overlap;
+}
+
+void WaterFlowLayoutInfo::MeetItemsBeforeEstimates(float mainGap)
+{
+    auto crossCount = static_cast<int32_t>(estimatedCrossEnds_.size());
+    // the space left in each cross, the crosses without items after the estimated ones end there.
+    std::vector<std::optional<float>> spaces(crossCount);
+    for (int32_t i = 0; i < crossCount; ++i) {
+        const auto& crossItems = waterFlowItems_[i];
+        auto item = crossItems.lower_bound(estimatedEndIndex_);
+        if (item != crossItems.end()) {
+            spaces[i] = item->second.first - GetEstimatedStartPos(crossItems, mainGap);
+        }
+    }
+    if (!IsItemBeforeEstimatesShown()) {
+        std::optional<float> minSpace;
+        for (const auto& space : spaces) {
+            if (space && (!minSpace || LessNotEqual(*space, *minSpace))) {
+                minSpace = space;
+            }
+        }
+        if (minSpace && !NearZero(*minSpace)) {
+            for (int32_t i = 0; i < crossCount; ++i) {
+                MoveItemsAfterEstimates(i, -*minSpace);
+                if (spaces[i]) {
+                    *spaces[i] -= *minSpace;
+                }
+            }
+            currentOffset_ += *minSpace;
+        }
+    }
+    // the rest is the error of the estimate in each cross, a cross shown snaps to its items before the estimated ones
+    // rather than keep a hole.
+    for (int32_t i = 0; i < crossCount; ++i) {
+        if (spaces[i] && !NearZero(*spaces[i])) {
+            MoveItemsAfterEstimates(i, -*spaces[i]);
+        }
     }
+    ClearEstimatedItems();
 }
-} // namespace OHOS::Ace::NG
\ No newline at end of file
+} // namespace OHOS::Ace::NG
@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <map>
 #include <sstream>
+#include <vector>
 
 #include "base/utils/utils.h"
 
@@ -37,17 +38,52 @@ class WaterFlowLayoutInfo {
 public:
     int32_t GetCrossIndex(int32_t itemIndex);
     void UpdateStartIndex();
+    // The first item shown at [offset], found by searching each cross from [nearIndex]. Returns -1 if none is shown.
+    int32_t GetStartIndexByOffset(float offset, int32_t nearIndex) const;
     int32_t GetEndIndexByOffset(float offset) const;
     float GetMaxMainHeight() const;
     bool IsAllCrossReachend(float mainSize) const;
     FlowItemIndex GetCrossIndexForNextItem() const;
     float GetMainHeight(int32_t crossIndex, int32_t itemIndex);
     float GetStartMainPos(int32_t crossIndex, int32_t itemIndex);
+    // Where the items of a cross end, the space kept for its estimated items included. 0 for an empty cross.
+    float GetCrossEndPos(int32_t crossIndex) const;
     void Reset();
     void Reset(int32_t resetFrom);
     int32_t GetCrossCount() const;
     int32_t GetMainCount() const;
     void ClearCacheAfterIndex(int32_t currentIndex);
+    // Keeps space for the items after the last laid out one and before [itemIndex] without measuring or placing
+    // them, each as high as the average of the laid out items, so that jumping far ahead does not measure every
+    // item in between. An estimated item is placed when it is shown, either after the items before them or above
+    // the items after them, in the cross it fits best.
+    // Returns false when there is nothing to estimate or no laid out item to estimate from.
+    bool EstimateItemsBefore(int32_t itemIndex, float mainGap);
+    bool HasEstimatedItems() const
+    {
+        return estimatedStartIndex_ < estimatedEndIndex_;
+    }
+    bool IsEstimatedItem(int32_t itemIndex) const
+    {
+        return itemIndex >= estimatedStartIndex_ && itemIndex < estimatedEndIndex_;
+    }
+    // Whether an item laid out before the estimated ones is shown at [currentOffset_].
+    bool IsItemBeforeEstimatesShown() const;
+    // The estimated item shown at the top when the viewport is in the space kept for them and none of the items
+    // laid out around them is shown, -1 otherwise.
+    int32_t GetEstimatedItemByOffset(float mainSize, float mainGap) const;
+    // Where the first estimated item goes when filling down from the items before them, the cross whose items end
+    // first.
+    FlowItemPosition GetFirstEstimatedItemPosition(float mainGap) const;
+    // Places the first estimated item after the items before them, the items after them in its cross move down if
+    // it does not fit.
+    void UpdateFirstEstimatedItem(int32_t crossIndex, float itemHeight, float mainGap);
+    // The cross the last estimated item goes to when scrolling back after a jump, the one whose space kept for them
+    // ends last, or -1 when there is none.
+    int32_t GetCrossIndexForLastEstimatedItem() const;
+    // Places the last estimated item above the items after them, so that the items shown do not move. The items
+    // after them move down if it does not fit.
+    void UpdateLastEstimatedItem(int32_t crossIndex, float itemHeight, float mainGap);
 
     float currentOffset_ = 0.0f;
     float prevOffset_ = 0.0f;
@@ -69,6 +105,12 @@ public:
     int32_t childrenCount_ = 0;
     // Map structure: [crossIndex, [index, (mainOffset, itemMainSize)]],
     std::map<int32_t, std::map<int32_t, std::pair<float, float>>> waterFlowItems_;
+    // items in [estimatedStartIndex_, estimatedEndIndex_) are skipped by a jump and not placed, each is taken as
+    // [estimatedHeight_] high. The space kept for them in each cross ends at estimatedCrossEnds_.
+    int32_t estimatedStartIndex_ = -1;
+    int32_t estimatedEndIndex_ = -1;
+    float estimatedHeight_ = 0.0f;
+    std::vector<float> estimatedCrossEnds_;
 
     void PrintWaterFlowItems() const
     {
@@ -85,6 +127,22 @@ public:
             LOGI("%{public}s", ss.str().c_str());
         }
     }
+
+private:
+    // The last item of a cross and where it ends. When the space kept for the estimated items ends the cross, the
+    // last estimated item stands for it. { -1, 0.0f } for an empty cross.
+    std::pair<int32_t, float> GetLastItemOfCross(int32_t crossIndex) const;
+    // Where the estimated items of a cross start, after the items laid out before them.
+    float GetEstimatedStartPos(const std::map<int32_t, std::pair<float, float>>& crossItems, float mainGap) const;
+    // Moves the items of a cross after the estimated ones, with the end of the space kept for them.
+    void MoveItemsAfterEstimates(int32_t crossIndex, float delta);
+    // Moves the items after the estimated ones down so that none of them overlaps the items before them in
+    // [crossIndex]. All of them move and the offset takes it up when none of the items before is shown.
+    void MoveItemsAfterEstimatesDown(int32_t crossIndex, float mainGap);
+    // Once every estimated item is placed, closes the space left between the items laid out before and after them.
+    // The offset takes up what all crosses have in common when none of the items before is shown.
+    void MeetItemsBeforeEstimates(float mainGap);
+    void ClearEstimatedItems();
 };
 } // namespace OHOS::Ace::NG
 #endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_WATERFLOW_WATER_FLOW_LAYOUT_INFO_H
\ No newline at end of file
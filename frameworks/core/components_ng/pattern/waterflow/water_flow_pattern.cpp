@@ -134,6 +134,7 @@ void WaterFlowPattern::UpdateScrollBarOffset() {};
 
 RefPtr<LayoutAlgorithm> WaterFlowPattern::CreateLayoutAlgorithm()
 {
+    // lays out layoutInfo_ in place, copying it would copy every item laid out each frame.
     auto algorithm = AceType::MakeRefPtr<WaterFlowLayoutAlgorithm>(layoutInfo_);
     algorithm->SetCanOverScroll(CanOverScroll(GetScrollSource()));
     return algorithm;
@@ -175,30 +176,28 @@ bool WaterFlowPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dir
     CHECK_NULL_RETURN(layoutAlgorithmWrapper, false);
     auto layoutAlgorithm = DynamicCast<WaterFlowLayoutAlgorithm>(layoutAlgorithmWrapper->GetLayoutAlgorithm());
     CHECK_NULL_RETURN(layoutAlgorithm, false);
-    auto layoutInfo = layoutAlgorithm->GetLayoutInfo();
     auto host = GetHost();
     CHECK_NULL_RETURN(host, false);
     auto eventHub = host->GetEventHub<WaterFlowEventHub>();
     CHECK_NULL_RETURN(eventHub, false);
     auto onScroll = eventHub->GetOnScroll();
     if (onScroll) {
-        FireOnScroll(layoutInfo.prevOffset_ - layoutInfo.currentOffset_, onScroll);
+        FireOnScroll(layoutInfo_.prevOffset_ - layoutInfo_.currentOffset_, onScroll);
     }
-    bool indexChanged =
-        layoutInfo_.startIndex_ != layoutInfo.startIndex_ || layoutInfo_.endIndex_ != layoutInfo.endIndex_;
+    bool indexChanged = reportedStartIndex_ != layoutInfo_.startIndex_ || reportedEndIndex_ != layoutInfo_.endIndex_;
     if (indexChanged) {
         auto onScrollIndex = eventHub->GetOnScrollIndex();
         if (onScrollIndex) {
-            onScrollIndex(layoutInfo.startIndex_, layoutInfo.endIndex_);
+            onScrollIndex(layoutInfo_.startIndex_, layoutInfo_.endIndex_);
         }
     }
-    if (layoutInfo.itemStart_ && !layoutInfo_.itemStart_) {
+    if (layoutInfo_.itemStart_ && !reportedItemStart_) {
         auto onReachStart = eventHub->GetOnReachStart();
         if (onReachStart) {
             onReachStart();
         }
     }
-    if (layoutInfo.offsetEnd_ && !layoutInfo_.offsetEnd_) {
+    if (layoutInfo_.offsetEnd_ && !reportedOffsetEnd_) {
         auto onReachEnd = eventHub->GetOnReachEnd();
         if (onReachEnd) {
             onReachEnd();
@@ -206,8 +205,11 @@ bool WaterFlowPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dir
     }
     OnScrollStop(eventHub->GetOnScrollStop(), false);
 
-    layoutInfo_ = std::move(layoutInfo);
     layoutInfo_.UpdateStartIndex();
+    reportedStartIndex_ = layoutInfo_.startIndex_;
+    reportedEndIndex_ = layoutInfo_.endIndex_;
+    reportedItemStart_ = layoutInfo_.itemStart_;
+    reportedOffsetEnd_ = layoutInfo_.offsetEnd_;
 
     CheckScrollable();
 
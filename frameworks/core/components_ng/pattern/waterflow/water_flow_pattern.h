@@ -73,6 +73,10 @@ public:
     void ResetLayoutInfo()
     {
         layoutInfo_.Reset();
+        reportedStartIndex_ = layoutInfo_.startIndex_;
+        reportedEndIndex_ = layoutInfo_.endIndex_;
+        reportedItemStart_ = layoutInfo_.itemStart_;
+        reportedOffsetEnd_ = layoutInfo_.offsetEnd_;
     }
 
     int32_t GetBeginIndex() const
@@ -135,6 +139,11 @@ private:
     void OnScrollEndCallback() override;
 
     WaterFlowLayoutInfo layoutInfo_;
+    // what the events fired for the last layout saw, layoutInfo_ is laid out in place.
+    int32_t reportedStartIndex_ = 0;
+    int32_t reportedEndIndex_ = 0;
+    bool reportedItemStart_ = false;
+    bool reportedOffsetEnd_ = false;
 
     // clip padding of WaterFlow
     RefPtr<WaterFlowContentModifier> contentModifier_;
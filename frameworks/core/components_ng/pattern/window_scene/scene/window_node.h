@@ -37,6 +37,11 @@ public:
     bool IsOutOfTouchTestRegion(const PointF& parentLocalPoint, int32_t sourceType) override;
     std::vector<RectF> GetResponseRegionList(const RectF& rect, int32_t sourceType) override;
 
+    bool IsHitTestCustomized() const override
+    {
+        return true;
+    }
+
 private:
     RectF ConvertHotRect(const RectF& rect, int32_t sourceType);
     std::vector<RectF> ConvertHotRects(const std::vector<Rosen::Rect>& hotAreas);
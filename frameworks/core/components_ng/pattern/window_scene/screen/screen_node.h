@@ -32,6 +32,11 @@ public:
         const PointF& parentRevertPoint, const TouchRestrict& touchRestrict,
         TouchTestResult& result, int32_t touchId) override;
 
+    bool IsHitTestCustomized() const override
+    {
+        return true;
+    }
+
     static RefPtr<ScreenNode> GetOrCreateScreenNode(
         const std::string& tag, int32_t nodeId, const std::function<RefPtr<Pattern>(void)>& patternCreator);
 };
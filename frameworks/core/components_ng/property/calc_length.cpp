@@ -36,13 +36,12 @@ bool CalcLength::NormalizeToPx(
     double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const
 {
     // don't use this function for calc.
-    if (!calcValue_.empty()) {
-        result = StringExpression::CalculateExp(
-            calcValue_, [vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) -> double {
-                double result = -1.0;
-                dim.NormalizeToPx(vpScale, fpScale, lpxScale, parentLength, result);
-                return result;
-            });
+    if (compiledCalcValue_) {
+        result = compiledCalcValue_->Calculate([vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) {
+            double result = -1.0;
+            dim.NormalizeToPx(vpScale, fpScale, lpxScale, parentLength, result);
+            return result;
+        });
         return result >= 0;
     }
     return dimension_.NormalizeToPx(vpScale, fpScale, lpxScale, parentLength, result);
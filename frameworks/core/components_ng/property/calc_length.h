@@ -16,8 +16,11 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 #define FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 
+#include <memory>
+
 #include "base/geometry/dimension.h"
 #include "base/geometry/ng/size_t.h"
+#include "base/utils/string_expression.h"
 #include "base/utils/utils.h"
 
 namespace OHOS::Ace::NG {
@@ -50,7 +53,10 @@ struct ACE_EXPORT ScaleProperty {
 class CalcLength {
 public:
     CalcLength() = default;
-    explicit CalcLength(const std::string& value) : calcValue_(value) {}
+    explicit CalcLength(const std::string& value) : calcValue_(value)
+    {
+        CompileCalcValue();
+    }
     ~CalcLength() = default;
 
     explicit CalcLength(double value, DimensionUnit unit = DimensionUnit::PX) : dimension_(value, unit) {};
@@ -59,6 +65,7 @@ public:
     void Reset()
     {
         calcValue_ = "";
+        compiledCalcValue_.reset();
         dimension_.Reset();
     }
 
@@ -70,6 +77,7 @@ public:
     void SetCalcValue(const std::string& value)
     {
         calcValue_ = value;
+        CompileCalcValue();
     }
 
     bool NormalizeToPx(double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const;
@@ -117,7 +125,15 @@ public:
     }
 
 private:
+    void CompileCalcValue()
+    {
+        compiledCalcValue_ =
+            calcValue_.empty() ? nullptr : StringExpression::CompiledExpression::Compile(calcValue_);
+    }
+
     std::string calcValue_;
+    // compiled once and shared by every CalcLength of the same formula.
+    std::shared_ptr<const StringExpression::CompiledExpression> compiledCalcValue_;
     Dimension dimension_;
 };
 } // namespace OHOS::Ace::NG
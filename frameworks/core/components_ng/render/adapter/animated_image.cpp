@@ -152,7 +152,7 @@ void AnimatedImage::DecodeFrame(uint32_t idx)
     }
     ++queueSize_;
 
-    ACE_SCOPED_TRACE("decode %s frame %d", cacheKey_.c_str(), idx);
+    ACE_IMAGE_SCOPED_TRACE("decode %s frame %d", cacheKey_.c_str(), idx);
     std::scoped_lock<std::mutex> lock(decodeMtx_);
     DecodeImpl(idx);
 
@@ -26,6 +26,7 @@ namespace OHOS::Ace::NG {
 // PaintProperty are used to set render properties.
 class PaintProperty : public Property {
     DECLARE_ACE_TYPE(PaintProperty, Property)
+    ACE_POOLED_ALLOCATION();
 
 public:
     PaintProperty() = default;
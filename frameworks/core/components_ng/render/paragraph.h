@@ -48,6 +48,14 @@ struct ParagraphStyle {
     TextOverflow textOverflow = TextOverflow::CLIP;
     std::optional<LeadingMargin> leadingMargin;
     double fontSize = 14.0;
+
+    bool operator==(const ParagraphStyle& other) const
+    {
+        return direction == other.direction && align == other.align && maxLines == other.maxLines &&
+               fontLocale == other.fontLocale && wordBreak == other.wordBreak && ellipsisMode == other.ellipsisMode &&
+               textOverflow == other.textOverflow && leadingMargin == other.leadingMargin &&
+               NearEqual(fontSize, other.fontSize);
+    }
 };
 
 struct CaretMetricsF {
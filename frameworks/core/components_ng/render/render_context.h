@@ -60,6 +60,7 @@ inline constexpr int32_t ZINDEX_DEFAULT_VALUE = 0;
 // RenderContext is used for render node to paint.
 class RenderContext : public virtual AceType {
     DECLARE_ACE_TYPE(NG::RenderContext, AceType)
+    ACE_POOLED_ALLOCATION();
 
 public:
     ~RenderContext() override = default;
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_FOREACH_LAZY_FOR_EACH_BUILDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_FOREACH_LAZY_FOR_EACH_BUILDER_H
 
+#include <algorithm>
 #include <cstdint>
 #include <list>
 #include <map>
@@ -32,7 +33,9 @@
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/base/ui_node.h"
 #include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/custom/custom_node_base.h"
 #include "core/components_v2/foreach/lazy_foreach_component.h"
+#include "core/components_v2/inspector/inspector_constants.h"
 #include "core/components_ng/pattern/list/list_item_pattern.h"
 
 namespace OHOS::Ace::NG {
@@ -99,16 +102,19 @@ public:
 
     bool OnDataAdded(size_t index)
     {
-        if (!cachedItems_.empty() && index <= static_cast<size_t>(cachedItems_.rbegin()->first)) {
-            decltype(cachedItems_) temp(std::move(cachedItems_));
-
-            for (auto& [oldindex, id] : temp) {
-                cachedItems_.try_emplace(
-                    index > static_cast<size_t>(oldindex) ? oldindex : oldindex + 1, std::move(id));
+        // move the keys of the items from index on, starting from the last one, the nodes of the map are reused.
+        auto iter = cachedItems_.end();
+        while (iter != cachedItems_.begin()) {
+            auto prev = std::prev(iter);
+            if (static_cast<size_t>(prev->first) < index) {
+                break;
             }
+            auto item = cachedItems_.extract(prev);
+            ++item.key();
+            iter = cachedItems_.insert(iter, std::move(item));
         }
         for (auto& [key, node] : expiringItem_) {
-            if (static_cast<size_t>(node.first) >= index) {
+            if (node.first >= 0 && static_cast<size_t>(node.first) >= index) {
                 node.first++;
             }
         }
@@ -123,18 +129,24 @@ public:
             return node;
         }
         if (index <= static_cast<size_t>(cachedItems_.rbegin()->first)) {
-            decltype(cachedItems_) temp(std::move(cachedItems_));
-
-            for (auto& [oldindex, child] : temp) {
-                if (static_cast<size_t>(oldindex) == index) {
-                    node = child.second;
-                } else {
-                    cachedItems_.try_emplace(
-                        index > static_cast<size_t>(oldindex) ? oldindex : oldindex - 1, std::move(child));
-                }
+            auto iter = cachedItems_.lower_bound(static_cast<int32_t>(index));
+            if (static_cast<size_t>(iter->first) == index) {
+                node = iter->second.second;
+                iter = cachedItems_.erase(iter);
+            }
+            // move the keys of the items after index, the nodes of the map are reused.
+            while (iter != cachedItems_.end()) {
+                auto next = std::next(iter);
+                auto item = cachedItems_.extract(iter);
+                --item.key();
+                cachedItems_.insert(next, std::move(item));
+                iter = next;
             }
         }
         for (auto& [key, child] : expiringItem_) {
+            if (child.first < 0) {
+                continue;
+            }
             if (static_cast<size_t>(child.first) > index) {
                 child.first--;
                 continue;
@@ -183,6 +195,31 @@ public:
         return true;
     }
 
+    // Moves the expired items which no longer show any data and hold reusable components to recyclePool_, then
+    // releases the oldest pooled item of each type, so that its component goes back to the recycle pool of the JS
+    // view and is rebound with the data of the item built next instead of that item being built from scratch.
+    // Called before building an item whose key is not found in expiringItem_.
+    void RecycleExpiredItems()
+    {
+        for (auto iter = expiringItem_.begin(); iter != expiringItem_.end();) {
+            if (iter->second.first == -1 && PoolItem(iter->second.second)) {
+                iter = expiringItem_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        for (auto iter = recyclePool_.begin(); iter != recyclePool_.end();) {
+            iter->second.pop_front();
+            iter = iter->second.empty() ? recyclePool_.erase(iter) : std::next(iter);
+        }
+    }
+
+    // Trims recyclePool_ like the image and paragraph caches, the items dropped do not go to the JS recycle pool.
+    void NotifyMemoryLevel(int32_t level)
+    {
+        TrimRecyclePool(level <= MEMORY_LEVEL_MODERATE ? GetRecyclePoolLimit() / 2 : 0);
+    }
+
     RefPtr<UINode> GetChildByKey(const std::string& key)
     {
         return nullptr;
@@ -195,11 +232,11 @@ public:
         int32_t lastIndex = -1;
         bool isCertained = false;
 
-        decltype(cachedItems_) items(std::move(cachedItems_));
-
-        for (auto& [index, node] : items) {
+        for (auto iter = cachedItems_.begin(); iter != cachedItems_.end();) {
+            auto index = iter->first;
+            auto& node = iter->second;
             if (!node.second) {
-                cachedItems_.try_emplace(index, std::move(node));
+                ++iter;
                 continue;
             }
 
@@ -207,9 +244,10 @@ public:
             if (frameNode && !frameNode->IsActive()) {
                 frameNode->SetJSViewActive(false);
                 expiringItem_.try_emplace(node.first, LazyForEachCacheChild(index, std::move(node.second)));
+                iter = cachedItems_.erase(iter);
                 continue;
             }
-            cachedItems_.try_emplace(index, std::move(node));
+            ++iter;
             if (startIndex_ == -1) {
                 startIndex_ = index;
             }
@@ -371,6 +409,10 @@ public:
                 }
             }
         }
+        // the expired items left are released, the reusable ones wait in recyclePool_ for an item of their type.
+        for (auto& [key, node] : expiringItem_) {
+            PoolItem(node.second);
+        }
         expiringItem_.swap(cache);
         return result;
     }
@@ -384,6 +426,7 @@ public:
     void SetCacheCount(int32_t cacheCount)
     {
         cacheCount_ = cacheCount;
+        TrimRecyclePool(GetRecyclePoolLimit());
     }
 
     void SetIsLoop(bool isLoop)
@@ -419,8 +462,84 @@ protected:
     virtual void OnExpandChildrenOnInitialInNG() = 0;
 
 private:
+    // a reusable component is the item itself or wrapped in its root, e.g. in a ListItem.
+    static constexpr int32_t REUSABLE_COMPONENT_DEPTH = 2;
+    static constexpr int32_t MEMORY_LEVEL_MODERATE = 0;
+
+    // The RecycleDummyNode wrapping the reusable component of an item, nullptr for an item without one.
+    static RefPtr<UINode> FindReusableComponent(const RefPtr<UINode>& node, int32_t depth)
+    {
+        CHECK_NULL_RETURN(node, nullptr);
+        if (node->GetTag() == V2::RECYCLE_VIEW_ETS_TAG) {
+            return node;
+        }
+        if (depth <= 0) {
+            return nullptr;
+        }
+        for (const auto& child : node->GetChildren()) {
+            auto reusableComponent = FindReusableComponent(child, depth - 1);
+            if (reusableComponent) {
+                return reusableComponent;
+            }
+        }
+        return nullptr;
+    }
+
+    // Takes an expired item off the tree holding a reusable component into the pool of its type, the oldest item of
+    // the type is dropped when the pool is full. Returns false, leaving [node] as it is, for any other item.
+    bool PoolItem(RefPtr<UINode>& node)
+    {
+        if (!node || node->IsOnMainTree()) {
+            return false;
+        }
+        auto reusableComponent = FindReusableComponent(node, REUSABLE_COMPONENT_DEPTH);
+        CHECK_NULL_RETURN(reusableComponent, false);
+        auto customNode = AceType::DynamicCast<CustomNodeBase>(reusableComponent->GetFirstChild());
+        if (!customNode) {
+            node = nullptr;
+            return true;
+        }
+        auto& items = recyclePool_[customNode->GetJSViewName()];
+        items.emplace_back(std::move(node));
+        if (items.size() > GetRecyclePoolLimit()) {
+            DropPooledItem(items.front());
+            items.pop_front();
+        }
+        return true;
+    }
+
+    // Each type keeps as many items as PreBuild keeps around the items shown, so that rebuilding them after a reload
+    // reuses the components of the old ones.
+    size_t GetRecyclePoolLimit() const
+    {
+        return static_cast<size_t>(std::max(cacheCount_, 0)) * 2 + 1;
+    }
+
+    void TrimRecyclePool(size_t limit)
+    {
+        for (auto iter = recyclePool_.begin(); iter != recyclePool_.end();) {
+            auto& items = iter->second;
+            while (items.size() > limit) {
+                DropPooledItem(items.front());
+                items.pop_front();
+            }
+            iter = items.empty() ? recyclePool_.erase(iter) : std::next(iter);
+        }
+    }
+
+    // Releases a pooled item without recycling its component, the RecycleDummyNode only recycles a component it
+    // still holds when destroyed.
+    static void DropPooledItem(const RefPtr<UINode>& node)
+    {
+        auto reusableComponent = FindReusableComponent(node, REUSABLE_COMPONENT_DEPTH);
+        CHECK_NULL_VOID(reusableComponent);
+        reusableComponent->Clean(true);
+    }
+
     std::map<int32_t, LazyForEachChild> cachedItems_;
     std::unordered_map<std::string, LazyForEachCacheChild> expiringItem_;
+    // expired items holding reusable components by the name of the component, the oldest first.
+    std::unordered_map<std::string, std::list<RefPtr<UINode>>> recyclePool_;
 
     int32_t startIndex_ = -1;
     int32_t endIndex_ = -1;
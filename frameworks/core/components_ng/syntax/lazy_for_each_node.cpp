@@ -79,7 +79,8 @@ void LazyForEachNode::PostIdleTask()
     needPredict_ = true;
     auto context = GetContext();
     CHECK_NULL_VOID(context);
-    context->AddPredictTask([weak = AceType::WeakClaim(this)](int64_t deadline, bool canUseLongPredictTask) {
+    auto weak = AceType::WeakClaim(this);
+    context->AddPredictTask([weak](int64_t deadline, bool canUseLongPredictTask) {
         ACE_SCOPED_TRACE("LazyForEach predict");
         auto node = weak.Upgrade();
         CHECK_NULL_VOID(node);
@@ -95,7 +96,7 @@ void LazyForEachNode::PostIdleTask()
                 node->itemConstraint_.reset();
             }
         }
-    });
+    }, PredictTaskPriority::NORMAL, weak, PredictTaskType::LAZY_FOR_EACH);
 }
 
 void LazyForEachNode::OnDataReloaded()
@@ -172,6 +173,17 @@ void LazyForEachNode::NotifyDataCountChanged(int32_t index)
     }
 }
 
+void LazyForEachNode::NotifyMemoryLevelOnMainTree(bool onMainTree)
+{
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipeline);
+    if (onMainTree) {
+        pipeline->AddNodesToNotifyMemoryLevel(GetId());
+    } else {
+        pipeline->RemoveNodesToNotifyMemoryLevel(GetId());
+    }
+}
+
 void LazyForEachNode::MarkNeedSyncRenderTree(bool needRebuild)
 {
     if (needMarkParent_) {
@@ -108,10 +108,17 @@ public:
     }
     int32_t GetIndexByUINode(const RefPtr<UINode>& uiNode) const;
 
+    void OnNotifyMemoryLevel(int32_t level) override
+    {
+        CHECK_NULL_VOID(builder_);
+        builder_->NotifyMemoryLevel(level);
+    }
+
 private:
     void OnAttachToMainTree(bool recursive) override
     {
         UINode::OnAttachToMainTree(recursive);
+        NotifyMemoryLevelOnMainTree(true);
         CHECK_NULL_VOID(builder_);
         if (!isRegisterListener_) {
             builder_->RegisterDataChangeListener(Claim(this));
@@ -121,6 +128,7 @@ private:
 
     void OnDetachFromMainTree(bool recursive) override
     {
+        NotifyMemoryLevelOnMainTree(false);
         CHECK_NULL_VOID(builder_);
         builder_->UnregisterDataChangeListener(Claim(this));
         isRegisterListener_ = false;
@@ -145,6 +153,8 @@ private:
     }
 
     void NotifyDataCountChanged(int32_t index);
+    // the recycle pool of the builder is trimmed on memory level while the node is on the main tree.
+    void NotifyMemoryLevelOnMainTree(bool onMainTree);
 
     // The index values of the start and end of the current children nodes and the corresponding keys.
     std::list<std::optional<std::string>> ids_;
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_EVENT_TOUCH_HISTORY_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_EVENT_TOUCH_HISTORY_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+
+// One position of a pointer, |time| in seconds.
+struct TouchSample {
+    double time = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+// Parameters of a2 * t^2 + a1 * t + a0 fitted around the time of the latest sample, so that a0 is the position and
+// a1 the velocity of the pointer at that time.
+struct TouchFit {
+    std::array<double, 3> x {};
+    std::array<double, 3> y {};
+};
+
+// TouchHistory keeps the latest samples of one pointer in a fixed ring, tracking a pointer never allocates however
+// long it moves. The resampler of the pipeline and the velocity trackers of the recognizers fit the same ring.
+class TouchHistory final {
+public:
+    static constexpr size_t CAPACITY = 16;
+    // the quadratic needs three samples, the five latest ones are fitted by default as VelocityTracker always did.
+    static constexpr size_t MIN_FIT_COUNT = 3;
+    static constexpr size_t DEFAULT_FIT_COUNT = 5;
+
+    // Samples later than |time| are dropped first, they were predicted past the points reported after them.
+    void Add(double time, double x, double y)
+    {
+        while (size_ > 0 && Back().time > time) {
+            end_ = (end_ + CAPACITY - 1) % CAPACITY;
+            --size_;
+        }
+        samples_[end_] = { time, x, y };
+        end_ = (end_ + 1) % CAPACITY;
+        size_ = std::min(size_ + 1, CAPACITY);
+    }
+
+    void Reset()
+    {
+        end_ = 0;
+        size_ = 0;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    // |index| 0 is the oldest sample kept.
+    const TouchSample& At(size_t index) const
+    {
+        return samples_[(end_ + CAPACITY - size_ + index) % CAPACITY];
+    }
+
+    const TouchSample& Back() const
+    {
+        return At(size_ - 1);
+    }
+
+    // Least squares over the latest |count| samples, false when there are too few of them or they share times.
+    bool Fit(TouchFit& fit, size_t count = DEFAULT_FIT_COUNT) const
+    {
+        count = std::min(count, size_);
+        if (count < MIN_FIT_COUNT) {
+            return false;
+        }
+        // sums of t^k for k in [0, 4], and of x * t^k and y * t^k for k in [0, 2].
+        std::array<double, 5> sumT {};
+        std::array<double, 3> sumX {};
+        std::array<double, 3> sumY {};
+        auto latestTime = Back().time;
+        for (auto i = size_ - count; i < size_; ++i) {
+            const auto& sample = At(i);
+            auto time = sample.time - latestTime;
+            double power = 1.0;
+            for (size_t k = 0; k < sumT.size(); ++k) {
+                if (k < sumX.size()) {
+                    sumX[k] += power * sample.x;
+                    sumY[k] += power * sample.y;
+                }
+                sumT[k] += power;
+                power *= time;
+            }
+        }
+        // the normal equations are M * (a0, a1, a2) = sums with M[i][j] = sumT[i + j], solved by Cramer's rule.
+        auto det = Determinant(sumT[0], sumT[1], sumT[2], sumT[1], sumT[2], sumT[3], sumT[2], sumT[3], sumT[4]);
+        // the same limit as Matrix3::Invert, which VelocityTracker solved with before.
+        static constexpr double minDet = 1e-20;
+        if (NearZero(det, minDet)) {
+            return false;
+        }
+        Solve(sumT, sumX, det, fit.x);
+        Solve(sumT, sumY, det, fit.y);
+        return true;
+    }
+
+private:
+    static double Determinant(double a, double b, double c, double d, double e, double f, double g, double h, double i)
+    {
+        return a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
+    }
+
+    static void Solve(const std::array<double, 5>& sumT, const std::array<double, 3>& sums, double det,
+        std::array<double, 3>& params)
+    {
+        params[0] = Determinant(sums[0], sumT[1], sumT[2], sums[1], sumT[2], sumT[3], sums[2], sumT[3], sumT[4]) / det;
+        params[1] = Determinant(sumT[0], sums[0], sumT[2], sumT[1], sums[1], sumT[3], sumT[2], sums[2], sumT[4]) / det;
+        params[2] = Determinant(sumT[0], sumT[1], sums[0], sumT[1], sumT[2], sums[1], sumT[2], sumT[3], sums[2]) / det;
+    }
+
+    std::array<TouchSample, CAPACITY> samples_;
+    size_t end_ = 0;
+    size_t size_ = 0;
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_EVENT_TOUCH_HISTORY_H
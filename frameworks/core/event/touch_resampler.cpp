@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/event/touch_resampler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr uint64_t INTERPOLATION_THRESHOLD = 100 * 1000 * 1000; // 100ms
+// predictions reach at most one 60 Hz refresh period past the latest point.
+constexpr uint64_t MAX_PREDICTION_TIME = 16 * 1000 * 1000; // 16ms
+constexpr double NANOSECONDS_TO_SECONDS = 1e-9;
+// noise of the acceleration of a finger in px^2/s^3, and of the positions reported by the panel in px^2.
+constexpr double KALMAN_PROCESS_NOISE = 1e6;
+constexpr double KALMAN_MEASUREMENT_NOISE = 1.0;
+// the velocity of a pointer is unknown when it is first seen.
+constexpr double KALMAN_INITIAL_VELOCITY_VARIANCE = 1e6;
+
+uint64_t GetNanoTime(const TouchEvent& point)
+{
+    return static_cast<uint64_t>(point.time.time_since_epoch().count());
+}
+} // namespace
+
+void TouchResampler::FramePoint::Add(const TouchEvent& point, uint64_t pointTime)
+{
+    if (count > 0 && pointTime == lastTime) {
+        return;
+    }
+    if (count == 0) {
+        time = pointTime;
+    }
+    x += point.x;
+    y += point.y;
+    screenX += point.screenX;
+    screenY += point.screenY;
+    // times are summed from the first point, a sum of absolute nanoseconds could overflow.
+    timeSum += pointTime > time ? pointTime - time : 0;
+    lastTime = pointTime;
+    ++count;
+}
+
+void TouchResampler::FramePoint::Average()
+{
+    if (count == 0) {
+        return;
+    }
+    x /= count;
+    y /= count;
+    screenX /= count;
+    screenY /= count;
+    time += timeSum / static_cast<uint64_t>(count);
+}
+
+void TouchResampler::KalmanAxis::Init(double measurement)
+{
+    position = measurement;
+    velocity = 0.0;
+    p00 = KALMAN_MEASUREMENT_NOISE;
+    p01 = 0.0;
+    p11 = KALMAN_INITIAL_VELOCITY_VARIANCE;
+}
+
+void TouchResampler::KalmanAxis::Update(double dt, double measurement)
+{
+    // predict with constant velocity, the acceleration being white noise.
+    position += velocity * dt;
+    auto dt2 = dt * dt;
+    p00 += dt * (2.0 * p01 + dt * p11) + KALMAN_PROCESS_NOISE * dt2 * dt / 3.0;
+    p01 += dt * p11 + KALMAN_PROCESS_NOISE * dt2 / 2.0;
+    p11 += KALMAN_PROCESS_NOISE * dt;
+
+    // correct with the measured position.
+    auto gain0 = p00 / (p00 + KALMAN_MEASUREMENT_NOISE);
+    auto gain1 = p01 / (p00 + KALMAN_MEASUREMENT_NOISE);
+    auto residual = measurement - position;
+    position += gain0 * residual;
+    velocity += gain1 * residual;
+    p11 -= gain1 * p01;
+    p00 -= gain0 * p00;
+    p01 -= gain0 * p01;
+}
+
+void TouchResampler::SetPredictor(TouchPredictor predictor)
+{
+    if (predictor < TouchPredictor::NONE || predictor > TouchPredictor::KALMAN) {
+        predictor = TouchPredictor::NONE;
+    }
+    if (predictor_ != predictor) {
+        predictor_ = predictor;
+        Reset();
+    }
+}
+
+void TouchResampler::AddPoint(const TouchEvent& point)
+{
+    auto time = GetNanoTime(point);
+    auto& pointer = GetOrCreatePointer(point.id, time);
+    pointer.currentFrame.Add(point, time);
+    if (predictor_ != TouchPredictor::NONE && time >= pointer.latestTime) {
+        auto seconds = static_cast<double>(time - pointer.firstTime) * NANOSECONDS_TO_SECONDS;
+        if (pointer.history.Empty()) {
+            pointer.kalmanX.Init(point.x);
+            pointer.kalmanY.Init(point.y);
+        } else {
+            auto dt = seconds - pointer.history.Back().time;
+            pointer.kalmanX.Update(dt, point.x);
+            pointer.kalmanY.Update(dt, point.y);
+        }
+        pointer.history.Add(seconds, point.x, point.y);
+    }
+    pointer.latestTime = std::max(pointer.latestTime, time);
+}
+
+bool TouchResampler::EndFrame(TouchEvent& point, uint64_t targetTime, bool resample)
+{
+    auto pointer = FindPointer(point.id);
+    CHECK_NULL_RETURN(pointer, false);
+    auto& currentFrame = pointer->currentFrame;
+    if (currentFrame.count == 0) {
+        return false;
+    }
+    currentFrame.Average();
+    bool resampled = false;
+    if (resample) {
+        resampled = predictor_ == TouchPredictor::NONE ? Interpolate(*pointer, point, targetTime)
+                                                       : Predict(*pointer, point, targetTime);
+    }
+    pointer->lastFrame = currentFrame;
+    currentFrame = FramePoint();
+    if (resampled) {
+        point.isInterpolated = true;
+    }
+    return resampled;
+}
+
+void TouchResampler::ResetPointer(int32_t id)
+{
+    auto pointer = FindPointer(id);
+    CHECK_NULL_VOID(pointer);
+    *pointer = Pointer();
+}
+
+void TouchResampler::Reset()
+{
+    pointers_.fill(Pointer());
+}
+
+TouchResampler::Pointer* TouchResampler::FindPointer(int32_t id)
+{
+    auto iter = std::find_if(
+        pointers_.begin(), pointers_.end(), [id](const Pointer& pointer) { return pointer.id == id; });
+    return iter != pointers_.end() ? &(*iter) : nullptr;
+}
+
+TouchResampler::Pointer& TouchResampler::GetOrCreatePointer(int32_t id, uint64_t time)
+{
+    auto pointer = FindPointer(id);
+    if (pointer) {
+        return *pointer;
+    }
+    // a free slot, or the one of the pointer which moved the longest ago.
+    pointer = FindPointer(-1);
+    if (!pointer) {
+        pointer = &(*std::min_element(pointers_.begin(), pointers_.end(),
+            [](const Pointer& left, const Pointer& right) { return left.latestTime < right.latestTime; }));
+    }
+    *pointer = Pointer();
+    pointer->id = id;
+    pointer->firstTime = time;
+    return *pointer;
+}
+
+bool TouchResampler::Interpolate(const Pointer& pointer, TouchEvent& point, uint64_t targetTime) const
+{
+    const auto& lastFrame = pointer.lastFrame;
+    const auto& currentFrame = pointer.currentFrame;
+    if (lastFrame.count == 0 || currentFrame.time <= lastFrame.time ||
+        currentFrame.time - lastFrame.time > INTERPOLATION_THRESHOLD) {
+        return false;
+    }
+    if (targetTime <= lastFrame.time || targetTime == currentFrame.time) {
+        return false;
+    }
+    // interpolates before the current frame, extrapolates after it.
+    auto alpha = static_cast<double>(targetTime - lastFrame.time) /
+                 static_cast<double>(currentFrame.time - lastFrame.time);
+    point.x = static_cast<float>(lastFrame.x + alpha * (currentFrame.x - lastFrame.x));
+    point.y = static_cast<float>(lastFrame.y + alpha * (currentFrame.y - lastFrame.y));
+    point.screenX = static_cast<float>(lastFrame.screenX + alpha * (currentFrame.screenX - lastFrame.screenX));
+    point.screenY = static_cast<float>(lastFrame.screenY + alpha * (currentFrame.screenY - lastFrame.screenY));
+    point.time = TimeStamp(std::chrono::nanoseconds(targetTime));
+    return true;
+}
+
+bool TouchResampler::Predict(const Pointer& pointer, TouchEvent& point, uint64_t targetTime) const
+{
+    // a pointer which stayed still for long is not moved, nor one already reported past the target.
+    if (targetTime <= pointer.latestTime || targetTime - pointer.latestTime > INTERPOLATION_THRESHOLD) {
+        return false;
+    }
+    // the point is stamped with the time it is predicted for, not the target one when the prediction is clamped.
+    auto predictionTime = std::min(targetTime - pointer.latestTime, MAX_PREDICTION_TIME);
+    auto dt = static_cast<double>(predictionTime) * NANOSECONDS_TO_SECONDS;
+    double x = 0.0;
+    double y = 0.0;
+    if (predictor_ == TouchPredictor::LEAST_SQUARE) {
+        TouchFit fit;
+        if (!pointer.history.Fit(fit)) {
+            return false;
+        }
+        x = fit.x[0] + dt * (fit.x[1] + dt * fit.x[2]);
+        y = fit.y[0] + dt * (fit.y[1] + dt * fit.y[2]);
+    } else {
+        if (pointer.history.Size() < TouchHistory::MIN_FIT_COUNT) {
+            return false;
+        }
+        x = pointer.kalmanX.position + dt * pointer.kalmanX.velocity;
+        y = pointer.kalmanY.position + dt * pointer.kalmanY.velocity;
+    }
+    // screen coordinates are offset from the window ones, they move by the same distance.
+    auto dx = static_cast<float>(x) - point.x;
+    auto dy = static_cast<float>(y) - point.y;
+    point.x += dx;
+    point.y += dy;
+    point.screenX += dx;
+    point.screenY += dy;
+    point.time = TimeStamp(std::chrono::nanoseconds(pointer.latestTime + predictionTime));
+    return true;
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_EVENT_TOUCH_RESAMPLER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_EVENT_TOUCH_RESAMPLER_H
+
+#include <array>
+#include <cstdint>
+
+#include "base/utils/macros.h"
+#include "core/event/touch_event.h"
+#include "core/event/touch_history.h"
+
+namespace OHOS::Ace {
+
+enum class TouchPredictor : int32_t {
+    // interpolates between the average points of the last two frames, one refresh period behind the vsync.
+    NONE = 0,
+    // extrapolates the least squares fit of the latest points to the vsync.
+    LEAST_SQUARE,
+    // extrapolates a constant velocity kalman filter to the vsync.
+    KALMAN,
+};
+
+// TouchResampler moves the latest point of each moving pointer in a frame to the time the frame is drawn for. The
+// state of the pointers is kept in fixed slots and rings, resampling a frame allocates nothing however many points
+// the panel reports per frame. It is fed and read on the ui thread only.
+class ACE_EXPORT TouchResampler final {
+public:
+    static constexpr size_t MAX_POINTER_COUNT = 10;
+
+    TouchResampler() = default;
+    explicit TouchResampler(TouchPredictor predictor)
+    {
+        SetPredictor(predictor);
+    }
+    ~TouchResampler() = default;
+
+    // Unknown predictors fall back to TouchPredictor::NONE.
+    void SetPredictor(TouchPredictor predictor);
+
+    TouchPredictor GetPredictor() const
+    {
+        return predictor_;
+    }
+
+    // Adds a moving point to the current frame of its pointer.
+    void AddPoint(const TouchEvent& point);
+
+    // Ends the current frame of |point.id|, |point| being the latest point added to it. When |resample| is true and
+    // the frame can be resampled to |targetTime| in nanoseconds, moves |point| there and returns true. A predicted
+    // point is stamped with the time it is predicted for, at most 16ms past the latest point reported, so the points
+    // reported in the next frame may be older than it. TouchHistory then drops it from the velocity trackers.
+    bool EndFrame(TouchEvent& point, uint64_t targetTime, bool resample = true);
+
+    // Forgets a pointer which went down, up or was cancelled.
+    void ResetPointer(int32_t id);
+    void Reset();
+
+private:
+    // Average of the points of a pointer in one frame, points repeating the time of the previous one are skipped.
+    struct FramePoint {
+        double x = 0.0;
+        double y = 0.0;
+        double screenX = 0.0;
+        double screenY = 0.0;
+        // time of the first point until averaged.
+        uint64_t time = 0;
+        uint64_t timeSum = 0;
+        uint64_t lastTime = 0;
+        int32_t count = 0;
+
+        void Add(const TouchEvent& point, uint64_t pointTime);
+        void Average();
+    };
+
+    // Position and velocity along one axis, with the covariance of both.
+    struct KalmanAxis {
+        double position = 0.0;
+        double velocity = 0.0;
+        double p00 = 0.0;
+        double p01 = 0.0;
+        double p11 = 0.0;
+
+        void Init(double measurement);
+        void Update(double dt, double measurement);
+    };
+
+    struct Pointer {
+        int32_t id = -1;
+        uint64_t firstTime = 0;
+        uint64_t latestTime = 0;
+        FramePoint lastFrame;
+        FramePoint currentFrame;
+        TouchHistory history;
+        KalmanAxis kalmanX;
+        KalmanAxis kalmanY;
+    };
+
+    Pointer* FindPointer(int32_t id);
+    Pointer& GetOrCreatePointer(int32_t id, uint64_t time);
+    bool Interpolate(const Pointer& pointer, TouchEvent& point, uint64_t targetTime) const;
+    bool Predict(const Pointer& pointer, TouchEvent& point, uint64_t targetTime) const;
+
+    TouchPredictor predictor_ = TouchPredictor::NONE;
+    std::array<Pointer, MAX_POINTER_COUNT> pointers_;
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_EVENT_TOUCH_RESAMPLER_H
@@ -40,9 +40,7 @@ void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
     }
     // nanoseconds duration to seconds.
     std::chrono::duration<double> duration = event.time - firstTrackPoint_.time;
-    auto seconds = duration.count();
-    xAxis_.UpdatePoint(seconds, event.x);
-    yAxis_.UpdatePoint(seconds, event.y);
+    history_.Add(duration.count(), event.x, event.y);
 }
 
 void VelocityTracker::UpdateTrackerPoint(double x, double y, const TimeStamp& time, bool end)
@@ -66,9 +64,7 @@ void VelocityTracker::UpdateTrackerPoint(double x, double y, const TimeStamp& ti
     }
     // nanoseconds duration to seconds.
     std::chrono::duration<double> duration = time - firstPointTime_;
-    auto seconds = duration.count();
-    xAxis_.UpdatePoint(seconds, x);
-    yAxis_.UpdatePoint(seconds, y);
+    history_.Add(duration.count(), x, y);
 }
 
 void VelocityTracker::UpdateVelocity()
@@ -76,23 +72,16 @@ void VelocityTracker::UpdateVelocity()
     if (isVelocityDone_) {
         return;
     }
-    if (xAxis_.GetXVals().empty() || yAxis_.GetXVals().empty()) {
+    if (history_.Empty()) {
         return;
     }
-    // the least square method three params curve is 0 * x^3 + a2 * x^2 + a1 * x + a0
-    // the velocity is 2 * a2 * x + a1;
-    static const int32_t linearParam = 2;
-    std::vector<double> xAxis { 3, 0 };
-    auto xValue = xAxis_.GetXVals().back();
+    // the curve a2 * t^2 + a1 * t + a0 is fitted around the latest point, where the velocity is a1.
     double xVelocity = 0.0;
-    if (xAxis_.GetLeastSquareParams(xAxis)) {
-        xVelocity = linearParam * xAxis[0] * xValue + xAxis[1];
-    }
-    std::vector<double> yAxis { 3, 0 };
-    auto yValue = yAxis_.GetXVals().back();
     double yVelocity = 0.0;
-    if (yAxis_.GetLeastSquareParams(yAxis)) {
-        yVelocity = linearParam * yAxis[0] * yValue + yAxis[1];
+    TouchFit fit;
+    if (history_.Fit(fit)) {
+        xVelocity = fit.x[1];
+        yVelocity = fit.y[1];
     }
 
     velocity_.SetOffsetPerSecond({ xVelocity, yVelocity });
@@ -17,9 +17,9 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_VELOCITY_TRACKER_H
 
 #include "base/geometry/axis.h"
-#include "base/geometry/least_square_impl.h"
 #include "base/geometry/offset.h"
 #include "core/event/touch_event.h"
+#include "core/event/touch_history.h"
 #include "core/gestures/velocity.h"
 
 namespace OHOS::Ace {
@@ -36,8 +36,7 @@ public:
         velocity_.Reset();
         delta_.Reset();
         isFirstPoint_ = true;
-        xAxis_.Reset();
-        yAxis_.Reset();
+        history_.Reset();
     }
 
     void UpdateTouchPoint(const TouchEvent& event, bool end = false);
@@ -131,8 +130,7 @@ private:
     bool isFirstPoint_ = true;
     TimeStamp lastTimePoint_;
     TimeStamp firstPointTime_;
-    LeastSquareImpl xAxis_ { 3, 5 };
-    LeastSquareImpl yAxis_ { 3, 5 };
+    TouchHistory history_;
     bool isVelocityDone_ = false;
 };
 
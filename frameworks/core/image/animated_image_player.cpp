@@ -52,7 +52,7 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
     auto taskExecutor = context->GetTaskExecutor();
     taskExecutor->PostTask(
         [weak = AceType::WeakClaim(this), index, dstWidth = dstWidth_, dstHeight = dstHeight_, taskExecutor] {
-            ACE_SCOPED_TRACE("decode frame %d", index);
+            ACE_IMAGE_SCOPED_TRACE("decode frame %d", index);
             auto player = weak.Upgrade();
             if (!player) {
                 return;
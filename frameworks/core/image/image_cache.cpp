@@ -15,9 +15,12 @@
 
 #include "core/image/image_cache.h"
 
-
 #include "core/components_ng/image_provider/image_object.h"
+#ifdef USE_ROSEN_DRAWING
+#include "core/components_ng/render/drawing.h"
+#endif
 #include "core/image/image_object.h"
+#include "core/image/sk_image_cache.h"
 
 namespace OHOS::Ace {
 RefPtr<ImageCache> ImageCache::Create()
@@ -25,6 +28,14 @@ RefPtr<ImageCache> ImageCache::Create()
     return MakeRefPtr<ImageCache>();
 }
 
+ImageCache::ImageCache()
+    : imageCache_(DEFAULT_IMAGE_BYTE_LIMIT, 0, IMAGE_SHARD_COUNT), dataCache_(0, DATA_COUNT_LIMIT, DATA_SHARD_COUNT),
+      imgObjCacheNG_(DEFAULT_IMG_OBJ_BYTE_LIMIT, DEFAULT_IMG_OBJ_CAPACITY),
+      imgObjCache_(DEFAULT_IMG_OBJ_BYTE_LIMIT, DEFAULT_IMG_OBJ_CAPACITY)
+{}
+
+ImageCache::~ImageCache() = default;
+
 // TODO: Create a real ImageCache later
 #ifdef FLUTTER_2_5
 class MockImageCache : public ImageCache {
@@ -43,152 +54,139 @@ RefPtr<ImageCache> ImageCache::Create()
 void ImageCache::Purge() {}
 #endif
 
+namespace {
+constexpr size_t BYTES_PER_PIXEL = 4;
+constexpr double IMG_OBJ_TRIM_RATIO = 0.5;
+constexpr double DATA_TRIM_RATIO = 0.5;
+constexpr double IMAGE_TRIM_RATIO = 0.5;
+constexpr int32_t MEMORY_LEVEL_MODERATE = 0;
+constexpr int32_t MEMORY_LEVEL_LOW = 1;
+
+size_t GetCachedImageSize(const std::shared_ptr<CachedImage>& image)
+{
+    if (!image || !image->imagePtr) {
+        return 0;
+    }
+#ifndef USE_ROSEN_DRAWING
+    return static_cast<size_t>(image->imagePtr->width()) * static_cast<size_t>(image->imagePtr->height()) *
+           BYTES_PER_PIXEL;
+#else
+    return static_cast<size_t>(image->imagePtr->GetWidth()) * static_cast<size_t>(image->imagePtr->GetHeight()) *
+           BYTES_PER_PIXEL;
+#endif
+}
+} // namespace
+
 void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image)
 {
-    if (key.empty() || capacity_ == 0) {
+    if (key.empty() || imageCache_.GetCountLimit() == 0) {
         return;
     }
-    std::scoped_lock lock(imageCacheMutex_);
-    CountLimitLRU::CacheWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, image, cacheList_, imageCache_, capacity_);
+    imageCache_.Put(key, image, GetCachedImageSize(image));
 }
 
 std::shared_ptr<CachedImage> ImageCache::GetCacheImage(const std::string& key)
 {
-    std::scoped_lock lock(imageCacheMutex_);
-    return CountLimitLRU::GetCacheObjWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, cacheList_, imageCache_);
+    return imageCache_.Get(key);
 }
 
 void ImageCache::CacheImgObjNG(const std::string& key, const RefPtr<NG::ImageObject>& imgObj)
 {
-    if (key.empty() || imgObjCapacity_ == 0) {
+    if (key.empty() || !imgObj) {
         return;
     }
-    std::scoped_lock lock(imgObjMutex_);
-    CountLimitLRU::CacheWithCountLimitLRU<RefPtr<NG::ImageObject>>(
-        key, imgObj, cacheImgObjListNG_, imgObjCacheNG_, imgObjCapacity_);
+    const auto& data = imgObj->GetData();
+    imgObjCacheNG_.Put(key, imgObj, data ? data->GetSize() : 0);
 }
 
 RefPtr<NG::ImageObject> ImageCache::GetCacheImgObjNG(const std::string& key)
 {
-    std::scoped_lock lock(imgObjMutex_);
-    return CountLimitLRU::GetCacheObjWithCountLimitLRU<RefPtr<NG::ImageObject>>(
-        key, cacheImgObjListNG_, imgObjCacheNG_);
+    return imgObjCacheNG_.Get(key);
 }
 
 void ImageCache::CacheImgObj(const std::string& key, const RefPtr<ImageObject>& imgObj)
 {
-    if (key.empty() || imgObjCapacity_ == 0) {
+    if (key.empty() || !imgObj) {
         return;
     }
-    std::scoped_lock lock(imgObjMutex_);
-    CountLimitLRU::CacheWithCountLimitLRU<RefPtr<ImageObject>>(
-        key, imgObj, cacheImgObjList_, imgObjCache_, imgObjCapacity_);
+    imgObjCache_.Put(key, imgObj, 0);
 }
 
 RefPtr<ImageObject> ImageCache::GetCacheImgObj(const std::string& key)
 {
-    std::scoped_lock lock(imgObjMutex_);
-    return CountLimitLRU::GetCacheObjWithCountLimitLRU<RefPtr<ImageObject>>(key, cacheImgObjList_, imgObjCache_);
+    return imgObjCache_.Get(key);
 }
 
 void ImageCache::CacheImageData(const std::string& key, const RefPtr<NG::ImageData>& imageData)
 {
-    if (key.empty() || !imageData || dataSizeLimit_ == 0) {
+    auto dataSizeLimit = dataCache_.GetByteLimit();
+    if (key.empty() || !imageData || dataSizeLimit == 0) {
         return;
     }
-    std::scoped_lock lock(dataCacheMutex_);
     auto dataSize = imageData->GetSize();
-    if (dataSize > (dataSizeLimit_ >> 1)) { // if data is longer than half limit, do not cache it.
+    if (dataSize > (dataSizeLimit >> 1)) { // if data is longer than half limit, do not cache it.
         LOGW("data is %{public}d, bigger than half limit %{public}d, do not cache it", static_cast<int32_t>(dataSize),
-            static_cast<int32_t>(dataSizeLimit_ >> 1));
+            static_cast<int32_t>(dataSizeLimit >> 1));
+        dataCache_.Erase(key);
         return;
     }
-    auto iter = imageDataCache_.find(key);
-    if (iter == imageDataCache_.end()) {
-        if (!ProcessImageDataCacheInner(dataSize)) {
-            return;
-        }
-        dataCacheList_.emplace_front(key, imageData);
-        imageDataCache_.emplace(key, dataCacheList_.begin());
-    } else {
-        auto oldSize = iter->second->cacheObj->GetSize();
-        if (oldSize != dataSize) {
-            curDataSize_ -= oldSize;
-            if (!ProcessImageDataCacheInner(dataSize)) {
-                return;
-            }
-        }
-        iter->second->cacheObj = imageData;
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-    }
+    dataCache_.Put(key, imageData, dataSize);
 }
 
-bool ImageCache::ProcessImageDataCacheInner(size_t dataSize)
+RefPtr<NG::ImageData> ImageCache::GetCacheImageData(const std::string& key)
 {
-    while (dataSize + curDataSize_ > dataSizeLimit_ && !dataCacheList_.empty()) {
-        curDataSize_ -= dataCacheList_.back().cacheObj->GetSize();
-        imageDataCache_.erase(dataCacheList_.back().cacheKey);
-        dataCacheList_.pop_back();
-    }
-    if (dataSize + curDataSize_ > dataSizeLimit_) {
-        return false;
-    }
-    curDataSize_ += dataSize;
-    return true;
+    return dataCache_.Get(key);
 }
 
-RefPtr<NG::ImageData> ImageCache::GetCacheImageData(const std::string& key)
+void ImageCache::ClearCacheImage(const std::string& key)
 {
-    std::scoped_lock lock(dataCacheMutex_);
-    auto iter = imageDataCache_.find(key);
-    if (iter != imageDataCache_.end()) {
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-        return iter->second->cacheObj;
-    }
-    return nullptr;
+    imageCache_.Erase(key);
+    dataCache_.Erase(key);
 }
 
-void ImageCache::ClearCacheImage(const std::string& key)
+void ImageCache::SetDataCacheLimit(size_t sizeLimit)
 {
-    {
-        std::scoped_lock lock(imageCacheMutex_);
-        auto iter = imageCache_.find(key);
-        if (iter != imageCache_.end()) {
-            cacheList_.erase(iter->second);
-            imageCache_.erase(iter);
-        }
-    }
+    LOGI("Set data size cache limit : %{public}d", static_cast<int32_t>(sizeLimit));
+    dataCache_.SetByteLimit(sizeLimit);
+}
 
-    {
-        std::scoped_lock lock(dataCacheMutex_);
-        auto iter = imageDataCache_.find(key);
-        if (iter != imageDataCache_.end()) {
-            dataCacheList_.erase(iter->second);
-            imageDataCache_.erase(iter);
-        }
+void ImageCache::NotifyMemoryLevel(int32_t level)
+{
+    LOGI("image cache trim on memory level %{public}d, %{public}s", level, GetMetrics().c_str());
+    if (level <= MEMORY_LEVEL_MODERATE) {
+        imgObjCacheNG_.Trim(IMG_OBJ_TRIM_RATIO);
+        imgObjCache_.Trim(IMG_OBJ_TRIM_RATIO);
+        return;
+    }
+    imgObjCacheNG_.Clear();
+    imgObjCache_.Clear();
+    if (level == MEMORY_LEVEL_LOW) {
+        dataCache_.Trim(DATA_TRIM_RATIO);
+        imageCache_.Trim(IMAGE_TRIM_RATIO);
+        return;
     }
+    dataCache_.Clear();
+    imageCache_.Clear();
+}
+
+std::string ImageCache::GetMetrics() const
+{
+    return std::string("image: [")
+        .append(imageCache_.GetMetrics().ToString())
+        .append("], data: [")
+        .append(dataCache_.GetMetrics().ToString())
+        .append("], imgObjNG: [")
+        .append(imgObjCacheNG_.GetMetrics().ToString())
+        .append("], imgObj: [")
+        .append(imgObjCache_.GetMetrics().ToString())
+        .append("]");
 }
 
 void ImageCache::Clear()
 {
-    {
-        std::scoped_lock lock(imageCacheMutex_);
-        cacheList_.clear();
-        imageCache_.clear();
-    }
-    {
-        std::scoped_lock lock(dataCacheMutex_);
-        dataCacheList_.clear();
-        imageDataCache_.clear();
-    }
-    {
-        std::scoped_lock lock(imgObjMutex_);
-        cacheImgObjListNG_.clear();
-        imgObjCacheNG_.clear();
-        cacheImgObjList_.clear();
-        imgObjCache_.clear();
-    }
+    imageCache_.Clear();
+    dataCache_.Clear();
+    imgObjCacheNG_.Clear();
+    imgObjCache_.Clear();
 }
 } // namespace OHOS::Ace
@@ -17,17 +17,14 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_CACHE_H
 
 #include <algorithm>
-#include <list>
 #include <mutex>
-#include <shared_mutex>
-#include <unordered_map>
+#include <string>
 #include <utility>
-#include <vector>
 
 #include "base/memory/ace_type.h"
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
-#include "core/common/lru/count_limit_lru.h"
+#include "core/common/lru/gdsf_cache.h"
 
 namespace OHOS::Ace {
     
@@ -39,13 +36,24 @@ class ImageObject;
 class ImageData;
 } // namespace NG
 
+// ImageCache keeps four tiers: decoded images, raw image data, and the NG and legacy image objects. Every tier is
+// bounded by bytes as well as by count and evicts size-aware, so a few huge images can no longer push the memory
+// over budget and many small ones are not thrown out by a single large one.
 class ACE_EXPORT ImageCache : public AceType {
     DECLARE_ACE_TYPE(ImageCache, AceType);
 
 public:
+    static constexpr size_t DEFAULT_IMAGE_BYTE_LIMIT = 100 * 1024 * 1024;
+    static constexpr size_t DEFAULT_IMG_OBJ_BYTE_LIMIT = 50 * 1024 * 1024;
+    static constexpr size_t DEFAULT_IMG_OBJ_CAPACITY = 2000;
+    static constexpr size_t DATA_COUNT_LIMIT = 10000;
+    // raw data is only put from the loading threads, fewer shards are enough for it.
+    static constexpr size_t DATA_SHARD_COUNT = 2;
+    static constexpr size_t IMAGE_SHARD_COUNT = 4;
+
     static RefPtr<ImageCache> Create();
-    ImageCache() = default;
-    ~ImageCache() override = default;
+    ImageCache();
+    ~ImageCache() override;
 
     void CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image);
     std::shared_ptr<CachedImage> GetCacheImage(const std::string& key);
@@ -59,56 +67,48 @@ public:
     void CacheImgObj(const std::string& key, const RefPtr<ImageObject>& imgObj);
     RefPtr<ImageObject> GetCacheImgObj(const std::string& key);
 
+    // count limit of decoded images, 0 disables the tier.
     void SetCapacity(size_t capacity)
     {
         LOGI("Set Capacity : %{public}d", static_cast<int32_t>(capacity));
-        capacity_ = capacity;
+        imageCache_.SetCountLimit(capacity);
     }
 
-    void SetDataCacheLimit(size_t sizeLimit)
+    // defined out of line, the data tier must not be instantiated where ImageData is incomplete.
+    void SetDataCacheLimit(size_t sizeLimit);
+
+    void SetImageByteLimit(size_t byteLimit)
     {
-        LOGI("Set data size cache limit : %{public}d", static_cast<int32_t>(sizeLimit));
-        dataSizeLimit_ = sizeLimit;
+        imageCache_.SetByteLimit(byteLimit);
     }
 
     size_t GetCapacity() const
     {
-        return capacity_;
+        return imageCache_.GetCountLimit();
     }
 
     size_t GetCachedImageCount() const
     {
-        std::lock_guard<std::mutex> lock(imageCacheMutex_);
-        return cacheList_.size();
+        return imageCache_.GetCount();
     }
 
+    // Trims the tiers cheapest to rebuild first: image objects, then raw data, then decoded images.
+    // |level| follows the system memory level, 0 moderate, 1 low and 2 critical.
+    void NotifyMemoryLevel(int32_t level);
+    std::string GetMetrics() const;
+
     void Clear();
     static void Purge();
 
     void ClearCacheImage(const std::string& key);
 
 private:
-    bool ProcessImageDataCacheInner(size_t dataSize);
-
-    std::atomic<size_t> capacity_ = 0; // by default memory cache can store 0 images.
-    mutable std::mutex imageCacheMutex_;
-    std::list<CacheNode<std::shared_ptr<CachedImage>>> cacheList_;
-    std::unordered_map<std::string, std::list<CacheNode<std::shared_ptr<CachedImage>>>::iterator> imageCache_;
-
-    std::mutex dataCacheMutex_;
-    std::list<CacheNode<RefPtr<NG::ImageData>>> dataCacheList_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<NG::ImageData>>>::iterator> imageDataCache_;
-
-    std::atomic<size_t> dataSizeLimit_ = 0; // by default, image data before decoded cache is 0 MB.;
-    std::atomic<size_t> curDataSize_ = 0;
-
-    std::mutex imgObjMutex_;
-    std::atomic<size_t> imgObjCapacity_ = 2000; // imgObj is cached after clear image data.
-
-    std::list<CacheNode<RefPtr<NG::ImageObject>>> cacheImgObjListNG_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<NG::ImageObject>>>::iterator> imgObjCacheNG_;
-    std::list<CacheNode<RefPtr<ImageObject>>> cacheImgObjList_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<ImageObject>>>::iterator> imgObjCache_;
+    // tiers are constructed in image_cache.cpp where the cached types are complete.
+    GDSFCache<std::shared_ptr<CachedImage>> imageCache_;
+    GDSFCache<RefPtr<NG::ImageData>> dataCache_;
+    GDSFCache<RefPtr<NG::ImageObject>> imgObjCacheNG_;
+    // legacy image objects do not expose their size, they are bounded by count only.
+    GDSFCache<RefPtr<ImageObject>> imgObjCache_;
 
     ACE_DISALLOW_COPY_AND_MOVE(ImageCache);
 };
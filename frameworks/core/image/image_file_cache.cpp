@@ -14,10 +14,18 @@
  */
 #include "core/image/image_file_cache.h"
 
+#include <algorithm>
+#include <cstring>
 #include <dirent.h>
 #include <fstream>
 #include <sys/stat.h>
+#ifndef WINDOWS_PLATFORM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
+#include "base/thread/background_task_executor.h"
 #include "core/image/image_loader.h"
 #include "core/image/image_source_info.h"
 
@@ -26,6 +34,68 @@
 #endif
 
 namespace OHOS::Ace {
+namespace {
+constexpr char INDEX_FILE_NAME[] = ".image_cache_index"; // skipped by the directory scan as a hidden file
+constexpr uint32_t INDEX_MAGIC = 0x58494349;             // "ICIX"
+constexpr uint32_t INDEX_VERSION = 2;
+constexpr size_t MAX_WRITE_BATCH = 16;
+constexpr size_t MIN_ACCESS_RECORD_COUNT = 64;
+constexpr size_t MIN_INDEX_RECORD_COUNT = 64;
+
+struct IndexHeader {
+    uint32_t magic = INDEX_MAGIC;
+    uint32_t version = INDEX_VERSION;
+};
+
+enum class IndexRecordType : uint8_t {
+    ADD = 0,
+    REMOVE,
+};
+
+template<typename T>
+void AppendValue(std::vector<uint8_t>& buffer, const T& value)
+{
+    auto bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// index record: IndexRecordType type, uint64_t fileSize, int64_t accessTime, uint32_t pathLength, path.
+void AppendRecord(std::vector<uint8_t>& buffer, IndexRecordType type, const std::string& filePath,
+    size_t fileSize = 0, time_t accessTime = 0)
+{
+    AppendValue(buffer, type);
+    AppendValue(buffer, static_cast<uint64_t>(fileSize));
+    AppendValue(buffer, static_cast<int64_t>(accessTime));
+    AppendValue(buffer, static_cast<uint32_t>(filePath.size()));
+    buffer.insert(buffer.end(), filePath.begin(), filePath.end());
+}
+
+template<typename T>
+bool ReadValue(const uint8_t*& cursor, const uint8_t* end, T& value)
+{
+    if (static_cast<size_t>(end - cursor) < sizeof(T)) {
+        return false;
+    }
+    memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+bool WriteFile(const std::string& filePath, const void* data, size_t size)
+{
+#ifdef WINDOWS_PLATFORM
+    std::ofstream outFile(filePath, std::ios::binary);
+#else
+    std::ofstream outFile(filePath, std::fstream::out);
+#endif
+    if (!outFile.is_open()) {
+        return false;
+    }
+    outFile.write(reinterpret_cast<const char*>(data), size);
+    return outFile.good();
+}
+} // namespace
+
 ImageFileCache::ImageFileCache() = default;
 ImageFileCache::~ImageFileCache() = default;
 
@@ -79,13 +149,42 @@ void ImageFileCache::SetClearCacheFileRatio(float clearRatio)
 
 RefPtr<NG::ImageData> ImageFileCache::GetDataFromCacheFile(const std::string& filePath)
 {
-    std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
-    if (!GetFromCacheFileInner(filePath)) {
-        LOGD("file not cached, return nullptr");
-        return nullptr;
+    {
+        std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+        auto pending = pendingFiles_.find(filePath);
+        if (pending != pendingFiles_.end()) {
+            return pending->second;
+        }
+        if (!GetFromCacheFileInner(filePath)) {
+            LOGD("file not cached, return nullptr");
+            return nullptr;
+        }
     }
+    // the loader maps the file instead of copying it.
     auto cacheFileLoader = AceType::MakeRefPtr<FileImageLoader>();
     auto rsData = cacheFileLoader->LoadImageData(ImageSourceInfo(std::string("file:/").append(filePath)));
+    if (!rsData) {
+        LOGW("cache file lost, remove it from index %{private}s", filePath.c_str());
+        std::vector<uint8_t> index;
+        {
+            std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+            auto iter = cacheFileInfo_.find(filePath);
+            if (iter == cacheFileInfo_.end()) {
+                return nullptr;
+            }
+            cacheFileSize_ -= static_cast<int64_t>(iter->second.fileSize);
+            cacheFileInfo_.erase(iter);
+            AppendRecord(index, IndexRecordType::REMOVE, filePath);
+            ++indexRecordCount_;
+        }
+        // the flush task writes the index as well, while it runs the record is left to the next rewrite.
+        std::unique_lock<std::mutex> flushLock(flushMutex_, std::try_to_lock);
+        if (!flushLock.owns_lock() || !AppendIndexFile(index)) {
+            std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+            indexDirty_ = true;
+        }
+        return nullptr;
+    }
 #ifndef USE_ROSEN_DRAWING
     return NG::ImageData::MakeFromDataWrapper(&rsData);
 #else
@@ -101,48 +200,102 @@ void ImageFileCache::WriteCacheFile(
             static_cast<int32_t>(fileLimit_));
         return;
     }
-    std::vector<std::string> removeVector;
     std::string cacheNetworkFilePath = GetImageCacheFilePath(url) + suffix;
-
-    std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
-    // 1. first check if file has been cached.
-    if (GetFromCacheFileInner(cacheNetworkFilePath)) {
-        LOGI("file has been wrote %{private}s", cacheNetworkFilePath.c_str());
-        return;
+    {
+        std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+        // 1. first check if file has been cached.
+        if (pendingFiles_.count(cacheNetworkFilePath) > 0 || GetFromCacheFileInner(cacheNetworkFilePath)) {
+            LOGI("file has been wrote %{private}s", cacheNetworkFilePath.c_str());
+            return;
+        }
     }
+    auto imageData = NG::ImageData::MakeFromDataWithCopy(data, size);
+    CHECK_NULL_VOID(imageData);
 
-    // 2. if not in dist, write file into disk.
-#ifdef WINDOWS_PLATFORM
-    std::ofstream outFile(cacheNetworkFilePath, std::ios::binary);
-#else
-    std::ofstream outFile(cacheNetworkFilePath, std::fstream::out);
-#endif
-    if (!outFile.is_open()) {
-        LOGW("open cache file failed, cannot write.");
-        return;
+    // 2. queue the file, it is written into disk by a background task.
+    {
+        std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+        if (cacheFileInfo_.count(cacheNetworkFilePath) > 0 ||
+            !pendingFiles_.emplace(cacheNetworkFilePath, imageData).second) {
+            return;
+        }
+        pendingQueue_.emplace_back(cacheNetworkFilePath);
+        if (flushScheduled_) {
+            return;
+        }
+        flushScheduled_ = true;
     }
-    outFile.write(reinterpret_cast<const char*>(data), size);
     LOGI("write image cache: %{public}s %{private}s", url.c_str(), cacheNetworkFilePath.c_str());
+    if (!BackgroundTaskExecutor::GetInstance().PostTask([this]() { FlushCacheFile(); }, BgTaskPriority::LOW)) {
+        FlushCacheFile();
+    }
+}
 
-    cacheFileSize_ += size;
-    cacheFileInfo_.emplace_back(cacheNetworkFilePath, size, time(nullptr));
-    // check if cache files too big.
-    if (cacheFileSize_ > static_cast<int32_t>(fileLimit_)) {
-        auto removeCount = static_cast<int32_t>(cacheFileInfo_.size() * clearCacheFileRatio_);
-        int32_t removeSize = 0;
-        auto iter = cacheFileInfo_.begin();
-        int32_t count = 0;
-        while (count < removeCount) {
-            removeSize += static_cast<int32_t>(iter->fileSize);
-            removeVector.push_back(iter->filePath);
-            ++iter;
-            ++count;
+void ImageFileCache::FlushCacheFile()
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    while (true) {
+        std::vector<std::pair<std::string, RefPtr<NG::ImageData>>> batch;
+        {
+            std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+            while (!pendingQueue_.empty() && batch.size() < MAX_WRITE_BATCH) {
+                auto iter = pendingFiles_.find(pendingQueue_.front());
+                if (iter != pendingFiles_.end()) {
+                    batch.emplace_back(*iter);
+                }
+                pendingQueue_.pop_front();
+            }
+            if (batch.empty()) {
+                flushScheduled_ = false;
+                return;
+            }
+        }
+
+        std::vector<bool> written(batch.size(), false);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const auto& [filePath, imageData] = batch[i];
+            written[i] = WriteFile(filePath, imageData->GetData(), imageData->GetSize());
+            if (!written[i]) {
+                LOGW("open cache file failed, cannot write.");
+            }
+        }
+
+        std::vector<std::string> removeVector;
+        std::vector<uint8_t> index;
+        bool rewriteIndex = false;
+        {
+            std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+            auto now = time(nullptr);
+            for (size_t i = 0; i < batch.size(); ++i) {
+                pendingFiles_.erase(batch[i].first);
+                if (written[i]) {
+                    AddFileInfoInner(FileInfo(batch[i].first, batch[i].second->GetSize(), now));
+                    AppendRecord(index, IndexRecordType::ADD, batch[i].first, batch[i].second->GetSize(), now);
+                    ++indexRecordCount_;
+                }
+            }
+            // check if cache files too big.
+            ClearCacheFileInner(removeVector);
+            for (const auto& filePath : removeVector) {
+                AppendRecord(index, IndexRecordType::REMOVE, filePath);
+                ++indexRecordCount_;
+            }
+            // the records of removed files are dropped by rewriting the index once they outnumber the files.
+            rewriteIndex =
+                indexDirty_ || indexRecordCount_ > std::max(cacheFileInfo_.size() * 2, MIN_INDEX_RECORD_COUNT);
+            if (rewriteIndex) {
+                index = SerializeIndexInner();
+                indexRecordCount_ = cacheFileInfo_.size();
+                indexDirty_ = false;
+            }
+        }
+        // clear files removed from cache list.
+        ClearCacheFile(removeVector);
+        if (rewriteIndex ? !WriteIndexFile(index) : !AppendIndexFile(index)) {
+            std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+            indexDirty_ = true;
         }
-        cacheFileInfo_.erase(cacheFileInfo_.begin(), iter);
-        cacheFileSize_ -= static_cast<int32_t>(removeSize);
     }
-    // 3. clear files removed from cache list.
-    ClearCacheFile(removeVector);
 }
 
 void ImageFileCache::ClearCacheFile(const std::vector<std::string>& removeFiles)
@@ -159,21 +312,71 @@ void ImageFileCache::ClearCacheFile(const std::vector<std::string>& removeFiles)
 bool ImageFileCache::GetFromCacheFile(const std::string& filePath)
 {
     std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
-    return GetFromCacheFileInner(filePath);
+    return pendingFiles_.count(filePath) > 0 || GetFromCacheFileInner(filePath);
 }
 
 bool ImageFileCache::GetFromCacheFileInner(const std::string& filePath)
 {
-    auto iter = std::find_if(cacheFileInfo_.begin(), cacheFileInfo_.end(),
-        [&filePath](const FileInfo& fileInfo) { return fileInfo.filePath == filePath; });
+    auto iter = cacheFileInfo_.find(filePath);
     if (iter == cacheFileInfo_.end()) {
         return false;
     }
-    iter->accessTime = time(nullptr);
-    cacheFileInfo_.splice(cacheFileInfo_.end(), cacheFileInfo_, iter);
+    iter->second.accessTime = time(nullptr);
+    iter->second.accessSeq = ++accessSeq_;
+    accessRecords_.emplace(iter->second.accessSeq, filePath);
+    // drop outdated records once they outnumber the files.
+    if (accessRecords_.size() > std::max(cacheFileInfo_.size() * 2, MIN_ACCESS_RECORD_COUNT)) {
+        std::vector<AccessRecord> records;
+        records.reserve(cacheFileInfo_.size());
+        for (const auto& [path, fileInfo] : cacheFileInfo_) {
+            records.emplace_back(fileInfo.accessSeq, path);
+        }
+        accessRecords_ = decltype(accessRecords_)(std::greater<AccessRecord>(), std::move(records));
+    }
     return true;
 }
 
+void ImageFileCache::AddFileInfoInner(FileInfo&& fileInfo)
+{
+    fileInfo.accessSeq = ++accessSeq_;
+    accessRecords_.emplace(fileInfo.accessSeq, fileInfo.filePath);
+    cacheFileSize_ += static_cast<int64_t>(fileInfo.fileSize);
+    auto filePath = fileInfo.filePath;
+    cacheFileInfo_.insert_or_assign(std::move(filePath), std::move(fileInfo));
+}
+
+void ImageFileCache::RebuildFileInfoInner(std::vector<FileInfo>&& fileInfos)
+{
+    std::stable_sort(fileInfos.begin(), fileInfos.end());
+    cacheFileInfo_.clear();
+    accessRecords_ = decltype(accessRecords_)();
+    cacheFileSize_ = 0;
+    cacheFileInfo_.reserve(fileInfos.size());
+    for (auto& fileInfo : fileInfos) {
+        AddFileInfoInner(std::move(fileInfo));
+    }
+}
+
+void ImageFileCache::ClearCacheFileInner(std::vector<std::string>& removeFiles)
+{
+    if (cacheFileSize_ <= static_cast<int64_t>(fileLimit_)) {
+        return;
+    }
+    auto removeCount = static_cast<size_t>(cacheFileInfo_.size() * clearCacheFileRatio_);
+    while (removeCount > 0 && !accessRecords_.empty()) {
+        auto record = accessRecords_.top();
+        accessRecords_.pop();
+        auto iter = cacheFileInfo_.find(record.second);
+        if (iter == cacheFileInfo_.end() || iter->second.accessSeq != record.first) {
+            continue;
+        }
+        cacheFileSize_ -= static_cast<int64_t>(iter->second.fileSize);
+        removeFiles.emplace_back(std::move(record.second));
+        cacheFileInfo_.erase(iter);
+        --removeCount;
+    }
+}
+
 void ImageFileCache::SetCacheFileInfo()
 {
     std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
@@ -182,29 +385,174 @@ void ImageFileCache::SetCacheFileInfo()
         return;
     }
     std::string cacheFilePath = GetImageCacheFilePath();
+    // the directory is listed even with an index, to find the files written after its last record.
+    std::unordered_map<std::string, FileInfo> indexedFiles;
+    if (!LoadIndexFile(cacheFilePath, indexedFiles)) {
+        indexedFiles.clear();
+        indexDirty_ = true;
+    }
+    if (!ScanCacheFilePath(cacheFilePath, std::move(indexedFiles))) {
+        return;
+    }
+    hasSetCacheFileInfo_ = true;
+}
+
+bool ImageFileCache::LoadIndexFile(
+    const std::string& cacheFilePath, std::unordered_map<std::string, FileInfo>& indexedFiles)
+{
+    if (cacheFilePath.empty()) {
+        return false;
+    }
+    std::string indexFilePath = cacheFilePath + "/" + INDEX_FILE_NAME;
+#ifndef WINDOWS_PLATFORM
+    int32_t fd = open(indexFilePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStatus;
+    if (fstat(fd, &fileStatus) != 0 || fileStatus.st_size < static_cast<off_t>(sizeof(IndexHeader))) {
+        close(fd);
+        return false;
+    }
+    auto size = static_cast<size_t>(fileStatus.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    bool result = ParseIndexFile(static_cast<const uint8_t*>(addr), size, indexedFiles);
+    munmap(addr, size);
+#else
+    std::ifstream inFile(indexFilePath, std::ios::binary);
+    if (!inFile.is_open()) {
+        return false;
+    }
+    std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+    bool result = ParseIndexFile(buffer.data(), buffer.size(), indexedFiles);
+#endif
+    if (!result) {
+        LOGW("image cache index is broken, scan cache file path instead.");
+    }
+    return result;
+}
+
+bool ImageFileCache::ParseIndexFile(
+    const uint8_t* data, size_t size, std::unordered_map<std::string, FileInfo>& indexedFiles)
+{
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    IndexHeader header;
+    if (!ReadValue(cursor, end, header) || header.magic != INDEX_MAGIC || header.version != INDEX_VERSION) {
+        return false;
+    }
+    indexRecordCount_ = 0;
+    while (cursor < end) {
+        IndexRecordType type = IndexRecordType::ADD;
+        uint64_t fileSize = 0;
+        int64_t accessTime = 0;
+        uint32_t pathLength = 0;
+        if (!ReadValue(cursor, end, type) || !ReadValue(cursor, end, fileSize) || !ReadValue(cursor, end, accessTime) ||
+            !ReadValue(cursor, end, pathLength) || static_cast<size_t>(end - cursor) < pathLength) {
+            // a record cut by a crash, the directory scan finds the file it was written for.
+            indexDirty_ = true;
+            break;
+        }
+        std::string filePath(reinterpret_cast<const char*>(cursor), pathLength);
+        cursor += pathLength;
+        ++indexRecordCount_;
+        if (type == IndexRecordType::REMOVE) {
+            indexedFiles.erase(filePath);
+            continue;
+        }
+        indexedFiles.insert_or_assign(
+            filePath, FileInfo(filePath, static_cast<size_t>(fileSize), static_cast<time_t>(accessTime)));
+    }
+    return true;
+}
+
+bool ImageFileCache::ScanCacheFilePath(
+    const std::string& cacheFilePath, std::unordered_map<std::string, FileInfo>&& indexedFiles)
+{
     std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(cacheFilePath.c_str()), closedir);
     if (dir == nullptr) {
         LOGW("cache file path wrong! maybe it is not set.");
-        return;
+        return false;
     }
-    int64_t cacheFileSize = 0;
+    std::vector<FileInfo> fileInfos;
+    fileInfos.reserve(indexedFiles.size());
     dirent* filePtr = readdir(dir.get());
     while (filePtr != nullptr) {
-        // skip . or ..
+        // skip . or .. and the index file
         if (filePtr->d_name[0] != '.') {
             std::string filePath = cacheFilePath + "/" + std::string(filePtr->d_name);
-            struct stat fileStatus;
-            if (stat(filePath.c_str(), &fileStatus) == -1) {
+            auto iter = indexedFiles.find(filePath);
+            if (iter != indexedFiles.end()) {
+                fileInfos.emplace_back(std::move(iter->second));
+                indexedFiles.erase(iter);
                 filePtr = readdir(dir.get());
                 continue;
             }
-            cacheFileInfo_.emplace_back(filePath, fileStatus.st_size, fileStatus.st_atime);
-            cacheFileSize += static_cast<int64_t>(fileStatus.st_size);
+            // a file missing from the index, written before a crash or without an index.
+            struct stat fileStatus;
+            if (stat(filePath.c_str(), &fileStatus) == 0) {
+                fileInfos.emplace_back(filePath, fileStatus.st_size, fileStatus.st_atime);
+                indexDirty_ = true;
+            }
         }
         filePtr = readdir(dir.get());
     }
-    cacheFileInfo_.sort();
-    cacheFileSize_ = cacheFileSize;
-    hasSetCacheFileInfo_ = true;
+    // files left in the index are gone from the directory.
+    if (!indexedFiles.empty()) {
+        indexDirty_ = true;
+    }
+    RebuildFileInfoInner(std::move(fileInfos));
+    return true;
+}
+
+std::vector<uint8_t> ImageFileCache::SerializeIndexInner() const
+{
+    std::vector<uint8_t> index;
+    AppendValue(index, IndexHeader());
+    for (const auto& [filePath, fileInfo] : cacheFileInfo_) {
+        AppendRecord(index, IndexRecordType::ADD, filePath, fileInfo.fileSize, fileInfo.accessTime);
+    }
+    return index;
+}
+
+bool ImageFileCache::WriteIndexFile(const std::vector<uint8_t>& index)
+{
+    std::string cacheFilePath = GetImageCacheFilePath();
+    if (cacheFilePath.empty()) {
+        return false;
+    }
+    // write a temporary file and rename it, a crash never leaves a half written index behind.
+    std::string indexFilePath = cacheFilePath + "/" + INDEX_FILE_NAME;
+    std::string tempFilePath = indexFilePath + ".tmp";
+    if (!WriteFile(tempFilePath, index.data(), index.size()) ||
+        rename(tempFilePath.c_str(), indexFilePath.c_str()) != 0) {
+        LOGW("write image cache index failed.");
+        remove(tempFilePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool ImageFileCache::AppendIndexFile(const std::vector<uint8_t>& records)
+{
+    if (records.empty()) {
+        return true;
+    }
+    std::string cacheFilePath = GetImageCacheFilePath();
+    if (cacheFilePath.empty()) {
+        return false;
+    }
+    // access times are only saved when the index is rewritten, the order of writes is close enough after a restart.
+    std::ofstream outFile(cacheFilePath + "/" + INDEX_FILE_NAME, std::ios::binary | std::ios::app);
+    if (!outFile.is_open()) {
+        LOGW("append image cache index failed.");
+        return false;
+    }
+    outFile.write(reinterpret_cast<const char*>(records.data()), records.size());
+    return outFile.good();
 }
 } // namespace OHOS::Ace
@@ -15,9 +15,13 @@
 
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_FILE_CACHE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_FILE_CACHE_H
-#include <list>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <mutex>
+#include <queue>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -38,8 +42,14 @@ struct FileInfo {
     std::string filePath;
     size_t fileSize;
     time_t accessTime;
+    // order of the last access, files with the smallest one are cleared first.
+    uint64_t accessSeq = 0;
 };
 
+// ImageFileCache keeps network images on disk, one file per url. The file list is indexed by path and persisted in
+// an index file next to the cache files, so startup only lists the directory instead of reading the status of every
+// file. Files are written by a background task in batches, the data stays readable from memory until it is on disk.
+// Each batch appends its records to the index, which is rewritten once outdated records outnumber the files.
 class ImageFileCache : public Singleton<ImageFileCache> {
     DECLARE_SINGLETON(ImageFileCache);
     ACE_DISALLOW_MOVE(ImageFileCache);
@@ -51,6 +61,7 @@ public:
     void SetCacheFileLimit(size_t cacheFileLimit);
     void SetClearCacheFileRatio(float clearRatio);
 
+    // Returns true if the file is on disk or queued to be written.
     bool GetFromCacheFile(const std::string& filePath);
 
     RefPtr<NG::ImageData> GetDataFromCacheFile(const std::string& filePath);
@@ -58,9 +69,22 @@ public:
     void SetCacheFileInfo();
     void WriteCacheFile(
         const std::string& url, const void* data, size_t size, const std::string& suffix = std::string());
+    // Writes all pending files and the index on the calling thread.
+    void FlushCacheFile();
     void ClearCacheFile(const std::vector<std::string>& removeFiles);
 private:
+    using AccessRecord = std::pair<uint64_t, std::string>;
+
     bool GetFromCacheFileInner(const std::string& filePath);
+    void AddFileInfoInner(FileInfo&& fileInfo);
+    void RebuildFileInfoInner(std::vector<FileInfo>&& fileInfos);
+    void ClearCacheFileInner(std::vector<std::string>& removeFiles);
+    bool LoadIndexFile(const std::string& cacheFilePath, std::unordered_map<std::string, FileInfo>& indexedFiles);
+    bool ParseIndexFile(const uint8_t* data, size_t size, std::unordered_map<std::string, FileInfo>& indexedFiles);
+    bool ScanCacheFilePath(const std::string& cacheFilePath, std::unordered_map<std::string, FileInfo>&& indexedFiles);
+    std::vector<uint8_t> SerializeIndexInner() const;
+    bool WriteIndexFile(const std::vector<uint8_t>& index);
+    bool AppendIndexFile(const std::vector<uint8_t>& records);
 
     std::shared_mutex cacheFilePathMutex_;
     std::string cacheFilePath_;
@@ -69,12 +93,22 @@ private:
 
     std::atomic<float> clearCacheFileRatio_ = 0.5f; // default clear ratio is 0.5
 
-    std::mutex cacheFileSizeMutex_;
-    int64_t cacheFileSize_ = 0;
-
     std::mutex cacheFileInfoMutex_;
-    std::list<FileInfo> cacheFileInfo_;
+    int64_t cacheFileSize_ = 0;
+    std::unordered_map<std::string, FileInfo> cacheFileInfo_;
+    // min-heap of (accessSeq, filePath), records whose accessSeq is outdated are skipped when clearing.
+    std::priority_queue<AccessRecord, std::vector<AccessRecord>, std::greater<AccessRecord>> accessRecords_;
+    uint64_t accessSeq_ = 0;
     bool hasSetCacheFileInfo_ = false;
+    // records in the index file, and whether it misses some files and has to be rewritten.
+    size_t indexRecordCount_ = 0;
+    bool indexDirty_ = true;
+
+    // files waiting to be written by the background task.
+    std::unordered_map<std::string, RefPtr<NG::ImageData>> pendingFiles_;
+    std::deque<std::string> pendingQueue_;
+    bool flushScheduled_ = false;
+    std::mutex flushMutex_;
 };
 } // namespace OHOS::Ace
 #endif // FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_FILE_CACHE_H
\ No newline at end of file
@@ -163,29 +163,18 @@ std::shared_ptr<RSData> ImageLoader::LoadDataFromCachedFile(const std::string& u
             AceLogTag::ACE_IMAGE, "cache file path is too long, cacheFilePath: %{private}s", cacheFilePath.c_str());
         return nullptr;
     }
-    bool cacheFileFound = ImageFileCache::GetInstance().GetFromCacheFile(cacheFilePath);
-    if (!cacheFileFound) {
-        return nullptr;
-    }
-    char realPath[PATH_MAX] = { 0x00 };
-    if (realpath(cacheFilePath.c_str(), realPath) == nullptr) {
-        TAG_LOGW(AceLogTag::ACE_IMAGE, "realpath fail! cacheFilePath: %{private}s, fail reason: %{public}s",
-            cacheFilePath.c_str(), strerror(errno));
-        return nullptr;
-    }
-    std::unique_ptr<FILE, decltype(&fclose)> file(fopen(realPath, "rb"), fclose);
-    if (file) {
+    // files still queued for writing are read from memory, the others are mapped.
+    auto cacheData = ImageFileCache::GetInstance().GetDataFromCacheFile(cacheFilePath);
+    CHECK_NULL_RETURN(cacheData, nullptr);
 #ifndef USE_ROSEN_DRAWING
-        return SkData::MakeFromFILE(file.get());
+    const auto* skData = reinterpret_cast<const sk_sp<SkData>*>(cacheData->GetDataWrapper());
+    CHECK_NULL_RETURN(skData, nullptr);
+    return *skData;
 #else
-        auto skData = SkData::MakeFromFILE(file.get());
-        CHECK_NULL_RETURN(skData, nullptr);
-        auto rsData = std::make_shared<RSData>();
-        rsData->GetImpl<Rosen::Drawing::SkiaData>()->SetSkData(skData);
-        return rsData;
+    auto rosenCachedImageData = AceType::DynamicCast<NG::DrawingImageData>(cacheData);
+    CHECK_NULL_RETURN(rosenCachedImageData, nullptr);
+    return rosenCachedImageData->GetRSData();
 #endif
-    }
-    return nullptr;
 }
 
 #ifndef USE_ROSEN_DRAWING
@@ -221,7 +210,7 @@ void ImageLoader::CacheImageData(const std::string& key, const RefPtr<NG::ImageD
 
 RefPtr<NG::ImageData> ImageLoader::LoadImageDataFromFileCache(const std::string& key, const std::string& suffix)
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     auto* fileCache = &ImageFileCache::GetInstance();
     std::string filePath = fileCache->GetImageCacheFilePath(key) + suffix;
     auto data = fileCache->GetDataFromCacheFile(filePath);
@@ -231,7 +220,7 @@ RefPtr<NG::ImageData> ImageLoader::LoadImageDataFromFileCache(const std::string&
 // NG ImageLoader entrance
 RefPtr<NG::ImageData> ImageLoader::GetImageData(const ImageSourceInfo& src, const WeakPtr<PipelineBase>& context)
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     if (src.IsPixmap()) {
         return LoadDecodedImageData(src, context);
     }
@@ -277,7 +266,7 @@ std::shared_ptr<RSData> FileImageLoader::LoadImageData(
     const ImageSourceInfo& imageSourceInfo, const WeakPtr<PipelineBase>& /* context */)
 #endif
 {
-    ACE_SCOPED_TRACE("LoadImageData %s", imageSourceInfo.ToString().c_str());
+    ACE_IMAGE_SCOPED_TRACE("LoadImageData %s", imageSourceInfo.ToString().c_str());
     const auto& src = imageSourceInfo.GetSrc();
     std::string filePath = RemovePathHead(src);
     if (imageSourceInfo.GetSrcType() == SrcType::INTERNAL) {
@@ -372,7 +361,7 @@ std::shared_ptr<RSData> AssetImageLoader::LoadImageData(
     const ImageSourceInfo& imageSourceInfo, const WeakPtr<PipelineBase>& context)
 #endif
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     const auto& src = imageSourceInfo.GetSrc();
     if (src.empty()) {
         TAG_LOGW(AceLogTag::ACE_IMAGE, "image src is empty");
@@ -44,6 +44,14 @@ namespace {
 // If a picture is a wide color gamut picture, its area value will be larger than this threshold.
 constexpr double SRGB_GAMUT_AREA = 0.104149;
 
+// The image is waited for on screen, the task is dropped if the pipeline is destroyed before it starts.
+void PostLoadingTask(const CancelableTask& task, const WeakPtr<PipelineBase>& context)
+{
+    auto pipelineContext = context.Upgrade();
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        task, BgTaskPriority::USER_VISIBLE, pipelineContext ? pipelineContext->GetBgTaskGroup() : nullptr);
+}
+
 } // namespace
 
 std::mutex ImageProvider::loadingImageMutex_;
@@ -202,7 +210,7 @@ void ImageProvider::FetchImageObject(const ImageSourceInfo& imageInfo, const Ima
     if (onBackgroundTaskPostCallback) {
         onBackgroundTaskPostCallback(cancelableTask);
     }
-    BackgroundTaskExecutor::GetInstance().PostTask(cancelableTask);
+    PostLoadingTask(cancelableTask, context);
 }
 
 RefPtr<ImageObject> ImageProvider::QueryImageObjectFromCache(
@@ -234,7 +242,7 @@ std::shared_ptr<RSData> ImageProvider::LoadImageRawData(
     const ImageSourceInfo& imageInfo, const RefPtr<PipelineBase> context)
 #endif
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     auto imageCache = context->GetImageCache();
     if (imageCache) {
         // 1. try get data from cache.
@@ -276,7 +284,7 @@ std::shared_ptr<RSData> ImageProvider::LoadImageRawDataFromFileCache(
 #endif
     const RefPtr<PipelineBase> context, const std::string key, const std::string suffix)
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     std::string cacheFilePath = ImageFileCache::GetInstance().GetImageCacheFilePath(key) + suffix;
     auto data = ImageFileCache::GetInstance().GetDataFromCacheFile(cacheFilePath);
     if (data) {
@@ -335,7 +343,7 @@ void ImageProvider::GetSVGImageDOMAsyncFromSrc(const std::string& src,
     if (onBackgroundTaskPostCallback) {
         onBackgroundTaskPostCallback(cancelableTask);
     }
-    BackgroundTaskExecutor::GetInstance().PostTask(cancelableTask);
+    PostLoadingTask(cancelableTask, context);
 }
 
 #ifndef USE_ROSEN_DRAWING
@@ -383,7 +391,7 @@ void ImageProvider::GetSVGImageDOMAsyncFromData(const std::shared_ptr<RSData>& d
     if (onBackgroundTaskPostCallback) {
         onBackgroundTaskPostCallback(cancelableTask);
     }
-    BackgroundTaskExecutor::GetInstance().PostTask(cancelableTask);
+    PostLoadingTask(cancelableTask, context);
 }
 
 #ifndef USE_ROSEN_DRAWING
@@ -580,7 +588,7 @@ std::shared_ptr<RSImage> ImageProvider::ResizeDrawingImage(
 sk_sp<SkImage> ImageProvider::ApplySizeToSkImage(
     const sk_sp<SkImage>& rawImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey)
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     auto scaledImageInfo =
         SkImageInfo::Make(dstWidth, dstHeight, rawImage->colorType(), rawImage->alphaType(), rawImage->refColorSpace());
     SkBitmap scaledBitmap;
@@ -631,7 +639,7 @@ sk_sp<SkImage> ImageProvider::ApplySizeToSkImage(
 std::shared_ptr<RSImage> ImageProvider::ApplySizeToDrawingImage(
     const std::shared_ptr<RSImage>& rawRSImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey)
 {
-    ACE_FUNCTION_TRACE();
+    ACE_IMAGE_SCOPED_TRACE(__func__);
     RSImageInfo scaledImageInfo { dstWidth, dstHeight,
         rawRSImage->GetColorType(), rawRSImage->GetAlphaType(), rawRSImage->GetColorSpace() };
     RSBitmap scaledBitmap;
@@ -15,8 +15,13 @@
 
 #include "core/image/test/unittest/image_cache_test.h"
 
+#include <fstream>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
+#include "core/image/image_file_cache.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -38,34 +43,34 @@ public:
 
 /**
  * @tc.name: MemoryCache001
- * @tc.desc: new image success insert into cache with LRU.
+ * @tc.desc: new image success insert into cache.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache001, TestSize.Level1)
 {
     /**
      * @tc.steps: step1. cache images one by one.
-     * @tc.expected: new item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: every image is counted and can be found.
      */
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
         imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(nullptr));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
-        ASSERT_EQ(frontKey, FILE_KEYS[i]);
-        ASSERT_EQ(frontKey, imageCache->imageCache_[FILE_KEYS[i]]->cacheKey);
+        ASSERT_EQ(imageCache->GetCachedImageCount(), i + 1);
+        ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[i]), nullptr);
     }
 
     /**
      * @tc.steps: step2. cache a image already in cache for example FILE_KEYS[3] e.t. "key4".
-     * @tc.expected: the cached item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: the cached item is replaced, count does not change.
      */
-    imageCache->CacheImage(FILE_KEYS[3], std::make_shared<CachedImage>(nullptr));
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[3]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[3]]->cacheKey, FILE_KEYS[3]);
+    auto image = std::make_shared<CachedImage>(nullptr);
+    imageCache->CacheImage(FILE_KEYS[3], image);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), CACHE_FILES.size());
+    ASSERT_EQ(imageCache->GetCacheImage(FILE_KEYS[3]), image);
 }
 
 /**
  * @tc.name: MemoryCache002
- * @tc.desc: get image success in cache with LRU.
+ * @tc.desc: get image success in cache.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
@@ -75,25 +80,21 @@ HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
      */
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
         imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(nullptr));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
     }
     /**
      * @tc.steps: step2. find a image already in cache for example FILE_KEYS[2] e.t. "key3".
-     * @tc.expected: the cached iterator should not at end() of cacheList_ and imagCache.
-     *              after GetImageCache(), the item should at begin() of cacheList_.
+     * @tc.expected: the image is found and counted as a hit.
      */
-    auto iter = (imageCache->imageCache_).find(FILE_KEYS[2]);
-    ASSERT_NE(iter, imageCache->imageCache_.end());
-    imageCache->GetCacheImage(FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[2]]->cacheKey, FILE_KEYS[2]);
+    ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[2]), nullptr);
+    ASSERT_EQ(imageCache->imageCache_.GetMetrics().hitCount, 1u);
 
     /**
      * @tc.steps: step3. find a image not in cache for example "key8".
-     * @tc.expected: return null.
+     * @tc.expected: return null and counted as a miss.
      */
     auto image = imageCache->GetCacheImage("key8");
     ASSERT_EQ(image, nullptr);
+    ASSERT_EQ(imageCache->imageCache_.GetMetrics().missCount, 1u);
 }
 
 /**
@@ -108,7 +109,17 @@ HWTEST_F(ImageCacheTest, MemoryCache003, TestSize.Level1)
      * @tc.expected: capacity set to 1000.
      */
     imageCache->SetCapacity(1000);
-    ASSERT_EQ(static_cast<int32_t>(imageCache->capacity_), 1000);
+    ASSERT_EQ(static_cast<int32_t>(imageCache->GetCapacity()), 1000);
+
+    /**
+     * @tc.steps: step2. set capacity to 0.
+     * @tc.expected: cached images are dropped and new ones are not cached.
+     */
+    imageCache->CacheImage(KEY_1, std::make_shared<CachedImage>(nullptr));
+    imageCache->SetCapacity(0);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 0u);
+    imageCache->CacheImage(KEY_2, std::make_shared<CachedImage>(nullptr));
+    ASSERT_EQ(imageCache->GetCacheImage(KEY_2), nullptr);
 }
 
 /**
@@ -122,79 +133,146 @@ HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
      * @tc.steps: step1. set data limit to 10 bytes, cache some data.check result
      * @tc.expected: result is right.
      */
-    imageCache->dataSizeLimit_ = 10;
+    imageCache->SetDataCacheLimit(10);
 
     // create 3 bytes data, cache it, current size is 3
-    const uint8_t data1[] = {'a', 'b', 'c' };
+    const uint8_t data1[] = { 'a', 'b', 'c' };
     sk_sp<SkData> skData1 = SkData::MakeWithCopy(data1, 3);
     auto cachedData1 = AceType::MakeRefPtr<NG::SkiaImageData>(skData1);
     imageCache->CacheImageData(KEY_1, cachedData1);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-
-    // create 2 bytes data, cache it, current size is 5. {abc} {de}
-    const uint8_t data2[] = {'d', 'e' };
-    sk_sp<SkData> skData2 = SkData::MakeWithCopy(data2, 2);
-    auto cachedData2 = AceType::MakeRefPtr<NG::SkiaImageData>(skData2);
-    imageCache->CacheImageData(KEY_2, cachedData2);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
+    ASSERT_EQ(imageCache->dataCache_.GetUsedBytes(), 3u);
 
-    // create 7 bytes data, cache it, current size is 5. new data not cached.
+    // create 7 bytes data, bigger than half limit, not cached.
     const uint8_t data3[] = { 'f', 'g', 'h', 'i', 'j', 'k', 'l' };
     sk_sp<SkData> skData3 = SkData::MakeWithCopy(data3, 7);
     auto cachedData3 = AceType::MakeRefPtr<NG::SkiaImageData>(skData3);
     imageCache->CacheImageData(KEY_3, cachedData3);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
-    auto data = imageCache->GetCacheImageData(KEY_3);
-    ASSERT_EQ(data, nullptr);
+    ASSERT_EQ(imageCache->dataCache_.GetUsedBytes(), 3u);
+    ASSERT_EQ(imageCache->GetCacheImageData(KEY_3), nullptr);
 
-    // create 5 bytes data, cache it, current size is 10 {abc} {de} {mnopq}
+    // create 5 bytes data and cache it under every key, total size never exceeds the limit.
     const uint8_t data4[] = { 'm', 'n', 'o', 'p', 'q' };
     sk_sp<SkData> skData4 = SkData::MakeWithCopy(data4, 5);
     auto cachedData4 = AceType::MakeRefPtr<NG::SkiaImageData>(skData4);
-    imageCache->CacheImageData(KEY_4, cachedData4);
-    ASSERT_EQ(imageCache->curDataSize_, 10u);
-
-    // create 2 bytes data, cache it, current size is 9 {de}{mnopq}{rs}
-    const uint8_t data5[] = { 'r', 's' };
-    sk_sp<SkData> skData5 = SkData::MakeWithCopy(data5, 2);
-    auto cachedData5 = AceType::MakeRefPtr<NG::SkiaImageData>(skData5);
-    imageCache->CacheImageData(KEY_5, cachedData5);
-    ASSERT_EQ(imageCache->curDataSize_, 9u);
-
-    // create 5 bytes, cache it, current size is 7 {rs}{tuvwx}
-    const uint8_t data6[] = { 't', 'u', 'v', 'w', 'x' };
-    sk_sp<SkData> skData6 = SkData::MakeWithCopy(data6, 5);
-    auto cachedData6 = AceType::MakeRefPtr<NG::SkiaImageData>(skData6);
-    imageCache->CacheImageData(KEY_6, cachedData6);
-    ASSERT_EQ(imageCache->curDataSize_, 7u);
-
-    // cache data witch is already cached. {rs}{y}
+    for (const auto& key : FILE_KEYS) {
+        imageCache->CacheImageData(key, cachedData4);
+        ASSERT_LE(imageCache->dataCache_.GetUsedBytes(), 10u);
+        ASSERT_EQ(imageCache->GetCacheImageData(key), cachedData4);
+    }
+
+    // cache data witch is already cached, size is updated.
     const uint8_t data7[] = { 'y' };
     sk_sp<SkData> skData7 = SkData::MakeWithCopy(data7, 1);
     auto cachedData7 = AceType::MakeRefPtr<NG::SkiaImageData>(skData7);
-    imageCache->CacheImageData(KEY_6, cachedData7);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-
-    // cache data witch is already cached. {y}{fg}
-    const uint8_t data8[] = { 'f', 'g' };
-    sk_sp<SkData> skData8 = SkData::MakeWithCopy(data8, 2);
-    auto cachedData8 = AceType::MakeRefPtr<NG::SkiaImageData>(skData8);
-    imageCache->CacheImageData(KEY_5, cachedData8);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-    auto dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
-    for (int i = 0; i < 2; ++i) {
-        ASSERT_EQ(dataFront[i], data8[i]);
-    }
+    imageCache->CacheImageData(KEY_5, cachedData7);
     auto dataKey5 = imageCache->GetCacheImageData(KEY_5);
-    auto dataRaw5 = dataKey5->GetData();
-    ASSERT_EQ(dataFront, dataRaw5);
-
-    // Get key6
-    auto dataKey6 = imageCache->GetCacheImageData(KEY_6);
-    auto dataRaw6 = dataKey6->GetData();
-    ASSERT_EQ(dataRaw6[0], 'y');
-    dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
-    ASSERT_EQ(dataFront, dataRaw6);
+    ASSERT_NE(dataKey5, nullptr);
+    ASSERT_EQ(dataKey5->GetSize(), 1u);
+    ASSERT_LE(imageCache->dataCache_.GetUsedBytes(), 10u);
+}
+
+/**
+ * @tc.name: MemoryCache005
+ * @tc.desc: trim cache tiers on memory level notification.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, MemoryCache005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. fill the decoded image tier.
+     */
+    for (int32_t i = 0; i < 80; ++i) {
+        imageCache->CacheImage(std::to_string(i), std::make_shared<CachedImage>(nullptr));
+    }
+    auto count = imageCache->GetCachedImageCount();
+
+    /**
+     * @tc.steps: step2. notify moderate level.
+     * @tc.expected: decoded images are kept.
+     */
+    imageCache->NotifyMemoryLevel(0);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), count);
+
+    /**
+     * @tc.steps: step3. notify low level.
+     * @tc.expected: decoded images are trimmed to half of the capacity.
+     */
+    imageCache->NotifyMemoryLevel(1);
+    ASSERT_LE(imageCache->GetCachedImageCount(), 40u);
+
+    /**
+     * @tc.steps: step4. notify critical level.
+     * @tc.expected: all tiers are cleared.
+     */
+    imageCache->NotifyMemoryLevel(2);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 0u);
+}
+
+/**
+ * @tc.name: MemoryCache006
+ * @tc.desc: limits of a sharded cache hold for the whole cache, not per shard.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, MemoryCache006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put an object larger than a quarter of the byte limit into a cache of four shards.
+     * @tc.expected: it is cached.
+     */
+    GDSFCache<int32_t> cache(100, 10, 4);
+    cache.Put(KEY_1, 1, 60);
+    ASSERT_EQ(cache.Get(KEY_1), 1);
+    ASSERT_EQ(cache.GetUsedBytes(), 60u);
+
+    /**
+     * @tc.steps: step2. put more objects than the count limit.
+     * @tc.expected: the count and byte limits hold for all shards together.
+     */
+    for (int32_t i = 0; i < 20; ++i) {
+        cache.Put(std::to_string(i), i, 10);
+        ASSERT_LE(cache.GetCount(), 10u);
+        ASSERT_LE(cache.GetUsedBytes(), 100u);
+    }
+    ASSERT_EQ(cache.GetCount(), 10u);
+    ASSERT_EQ(cache.Get("19"), 19);
+
+    /**
+     * @tc.steps: step3. trim the cache to half.
+     * @tc.expected: half of the objects are left.
+     */
+    cache.Trim(0.5);
+    ASSERT_EQ(cache.GetCount(), 5u);
+    ASSERT_EQ(cache.GetUsedBytes(), 50u);
+}
+
+/**
+ * @tc.name: MemoryCache007
+ * @tc.desc: threads put into a full sharded cache at once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, MemoryCache007, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put and get distinct keys from several threads, every put of a full cache evicts.
+     * @tc.expected: the limits hold for the whole cache once the threads are done.
+     */
+    GDSFCache<int32_t> cache(100, 10, GDSFCache<int32_t>::MAX_SHARD_COUNT);
+    std::vector<std::thread> threads;
+    for (int32_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&cache, thread]() {
+            for (int32_t i = 0; i < 1000; ++i) {
+                cache.Put(std::to_string(thread * 1000 + i), i, 10);
+                cache.Get(std::to_string(thread * 1000 + i / 2));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    cache.Trim(1.0);
+    ASSERT_EQ(cache.GetCount(), 10u);
+    ASSERT_EQ(cache.GetUsedBytes(), 100u);
+    ASSERT_GE(cache.GetMetrics().evictCount, 3990u);
 }
 
 /**
@@ -208,21 +286,20 @@ HWTEST_F(ImageCacheTest, FileCache001, TestSize.Level1)
      * @tc.steps: step1.call SetImageCacheFilePath().
      * @tc.expected: cache file size init right and cache file Info init right.
      */
-    ImageCache::SetImageCacheFilePath(CACHE_FILE_PATH);
-    ASSERT_EQ(ImageCache::cacheFilePath_, CACHE_FILE_PATH);
+    auto& fileCache = ImageFileCache::GetInstance();
+    fileCache.SetImageCacheFilePath(CACHE_FILE_PATH);
+    ASSERT_EQ(fileCache.GetImageCacheFilePath(), CACHE_FILE_PATH);
 
     /**
      * @tc.steps: step2. call SetCacheFileInfo().
-     * @tc.expected: file info init right.
+     * @tc.expected: file info init right, the least recently accessed file is on top of access records.
      */
-    ImageCache::SetCacheFileInfo();
-    ASSERT_EQ(ImageCache::cacheFileSize_, FILE_SIZE);
-    ASSERT_EQ(static_cast<int32_t>(ImageCache::cacheFileInfo_.size()), 5);
-    size_t i = 0;
-    auto iter = ImageCache::cacheFileInfo_.begin();
-    while (i < TEST_COUNT - 1) {
-        ASSERT_LE(iter->accessTime, (++iter)->accessTime);
-        i++;
+    fileCache.SetCacheFileInfo();
+    ASSERT_EQ(fileCache.cacheFileSize_, FILE_SIZE);
+    ASSERT_EQ(static_cast<int32_t>(fileCache.cacheFileInfo_.size()), 5);
+    const auto& oldest = fileCache.cacheFileInfo_.at(fileCache.accessRecords_.top().second);
+    for (const auto& [filePath, fileInfo] : fileCache.cacheFileInfo_) {
+        ASSERT_LE(oldest.accessTime, fileInfo.accessTime);
     }
 }
 
@@ -236,19 +313,31 @@ HWTEST_F(ImageCacheTest, FileCache002, TestSize.Level1)
     /**
      * @tc.steps: step1.construct a data.
      */
+    auto& fileCache = ImageFileCache::GetInstance();
     std::vector<uint8_t> imageData = { 1, 2, 3, 4, 5, 6 };
     std::string url = "http:/testfilecache002/image";
+    auto filePath = fileCache.GetImageCacheFilePath(url);
 
     /**
      * @tc.steps: step2. call WriteCacheFile().
-     * @tc.expected: file write into filePath and file info update right.
+     * @tc.expected: data is readable at once, file is on disk after flush and file info update right.
      */
-    ImageFileCache::GetInstance().WriteCacheFile(url, imageData.data(), imageData.size());
-    ASSERT_EQ(ImageCache::cacheFileSize_, static_cast<int32_t>(FILE_SIZE + imageData.size()));
-    ASSERT_EQ(ImageCache::cacheFileInfo_.size(), TEST_COUNT + 1);
-    auto iter = ImageCache::cacheFileInfo_.rbegin();
+    fileCache.WriteCacheFile(url, imageData.data(), imageData.size());
+    ASSERT_TRUE(fileCache.GetFromCacheFile(filePath));
+    auto data = fileCache.GetDataFromCacheFile(filePath);
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(data->GetSize(), imageData.size());
+    fileCache.FlushCacheFile();
+    ASSERT_TRUE(fileCache.GetFromCacheFile(filePath));
+    ASSERT_EQ(fileCache.cacheFileSize_, static_cast<int32_t>(FILE_SIZE + imageData.size()));
+    ASSERT_EQ(fileCache.cacheFileInfo_.size(), TEST_COUNT + 1);
 
-    ASSERT_EQ(iter->filePath, ImageFileCache::GetInstance().GetImageCacheFilePath(url));
+    /**
+     * @tc.steps: step3. check the index file.
+     * @tc.expected: index file is written next to the cache files.
+     */
+    std::ifstream indexFile(CACHE_FILE_PATH + "/.image_cache_index", std::ios::binary);
+    ASSERT_TRUE(indexFile.is_open());
 }
 
 /**
@@ -259,17 +348,17 @@ HWTEST_F(ImageCacheTest, FileCache002, TestSize.Level1)
 HWTEST_F(ImageCacheTest, FileCache003, TestSize.Level1)
 {
     /**
-     * @tc.steps: step1.set cacheFileLimit_ to 0.
+     * @tc.steps: step1.construct a wrong file path.
      */
     std::string wrongFilePath = "/data/wrong_data";
     /**
      * @tc.steps: step2. call GetFromCacheFile().
-     * @tc.expected:data != nullptr.
+     * @tc.expected: file is found with right path.
      */
-    auto data = ImageCache::GetFromCacheFile(CACHE_IMAGE_FILE_2);
-    ASSERT_TRUE(data);
-    auto nullData = ImageCache::GetFromCacheFile(wrongFilePath);
-    ASSERT_TRUE(!nullData);
+    auto& fileCache = ImageFileCache::GetInstance();
+    ASSERT_TRUE(fileCache.GetFromCacheFile(CACHE_IMAGE_FILE_2));
+    ASSERT_FALSE(fileCache.GetFromCacheFile(wrongFilePath));
+    ASSERT_EQ(fileCache.GetDataFromCacheFile(wrongFilePath), nullptr);
 }
 
 /**
@@ -282,19 +371,59 @@ HWTEST_F(ImageCacheTest, FileCache004, TestSize.Level1)
     /**
      * @tc.steps: step1.set cacheFileLimit_ to 0.
      */
-    ImageCache::SetCacheFileLimit(0);
-    ASSERT_EQ(static_cast<int32_t>(ImageCache::cacheFileLimit_), 0);
+    auto& fileCache = ImageFileCache::GetInstance();
+    fileCache.SetCacheFileLimit(0);
+    ASSERT_EQ(static_cast<int32_t>(fileCache.fileLimit_), 0);
 
     /**
      * @tc.steps: step2. call WriteCacheFile().
-     * @tc.expected: file write into filePath and file info update right.
+     * @tc.expected: file write into filePath and the least recently accessed files are cleared.
      */
     std::vector<uint8_t> imageData = { 1, 2, 3 };
     std::string url = "http:/testfilecache003/image";
-    ImageFileCache::GetInstance().WriteCacheFile(url, imageData.data(), imageData.size());
-    float ratio = ImageCache::clearCacheFileRatio_;
-    ASSERT_EQ(ImageCache::cacheFileInfo_.size(), static_cast<size_t>((TEST_COUNT + 2) * ratio + 1));
-    ASSERT_LE(ImageCache::cacheFileSize_, FILE_SIZE);
+    fileCache.WriteCacheFile(url, imageData.data(), imageData.size());
+    fileCache.FlushCacheFile();
+    float ratio = fileCache.clearCacheFileRatio_;
+    ASSERT_EQ(fileCache.cacheFileInfo_.size(), static_cast<size_t>((TEST_COUNT + 2) * ratio + 1));
+    ASSERT_LE(fileCache.cacheFileSize_, FILE_SIZE);
+}
+
+/**
+ * @tc.name: FileCache005
+ * @tc.desc: load cache file info from the index file, reconciled with the cache file path.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, FileCache005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. drop the file info in memory, then reload it.
+     * @tc.expected: file info is restored from the index file, which needs no rewrite.
+     */
+    auto& fileCache = ImageFileCache::GetInstance();
+    auto count = fileCache.cacheFileInfo_.size();
+    auto size = fileCache.cacheFileSize_;
+    fileCache.hasSetCacheFileInfo_ = false;
+    fileCache.cacheFileInfo_.clear();
+    fileCache.SetCacheFileInfo();
+    ASSERT_EQ(fileCache.cacheFileInfo_.size(), count);
+    ASSERT_EQ(fileCache.cacheFileSize_, size);
+    ASSERT_FALSE(fileCache.indexDirty_);
+
+    /**
+     * @tc.steps: step2. put a file missing from the index into the cache file path, as a crash after writing it
+     *                   would leave it, then reload the file info.
+     * @tc.expected: the file is found and the index is rewritten at the next flush.
+     */
+    std::string orphanFilePath = CACHE_FILE_PATH + "/orphan";
+    std::ofstream orphanFile(orphanFilePath, std::ios::binary);
+    orphanFile << "orphan";
+    orphanFile.close();
+    fileCache.hasSetCacheFileInfo_ = false;
+    fileCache.SetCacheFileInfo();
+    ASSERT_EQ(fileCache.cacheFileInfo_.size(), count + 1);
+    ASSERT_TRUE(fileCache.GetFromCacheFile(orphanFilePath));
+    ASSERT_TRUE(fileCache.indexDirty_);
+    remove(orphanFilePath.c_str());
 }
 
 } // namespace OHOS::Ace
\ No newline at end of file
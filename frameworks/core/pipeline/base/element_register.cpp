@@ -40,13 +40,22 @@ ElementRegister* ElementRegister::GetInstance()
     return (ElementRegister::instance_);
 }
 
+ElementRegister::ItemSlot* ElementRegister::CreateSlot(ElementIdType elmtId)
+{
+    if (slots_.Find(elmtId)) {
+        LOGE("Duplicate elmtId %{public}d error.", elmtId);
+        return nullptr;
+    }
+    return slots_.Create(elmtId, nextUniqueElementId_);
+}
+
 RefPtr<Element> ElementRegister::GetElementById(ElementIdType elementId)
 {
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto position = itemMap_.find(elementId);
-    return position == itemMap_.end() ? nullptr : AceType::DynamicCast<Element>(position->second).Upgrade();
+    auto slot = slots_.Find(elementId);
+    return slot ? AceType::DynamicCast<Element>(slot->item).Upgrade() : nullptr;
 }
 
 RefPtr<AceType> ElementRegister::GetNodeById(ElementIdType elementId)
@@ -54,42 +63,60 @@ RefPtr<AceType> ElementRegister::GetNodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto position = itemMap_.find(elementId);
-    return position == itemMap_.end() ? nullptr : position->second.Upgrade();
+    auto slot = slots_.Find(elementId);
+    if (!slot) {
+        return nullptr;
+    }
+    if (slot->uiNode.Invalid()) {
+        return slot->item.Upgrade();
+    }
+    return slot->uiNode.Upgrade();
 }
 
 RefPtr<V2::ElementProxy> ElementRegister::GetElementProxyById(ElementIdType elementId)
 {
-    auto position = itemMap_.find(elementId);
-    return (position == itemMap_.end()) ? nullptr : AceType::DynamicCast<V2::ElementProxy>(position->second).Upgrade();
+    auto slot = slots_.Find(elementId);
+    return slot ? AceType::DynamicCast<V2::ElementProxy>(slot->item).Upgrade() : nullptr;
 }
 
 bool ElementRegister::Exists(ElementIdType elementId)
 {
-    LOGD("ElementRegister::Exists(%{public}d) returns %{public}s", elementId,
-        (itemMap_.find(elementId) != itemMap_.end()) ? "true" : "false");
-    return (itemMap_.find(elementId) != itemMap_.end());
+    bool exists = slots_.Find(elementId) != nullptr;
+    LOGD("ElementRegister::Exists(%{public}d) returns %{public}s", elementId, exists ? "true" : "false");
+    return exists;
 }
 
 void ElementRegister::UpdateRecycleElmtId(int32_t oldElmtId, int32_t newElmtId)
 {
-    if (!Exists(oldElmtId)) {
+    auto oldSlot = slots_.Find(oldElmtId);
+    if (!oldSlot) {
         return;
     }
-    auto node = GetNodeById(oldElmtId);
+    auto node = oldSlot->uiNode.Upgrade();
     if (node) {
-        itemMap_.erase(oldElmtId);
-        AddReferenced(newElmtId, node);
+        slots_.Erase(oldElmtId, nextUniqueElementId_);
+        AddUINode(newElmtId, node);
+        return;
+    }
+    auto item = oldSlot->item.Upgrade();
+    if (item) {
+        slots_.Erase(oldElmtId, nextUniqueElementId_);
+        AddReferenced(newElmtId, item);
     }
 }
 
 bool ElementRegister::AddReferenced(ElementIdType elmtId, const WeakPtr<AceType>& referenced)
 {
-    auto result = itemMap_.emplace(elmtId, referenced);
-    if (!result.second) {
-        LOGE("Duplicate elmtId %{public}d error.", elmtId);
+    auto node = AceType::DynamicCast<NG::UINode>(referenced.Upgrade());
+    if (node) {
+        return AddUINode(elmtId, node);
     }
-    return result.second;
+    auto slot = CreateSlot(elmtId);
+    if (!slot) {
+        return false;
+    }
+    slot->item = referenced;
+    return true;
 }
 
 bool ElementRegister::AddElement(const RefPtr<Element>& element)
@@ -124,8 +151,21 @@ RefPtr<NG::UINode> ElementRegister::GetUINodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto iter = itemMap_.find(elementId);
-    return iter == itemMap_.end() ? nullptr : AceType::DynamicCast<NG::UINode>(iter->second).Upgrade();
+    auto slot = slots_.Find(elementId);
+    return slot ? slot->uiNode.Upgrade() : nullptr;
+}
+
+RefPtr<NG::FrameNode> ElementRegister::GetFrameNodeById(ElementIdType elementId)
+{
+    if (elementId == ElementRegister::UndefinedElementId) {
+        return nullptr;
+    }
+    auto slot = slots_.Find(elementId);
+    if (!slot || !slot->isFrameNode) {
+        return nullptr;
+    }
+    auto node = slot->uiNode.Upgrade();
+    return node ? Referenced::Claim(static_cast<NG::FrameNode*>(AceType::RawPtr(node))) : nullptr;
 }
 
 bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
@@ -135,7 +175,30 @@ bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
     }
 
     LOGD("Add %{public}s with elmtId %{public}d", AceType::TypeName(node), node->GetId());
-    return AddReferenced(node->GetId(), node);
+    return AddUINode(node->GetId(), node);
+}
+
+bool ElementRegister::AddUINode(ElementIdType elmtId, const RefPtr<NG::UINode>& node)
+{
+    auto slot = CreateSlot(elmtId);
+    if (!slot) {
+        return false;
+    }
+    slot->uiNode = node;
+    slot->isFrameNode = AceType::InstanceOf<NG::FrameNode>(node);
+    return true;
+}
+
+ElementHandle ElementRegister::GetHandle(ElementIdType elementId)
+{
+    auto slot = slots_.Find(elementId);
+    return slot ? ElementHandle { elementId, slot->generation } : ElementHandle();
+}
+
+RefPtr<NG::UINode> ElementRegister::GetUINodeByHandle(const ElementHandle& handle)
+{
+    auto slot = slots_.Find(handle.elmtId);
+    return slot && slot->generation == handle.generation ? slot->uiNode.Upgrade() : nullptr;
 }
 
 bool ElementRegister::RemoveItem(ElementIdType elementId, const std::string& tag)
@@ -143,7 +206,7 @@ bool ElementRegister::RemoveItem(ElementIdType elementId, const std::string& tag
     if (elementId == ElementRegister::UndefinedElementId) {
         return false;
     }
-    auto removed = itemMap_.erase(elementId);
+    auto removed = slots_.Erase(elementId, nextUniqueElementId_);
     if (removed) {
         LOGD("ElmtId %{public}d successfully removed from registry, added to list of removed Elements.", elementId);
         removedItems_.insert(std::pair(elementId, tag));
@@ -160,7 +223,7 @@ bool ElementRegister::RemoveItemSilently(ElementIdType elementId)
         return false;
     }
 
-    auto removed = itemMap_.erase(elementId);
+    auto removed = slots_.Erase(elementId, nextUniqueElementId_);
     if (removed) {
         LOGD("ElmtId %{public}d successfully removed from registry, NOT added to list of removed Elements.", elementId);
     } else {
@@ -173,14 +236,15 @@ bool ElementRegister::RemoveItemSilently(ElementIdType elementId)
 void ElementRegister::MoveRemovedItems(RemovedElementsType& removedItems)
 {
     LOGD("MoveRemovedItems return set of %{public}d elmtIds", static_cast<int32_t>(removedItems_.size()));
-    removedItems = removedItems_;
+    // hand the whole set over instead of copying it, the caller drops what it had before.
+    removedItems.swap(removedItems_);
     removedItems_.clear();
 }
 
 void ElementRegister::Clear()
 {
     LOGD("Empty the ElementRegister");
-    itemMap_.clear();
+    slots_.Clear();
     removedItems_.clear();
     geometryTransitionMap_.clear();
     pendingRemoveNodes_.clear();
@@ -21,9 +21,11 @@
 #include <unordered_set>
 #include <list>
 #include <functional>
+#include <type_traits>
 #include "base/memory/referenced.h"
 #include "frameworks/base/memory/ace_type.h"
 #include "frameworks/core/components_ng/animation/geometry_transition.h"
+#include "frameworks/core/pipeline/base/element_slot_table.h"
 
 namespace OHOS::Ace::V2 {
 class ElementProxy;
@@ -35,7 +37,6 @@ class FrameNode;
 } // namespace OHOS::Ace::NG
 
 namespace OHOS::Ace {
-using ElementIdType = int32_t;
 class Element;
 
 
@@ -51,6 +52,13 @@ struct deleted_element_hash {
 
 using RemovedElementsType = std::unordered_set<std::pair<ElementIdType, std::string>, deleted_element_hash>;
 
+// Refers to one registration of an item, stays valid until that item is removed from the register.
+// An elmtId registered again afterwards, e.g. by UpdateRecycleElmtId, gets a new generation.
+struct ElementHandle {
+    ElementIdType elmtId = -1;
+    uint32_t generation = 0;
+};
+
 class ACE_EXPORT ElementRegister {
 public:
     static constexpr ElementIdType UndefinedElementId = static_cast<ElementIdType>(-1);
@@ -68,15 +76,26 @@ public:
     template<class E>
     RefPtr<E> GetSpecificItemById(ElementIdType elmtId)
     {
-        return AceType::DynamicCast<E>(GetNodeById(elmtId));
+        if constexpr (std::is_base_of_v<NG::UINode, E>) {
+            return AceType::DynamicCast<E>(GetUINodeById(elmtId));
+        } else {
+            return AceType::DynamicCast<E>(GetNodeById(elmtId));
+        }
     }
 
     bool AddElementProxy(const WeakPtr<V2::ElementProxy>& element);
     bool AddElement(const RefPtr<Element>& element);
 
     RefPtr<NG::UINode> GetUINodeById(ElementIdType elementId);
+    // FrameNodes are flagged when added, so this lookup does not need a cast.
+    RefPtr<NG::FrameNode> GetFrameNodeById(ElementIdType elementId);
     bool AddUINode(const RefPtr<NG::UINode>& node);
 
+    // Returns an empty handle if nothing is registered with |elementId|.
+    ElementHandle GetHandle(ElementIdType elementId);
+    // Returns nullptr if the registration |handle| refers to has been removed.
+    RefPtr<NG::UINode> GetUINodeByHandle(const ElementHandle& handle);
+
     bool Exists(ElementIdType elementId);
 
     /**
@@ -138,7 +157,12 @@ private:
     // private constructor
     ElementRegister() = default;
 
+    using ItemSlot = ElementSlotTable::Slot;
+
+    // UINodes are routed to AddUINode, so that UINode lookups find them.
     bool AddReferenced(ElementIdType elmtId, const WeakPtr<AceType>& referenced);
+    bool AddUINode(ElementIdType elmtId, const RefPtr<NG::UINode>& node);
+    ItemSlot* CreateSlot(ElementIdType elmtId);
 
     //  Singleton instance
     static thread_local ElementRegister* instance_;
@@ -148,8 +172,7 @@ private:
     // first to Component, then synced to Element
     ElementIdType nextUniqueElementId_ = 0;
 
-    // Map for created elements
-    std::unordered_map<ElementIdType, WeakPtr<AceType>> itemMap_;
+    ElementSlotTable slots_;
 
     RemovedElementsType removedItems_;
 
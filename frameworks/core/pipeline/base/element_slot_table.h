@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_ELEMENT_SLOT_TABLE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_ELEMENT_SLOT_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::NG {
+class UINode;
+} // namespace OHOS::Ace::NG
+
+namespace OHOS::Ace {
+using ElementIdType = int32_t;
+
+// ElementSlotTable stores the items of ElementRegister in pages of slots indexed by elmtId, elmtIds are dense since
+// they come from MakeUniqueId. Pages without any item are released, elmtIds that do not come from MakeUniqueId, e.g.
+// negative ones or ones far ahead of it, are kept in a map so that they do not grow the page table.
+class ElementSlotTable final {
+public:
+    struct Slot {
+        // set for Element and ElementProxy
+        WeakPtr<AceType> item;
+        // set for UINode, kept typed so that UINode lookups need no cast
+        WeakPtr<NG::UINode> uiNode;
+        // 0 for an empty slot
+        uint32_t generation = 0;
+        bool isFrameNode = false;
+    };
+
+    ElementSlotTable() = default;
+    ~ElementSlotTable() = default;
+
+    // Returns a new slot for |elmtId|, which must not be in use. |nextUniqueId| is the next id MakeUniqueId hands out.
+    Slot* Create(ElementIdType elmtId, ElementIdType nextUniqueId)
+    {
+        Slot* slot = nullptr;
+        if (elmtId >= 0 && static_cast<int64_t>(elmtId) < static_cast<int64_t>(nextUniqueId) + PAGE_SIZE) {
+            auto pageIndex = static_cast<size_t>(elmtId >> PAGE_SHIFT);
+            if (pageIndex >= pages_.size()) {
+                pages_.resize(pageIndex + 1);
+            }
+            auto& page = pages_[pageIndex];
+            if (!page) {
+                page = std::make_unique<Page>();
+            }
+            slot = &page->slots[elmtId & (PAGE_SIZE - 1)];
+            ++page->usedCount;
+        } else {
+            slot = &outOfRangeSlots_[elmtId];
+        }
+        // generation 0 marks an empty slot
+        slot->generation = ++nextGeneration_ == 0 ? ++nextGeneration_ : nextGeneration_;
+        return slot;
+    }
+
+    Slot* Find(ElementIdType elmtId)
+    {
+        auto slot = FindPaged(elmtId);
+        if (slot || outOfRangeSlots_.empty()) {
+            return slot;
+        }
+        auto iter = outOfRangeSlots_.find(elmtId);
+        return iter == outOfRangeSlots_.end() ? nullptr : &iter->second;
+    }
+
+    bool Erase(ElementIdType elmtId, ElementIdType nextUniqueId)
+    {
+        auto slot = FindPaged(elmtId);
+        if (!slot) {
+            return outOfRangeSlots_.erase(elmtId) > 0;
+        }
+        *slot = Slot();
+        auto pageIndex = static_cast<size_t>(elmtId >> PAGE_SHIFT);
+        auto& page = pages_[pageIndex];
+        // keep the page MakeUniqueId currently hands out ids from, it is about to be used again.
+        if (--page->usedCount == 0 && pageIndex < static_cast<size_t>(nextUniqueId >> PAGE_SHIFT)) {
+            page.reset();
+        }
+        return true;
+    }
+
+    void Clear()
+    {
+        pages_.clear();
+        outOfRangeSlots_.clear();
+    }
+
+private:
+    // pages of 64 slots, about 2.5KB, so that a few long-lived items do not keep large pages alive.
+    static constexpr ElementIdType PAGE_SHIFT = 6;
+    static constexpr ElementIdType PAGE_SIZE = 1 << PAGE_SHIFT;
+    struct Page {
+        std::array<Slot, PAGE_SIZE> slots;
+        int32_t usedCount = 0;
+    };
+
+    Slot* FindPaged(ElementIdType elmtId)
+    {
+        if (elmtId < 0) {
+            return nullptr;
+        }
+        auto pageIndex = static_cast<size_t>(elmtId >> PAGE_SHIFT);
+        if (pageIndex >= pages_.size() || !pages_[pageIndex]) {
+            return nullptr;
+        }
+        auto& slot = pages_[pageIndex]->slots[elmtId & (PAGE_SIZE - 1)];
+        return slot.generation == 0 ? nullptr : &slot;
+    }
+
+    std::vector<std::unique_ptr<Page>> pages_;
+    std::unordered_map<ElementIdType, Slot> outOfRangeSlots_;
+    uint32_t nextGeneration_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ElementSlotTable);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_ELEMENT_SLOT_TABLE_H
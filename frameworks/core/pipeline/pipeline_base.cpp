@@ -803,6 +803,7 @@ bool PipelineBase::MaybeRelease()
 void PipelineBase::Destroy()
 {
     CHECK_RUN_ON(UI);
+    bgTaskGroup_->Cancel();
     ClearImageCache();
     platformResRegister_.Reset();
     drawDelegate_.reset();
@@ -30,6 +30,7 @@
 #include "base/resource/asset_manager.h"
 #include "base/resource/data_provider_manager.h"
 #include "base/resource/shared_image_manager.h"
+#include "base/thread/background_task_executor.h"
 #include "base/thread/task_executor.h"
 #include "core/accessibility/accessibility_manager.h"
 #include "core/animation/schedule_task.h"
@@ -436,6 +437,12 @@ public:
 
     RefPtr<ImageCache> GetImageCache() const;
 
+    // Background tasks loading images for this pipeline, canceled when it is destroyed.
+    const RefPtr<BgTaskGroup>& GetBgTaskGroup() const
+    {
+        return bgTaskGroup_;
+    }
+
     const RefPtr<SharedImageManager>& GetOrCreateSharedImageManager()
     {
         std::scoped_lock<std::shared_mutex> lock(imageMtx_);
@@ -1083,6 +1090,7 @@ protected:
     int32_t instanceId_ = 0;
     RefPtr<EventManager> eventManager_;
     RefPtr<ImageCache> imageCache_;
+    RefPtr<BgTaskGroup> bgTaskGroup_ = MakeRefPtr<BgTaskGroup>();
     RefPtr<SharedImageManager> sharedImageManager_;
     mutable std::shared_mutex imageMtx_;
     mutable std::shared_mutex themeMtx_;
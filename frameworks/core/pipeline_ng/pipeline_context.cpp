@@ -34,9 +34,12 @@
 #include "base/log/ace_tracker.h"
 #include "base/log/dump_log.h"
 #include "base/log/event_report.h"
+#include "base/log/frame_profiler.h"
+#include "base/log/jank_frame_report.h"
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "base/ressched/ressched_report.h"
+#include "base/thread/background_task_executor.h"
 #include "base/thread/task_executor.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
@@ -66,6 +69,7 @@
 #include "core/components_ng/pattern/root/root_pattern.h"
 #include "core/components_ng/pattern/stage/page_pattern.h"
 #include "core/components_ng/pattern/stage/stage_pattern.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text_field/text_field_manager.h"
 #include "core/components_ng/pattern/ui_extension/ui_extension_pattern.h"
 #include "core/components_ng/property/calc_length.h"
@@ -80,10 +84,6 @@
 
 namespace {
 constexpr uint64_t ONE_MS_IN_NS = 1 * 1000 * 1000;
-constexpr uint64_t INTERPOLATION_THRESHOLD = 100 * 1000 * 1000; // 100ms
-constexpr int32_t INDEX_X = 0;
-constexpr int32_t INDEX_Y = 1;
-constexpr int32_t INDEX_TIME = 2;
 constexpr int32_t TIME_THRESHOLD = 2 * 1000000; // 3 millisecond
 constexpr int32_t PLATFORM_VERSION_TEN = 10;
 constexpr int32_t USED_ID_FIND_FLAG = 3; // if args >3 , it means use id to find
@@ -214,6 +214,7 @@ void PipelineContext::FlushDirtyNodeUpdate()
             if (AceType::InstanceOf<NG::CustomNodeBase>(node)) {
                 auto customNode = AceType::DynamicCast<NG::CustomNodeBase>(node);
                 ACE_SCOPED_TRACE("CustomNodeUpdate %s", customNode->GetJSViewName().c_str());
+                FrameProfileScope profileScope(FramePhase::BUILD, node->GetId(), customNode->GetJSViewName());
                 customNode->Update();
             }
         }
@@ -242,152 +243,26 @@ void PipelineContext::RemoveScheduleTask(uint32_t id)
     scheduleTasks_.erase(id);
 }
 
-std::pair<float, float> PipelineContext::LinearInterpolation(const std::tuple<float, float, uint64_t>& history,
-    const std::tuple<float, float, uint64_t>& current, const uint64_t nanoTimeStamp)
-{
-    if (nanoTimeStamp == std::get<INDEX_TIME>(history) || nanoTimeStamp == std::get<INDEX_TIME>(current)) {
-        return std::make_pair(0.0f, 0.0f);
-    }
-    if (std::get<INDEX_TIME>(current) < std::get<INDEX_TIME>(history)) {
-        return std::make_pair(0.0f, 0.0f);
-    }
-    if (std::get<INDEX_TIME>(current) - std::get<INDEX_TIME>(history) > INTERPOLATION_THRESHOLD) {
-        return std::make_pair(0.0f, 0.0f);
-    }
-    if (nanoTimeStamp < std::get<INDEX_TIME>(history)) {
-        return std::make_pair(0.0f, 0.0f);
-    }
-    if (nanoTimeStamp < std::get<INDEX_TIME>(current)) {
-        float alpha = (float)(nanoTimeStamp - std::get<INDEX_TIME>(history)) /
-            (float)(std::get<INDEX_TIME>(current) - std::get<INDEX_TIME>(history));
-        float x = std::get<INDEX_X>(history) + alpha * (std::get<INDEX_X>(current) - std::get<INDEX_X>(history));
-        float y = std::get<INDEX_Y>(history) + alpha * (std::get<INDEX_Y>(current) - std::get<INDEX_Y>(history));
-        return std::make_pair(x, y);
-    } else if (nanoTimeStamp > std::get<INDEX_TIME>(current)) {
-        float alpha = (float)(nanoTimeStamp - std::get<INDEX_TIME>(current)) /
-            (float)(std::get<INDEX_TIME>(current) - std::get<INDEX_TIME>(history));
-        float x = std::get<INDEX_X>(current) + alpha * (std::get<INDEX_X>(current) - std::get<INDEX_X>(history));
-        float y = std::get<INDEX_Y>(current) + alpha * (std::get<INDEX_Y>(current) - std::get<INDEX_Y>(history));
-        return std::make_pair(x, y);
-    }
-    return std::make_pair(0.0f, 0.0f);
-}
-
-std::tuple<float, float, uint64_t> PipelineContext::GetAvgPoint(const std::vector<TouchEvent>& events,
-    const bool isScreen)
-{
-    float avgX = 0.0f;
-    float avgY = 0.0f;
-    uint64_t avgTime = 0;
-    int32_t i = 0;
-    uint64_t lastTime = 0;
-    for (auto iter = events.begin(); iter != events.end(); iter++) {
-        if (lastTime == 0 || static_cast<uint64_t>(iter->time.time_since_epoch().count()) != lastTime) {
-            if (!isScreen) {
-                avgX += iter->x;
-                avgY += iter->y;
-            } else {
-                avgX += iter->screenX;
-                avgY += iter->screenY;
-            }
-            avgTime += static_cast<uint64_t>(iter->time.time_since_epoch().count());
-            i++;
-            lastTime = static_cast<uint64_t>(iter->time.time_since_epoch().count());
-        }
-    }
-    avgX /= i;
-    avgY /= i;
-    avgTime /= i;
-    return std::make_tuple(avgX, avgY, avgTime);
-}
-
-std::pair<float, float> PipelineContext::GetResampleCoord(const std::vector<TouchEvent>& history,
-    const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp, const bool isScreen)
-{
-    if (history.empty() || current.empty()) {
-        LOGD("history or current has no point, do not resample");
-        return std::make_pair(0.0f, 0.0f);
-    }
-    auto historyPoint = GetAvgPoint(history, isScreen);
-    auto currentPoint = GetAvgPoint(current, isScreen);
-
-    if (SystemProperties::GetDebugEnabled()) {
-        LOGI("input time is %{public}" PRIu64 "", nanoTimeStamp);
-        for (auto iter : history) {
-            LOGI("history point x %{public}f, y %{public}f, time %{public}" PRIu64 "", iter.x, iter.y,
-                static_cast<uint64_t>(iter.time.time_since_epoch().count()));
-        }
-        LOGI("historyAvgPoint is x %{public}f, y %{public}f, time %{public}" PRIu64 "",
-        std::get<INDEX_X>(historyPoint), std::get<INDEX_Y>(historyPoint), std::get<INDEX_TIME>(historyPoint));
-        for (auto iter : current) {
-            LOGI("current point x %{public}f, y %{public}f, time %{public}" PRIu64 "", iter.x, iter.y,
-                static_cast<uint64_t>(iter.time.time_since_epoch().count()));
-        }
-        LOGI("currentAvgPoint is x %{public}f, y %{public}f, time %{public}" PRIu64 "",
-            std::get<INDEX_X>(currentPoint), std::get<INDEX_Y>(currentPoint), std::get<INDEX_TIME>(currentPoint));
-    }
-    return LinearInterpolation(historyPoint, currentPoint, nanoTimeStamp);
-}
-
-TouchEvent PipelineContext::GetResampleTouchEvent(const std::vector<TouchEvent>& history,
-    const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp)
-{
-    auto newXy = GetResampleCoord(history, current, nanoTimeStamp, false);
-    auto newScreenXy = GetResampleCoord(history, current, nanoTimeStamp, true);
-    TouchEvent newTouchEvent = GetLatestPoint(current, nanoTimeStamp);
-    if (newXy.first != 0 && newXy.second != 0) {
-        newTouchEvent.x = newXy.first;
-        newTouchEvent.y = newXy.second;
-        newTouchEvent.screenX = newScreenXy.first;
-        newTouchEvent.screenY = newScreenXy.second;
-        std::chrono::nanoseconds nanoseconds(nanoTimeStamp);
-        newTouchEvent.time = TimeStamp(nanoseconds);
-        newTouchEvent.history = current;
-        newTouchEvent.isInterpolated = true;
-        }
-    if (SystemProperties::GetDebugEnabled()) {
-        LOGI("Interpolate point is %{public}d, %{public}f, %{public}f, %{public}f, %{public}f, %{public}" PRIu64 "",
-            newTouchEvent.id, newTouchEvent.x, newTouchEvent.y, newTouchEvent.screenX,
-            newTouchEvent.screenY, static_cast<uint64_t>(newTouchEvent.time.time_since_epoch().count()));
-    }
-    return newTouchEvent;
-}
-
-TouchEvent PipelineContext::GetLatestPoint(const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp)
-{
-    TouchEvent result;
-    uint64_t gap = UINT64_MAX;
-    for (auto iter = current.begin(); iter != current.end(); iter++) {
-        uint64_t timeStamp = static_cast<uint64_t>(iter->time.time_since_epoch().count());
-        if (timeStamp == nanoTimeStamp) {
-            result = *iter;
-            return result;
-        } else if (timeStamp > nanoTimeStamp) {
-            if (timeStamp - nanoTimeStamp < gap) {
-                gap = timeStamp - nanoTimeStamp;
-                result = *iter;
-            }
-        } else {
-            if (nanoTimeStamp - timeStamp < gap) {
-                gap = nanoTimeStamp - timeStamp;
-                result = *iter;
-            }
-        }
-    }
-    return result;
-}
-
 void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
+    FrameProfileScope profileScope(FramePhase::FRAME, static_cast<int32_t>(frameCount));
     auto recvTime = GetSysTimestamp();
+    // the tasks of the frame are attributed to this pipeline while the jank of frames is recorded.
+    bool attributeJank = JankFrameReport::IsRecording();
+    if (attributeJank) {
+        FrameProfiler::SetCostSink(jankAttribution_.get());
+    }
     static const std::string abilityName = AceApplicationInfo::GetInstance().GetProcessName().empty()
                                                ? AceApplicationInfo::GetInstance().GetPackageName()
                                                : AceApplicationInfo::GetInstance().GetProcessName();
     window_->RecordFrameTime(nanoTimestamp, abilityName);
     FlushFrameTrace();
-    resampleTimeStamp_ = nanoTimestamp - window_->GetVSyncPeriod() + ONE_MS_IN_NS;
+    // points are interpolated one refresh period back, or predicted to the vsync itself.
+    resampleTimeStamp_ = touchResampler_.GetPredictor() == TouchPredictor::NONE
+                             ? nanoTimestamp - window_->GetVSyncPeriod() + ONE_MS_IN_NS
+                             : nanoTimestamp;
 #ifdef UICAST_COMPONENT_SUPPORTED
     do {
         auto container = Container::Current();
@@ -453,6 +328,11 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
     }
     needRenderNode_.clear();
     taskScheduler_->FlushAfterRenderTask();
+    if (attributeJank) {
+        FrameProfiler::SetCostSink(nullptr);
+        JankFrameReport::AttributeFrame(
+            *jankAttribution_, static_cast<int64_t>(nanoTimestamp), GetSysTimestamp() - recvTime);
+    }
     // Keep the call sent at the end of the function
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().FlushEnd();
@@ -501,10 +381,11 @@ void PipelineContext::FlushFrameTrace()
 void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
 {
     CHECK_RUN_ON(UI);
-    ACE_FUNCTION_TRACE();
+    ACE_ANIMATION_SCOPED_TRACE(__func__);
     if (scheduleTasks_.empty()) {
         return;
     }
+    FrameProfileScope profileScope(FramePhase::ANIMATION);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushAnimation();
@@ -1375,8 +1256,8 @@ void PipelineContext::OnTouchEvent(const TouchEvent& point, bool isSubPipe)
             "type=%{public}d", scalePoint.id, scalePoint.x, scalePoint.y, (int)scalePoint.type);
     }
     eventManager_->SetInstanceId(GetInstanceId());
-    if (scalePoint.type != TouchType::MOVE && historyPointsById_.find(scalePoint.id) != historyPointsById_.end()) {
-        historyPointsById_.erase(scalePoint.id);
+    if (scalePoint.type != TouchType::MOVE) {
+        touchResampler_.ResetPointer(scalePoint.id);
     }
     if (scalePoint.type == TouchType::DOWN) {
         // Set focus state inactive while touch down event received
@@ -1565,6 +1446,12 @@ bool PipelineContext::OnDumpInfo(const std::vector<std::string>& params) const
     } else if (params[0] == "-threadstuck" && params.size() >= 3) {
     } else if (params[0] == "-pipeline") {
         DumpPipelineInfo();
+    } else if (params[0] == "-frameprofile") {
+        FrameProfiler::GetInstance().OnDumpInfo(params);
+    } else if (params[0] == "-jank") {
+        jankAttribution_->OnDumpInfo(params);
+    } else if (params[0] == "-bgtask") {
+        DumpLog::GetInstance().Print(BackgroundTaskExecutor::GetInstance().GetMetrics().ToString());
     } else if (params[0] == "-jsdump") {
         std::vector<std::string> jsParams;
         if (params.begin() != params.end()) {
@@ -1633,34 +1520,33 @@ void PipelineContext::FlushTouchEvents()
             return;
         }
         canUseLongPredictTask_ = false;
+        FrameProfileScope profileScope(FramePhase::TOUCH);
         eventManager_->FlushTouchEventsBegin(touchEvents_);
-        std::unordered_map<int, TouchEvent> idToTouchPoints;
+        // the latest point of each pointer carries all its points of the frame as history, the oldest first.
+        std::list<TouchEvent> touchPoints;
         bool needInterpolation = true;
-        std::unordered_map<int32_t, TouchEvent> newIdTouchPoints;
-        for (auto iter = touchEvents.rbegin(); iter != touchEvents.rend(); ++iter) {
-            auto scalePoint = (*iter).CreateScalePoint(GetViewScale());
-            idToTouchPoints.emplace(scalePoint.id, scalePoint);
-            idToTouchPoints[scalePoint.id].history.insert(idToTouchPoints[scalePoint.id].history.begin(), scalePoint);
-            needInterpolation = iter->type != TouchType::MOVE ? false : true;
-        }
-        if (needInterpolation) {
-            auto targetTimeStamp = resampleTimeStamp_;
-            for (const auto &idIter : idToTouchPoints) {
-                TouchEvent newTouchEvent = GetResampleTouchEvent(historyPointsById_[idIter.first],
-                    idIter.second.history, targetTimeStamp);
-                if (newTouchEvent.x != 0 && newTouchEvent.y != 0) {
-                    newIdTouchPoints[idIter.first] = newTouchEvent;
-                }
-                historyPointsById_[idIter.first] = idIter.second.history;
+        for (const auto& touchEvent : touchEvents) {
+            auto scalePoint = touchEvent.CreateScalePoint(GetViewScale());
+            needInterpolation = needInterpolation && scalePoint.type == TouchType::MOVE;
+            touchResampler_.AddPoint(scalePoint);
+            auto iter = std::find_if(touchPoints.begin(), touchPoints.end(),
+                [id = scalePoint.id](const TouchEvent& touchPoint) { return touchPoint.id == id; });
+            if (iter == touchPoints.end()) {
+                iter = touchPoints.emplace(touchPoints.end());
             }
-        }
-        std::list<TouchEvent> touchPoints;
-        for (const auto &iter : idToTouchPoints) {
-            if (newIdTouchPoints.find(iter.first) != newIdTouchPoints.end()) {
-                touchPoints.emplace_back(newIdTouchPoints[iter.first]);
-            } else {
-                touchPoints.emplace_back(iter.second);
+            auto history = std::move(iter->history);
+            history.emplace_back(scalePoint);
+            *iter = std::move(scalePoint);
+            iter->history = std::move(history);
+        }
+        for (auto& touchPoint : touchPoints) {
+            if (!touchResampler_.EndFrame(touchPoint, resampleTimeStamp_, needInterpolation) ||
+                !SystemProperties::GetDebugEnabled()) {
+                continue;
             }
+            LOGI("Interpolate point is %{public}d, %{public}f, %{public}f, %{public}f, %{public}f, %{public}" PRIu64 "",
+                touchPoint.id, touchPoint.x, touchPoint.y, touchPoint.screenX, touchPoint.screenY,
+                static_cast<uint64_t>(touchPoint.time.time_since_epoch().count()));
         }
         auto maxSize = touchPoints.size();
         for (auto iter = touchPoints.rbegin(); iter != touchPoints.rend(); ++iter) {
@@ -1934,6 +1820,7 @@ void PipelineContext::AddVisibleAreaChangeNode(
     addInfo.callback = callback;
     addInfo.isCurrentVisible = false;
     onVisibleAreaChangeNodeIds_.emplace(node->GetId());
+    needFullVisibleAreaChangeCheck_ = true;
     if (isUserCallback) {
         node->AddVisibleAreaUserCallback(ratio, addInfo);
     } else {
@@ -1952,10 +1839,27 @@ void PipelineContext::HandleVisibleAreaChangeEvent()
     if (onVisibleAreaChangeNodeIds_.empty()) {
         return;
     }
-    auto nodes = FrameNode::GetNodesById(onVisibleAreaChangeNodeIds_);
+    auto geometryChangeCount = FrameNode::GetGeometryChangeCount();
+    bool fullCheck = needFullVisibleAreaChangeCheck_ || lastVisibleAreaChangeOnShow_ != onShow_;
+    if (!fullCheck && geometryChangeCount == visibleAreaChangeGeometryCount_) {
+        return;
+    }
+    // taken out of the members while callbacks run, a pass they re-enter gets its own storage.
+    auto nodes = std::move(areaChangeNodes_);
+    auto visibleRectCache = std::move(visibleRectCache_);
+    FrameNode::GetNodesById(onVisibleAreaChangeNodeIds_, nodes);
     for (auto&& frameNode : nodes) {
-        frameNode->TriggerVisibleAreaChangeCallback();
+        if (fullCheck || frameNode->IsGeometryChangedSince(visibleAreaChangeGeometryCount_)) {
+            frameNode->TriggerVisibleAreaChangeCallback(false, &visibleRectCache);
+        }
     }
+    nodes.clear();
+    visibleRectCache.Clear();
+    areaChangeNodes_ = std::move(nodes);
+    visibleRectCache_ = std::move(visibleRectCache);
+    visibleAreaChangeGeometryCount_ = geometryChangeCount;
+    needFullVisibleAreaChangeCheck_ = false;
+    lastVisibleAreaChangeOnShow_ = onShow_;
 }
 
 void PipelineContext::AddFormVisibleChangeNode(
@@ -1988,6 +1892,7 @@ void PipelineContext::HandleFormVisibleChangeEvent(bool isVisible)
 void PipelineContext::AddOnAreaChangeNode(int32_t nodeId)
 {
     onAreaChangeNodeIds_.emplace(nodeId);
+    needFullAreaChangeCheck_ = true;
 }
 
 void PipelineContext::RemoveOnAreaChangeNode(int32_t nodeId)
@@ -2001,10 +1906,20 @@ void PipelineContext::HandleOnAreaChangeEvent()
     if (onAreaChangeNodeIds_.empty()) {
         return;
     }
-    auto nodes = FrameNode::GetNodesById(onAreaChangeNodeIds_);
+    // patterns still get OnAreaChangedInner every frame, only the user callback is gated by geometry changes.
+    auto geometryChangeCount = FrameNode::GetGeometryChangeCount();
+    bool fullCheck = needFullAreaChangeCheck_;
+    bool hasGeometryChange = geometryChangeCount != areaChangeGeometryCount_;
+    auto nodes = std::move(areaChangeNodes_);
+    FrameNode::GetNodesById(onAreaChangeNodeIds_, nodes);
     for (auto&& frameNode : nodes) {
-        frameNode->TriggerOnAreaChangeCallback();
+        frameNode->TriggerOnAreaChangeCallback(
+            fullCheck || (hasGeometryChange && frameNode->IsGeometryChangedSince(areaChangeGeometryCount_)));
     }
+    nodes.clear();
+    areaChangeNodes_ = std::move(nodes);
+    areaChangeGeometryCount_ = geometryChangeCount;
+    needFullAreaChangeCheck_ = false;
     UpdateFormLinkInfos();
 }
 
@@ -2378,6 +2293,10 @@ void PipelineContext::RemoveNodesToNotifyMemoryLevel(int32_t nodeId)
 
 void PipelineContext::NotifyMemoryLevel(int32_t level)
 {
+    if (imageCache_) {
+        imageCache_->NotifyMemoryLevel(level);
+    }
+    ParagraphCache::GetInstance().NotifyMemoryLevel(level);
     auto iter = nodesToNotifyMemoryLevel_.begin();
     while (iter != nodesToNotifyMemoryLevel_.end()) {
         auto node = ElementRegister::GetInstance()->GetUINodeById(*iter);
@@ -2395,6 +2314,13 @@ void PipelineContext::AddPredictTask(PredictTask&& task)
     RequestFrame();
 }
 
+void PipelineContext::AddPredictTask(
+    PredictTask&& task, PredictTaskPriority priority, const WeakPtr<AceType>& owner, PredictTaskType type)
+{
+    taskScheduler_->AddPredictTask(std::move(task), priority, owner, type);
+    RequestFrame();
+}
+
 void PipelineContext::OnIdle(int64_t deadline)
 {
     if (deadline == 0) {
@@ -2409,8 +2335,13 @@ void PipelineContext::OnIdle(int64_t deadline)
     }
     CHECK_RUN_ON(UI);
     ACE_SCOPED_TRACE("OnIdle, targettime:%" PRId64 "", deadline);
-    taskScheduler_->FlushPredictTask(deadline - TIME_THRESHOLD, canUseLongPredictTask_);
+    auto deferred = taskScheduler_->FlushPredictTask(deadline - TIME_THRESHOLD, canUseLongPredictTask_);
     canUseLongPredictTask_ = false;
+    // tasks added while flushing requested a frame already. Tasks deferred for lack of time resume in the next idle
+    // slots, the scheduler runs each of them after a few deferrals at most, so an idle ui stops requesting vsync.
+    if (deferred) {
+        RequestFrame();
+    }
     if (GetSysTimestamp() < deadline) {
         ElementRegister::GetInstance()->CallJSCleanUpIdleTaskFunc();
     }
@@ -25,7 +25,9 @@
 #include "base/geometry/ng/rect_t.h"
 #include "base/log/frame_info.h"
 #include "base/log/frame_report.h"
+#include "base/log/jank_attribution.h"
 #include "base/memory/referenced.h"
+#include "base/utils/system_properties.h"
 #include "base/view_data/view_data_wrap.h"
 #include "core/common/frontend.h"
 #include "core/components_ng/base/frame_node.h"
@@ -41,6 +43,7 @@
 #include "core/components_ng/pattern/stage/stage_manager.h"
 #include "core/components_ng/property/safe_area_insets.h"
 #include "core/event/touch_event.h"
+#include "core/event/touch_resampler.h"
 #include "core/pipeline/pipeline_base.h"
 #ifdef WINDOW_SCENE_SUPPORTED
 #include "core/components_ng/pattern/ui_extension/ui_extension_manager.h"
@@ -222,6 +225,8 @@ public:
     void AddDirtyRenderNode(const RefPtr<FrameNode>& dirty);
 
     void AddPredictTask(PredictTask&& task);
+    void AddPredictTask(
+        PredictTask&& task, PredictTaskPriority priority, const WeakPtr<AceType>& owner, PredictTaskType type);
 
     void AddAfterLayoutTask(std::function<void()>&& task);
 
@@ -567,19 +572,6 @@ private:
         }
     };
 
-    std::pair<float, float> LinearInterpolation(const std::tuple<float, float, uint64_t>& history,
-        const std::tuple<float, float, uint64_t>& current, const uint64_t nanoTimeStamp);
-
-    std::pair<float, float> GetResampleCoord(const std::vector<TouchEvent>& history,
-        const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp, const bool isScreen);
-
-    std::tuple<float, float, uint64_t> GetAvgPoint(const std::vector<TouchEvent>& events, const bool isScreen);
-
-    TouchEvent GetResampleTouchEvent(const std::vector<TouchEvent>& history,
-        const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp);
-
-    TouchEvent GetLatestPoint(const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp);
-
     std::unique_ptr<UITaskScheduler> taskScheduler_ = std::make_unique<UITaskScheduler>();
 
     std::unordered_map<uint32_t, WeakPtr<ScheduleTask>> scheduleTasks_;
@@ -610,6 +602,15 @@ private:
     std::unordered_set<int32_t> onAreaChangeNodeIds_;
     std::unordered_set<int32_t> onVisibleAreaChangeNodeIds_;
     std::unordered_set<int32_t> onFormVisibleChangeNodeIds_;
+    // geometry change count seen by the last area change passes, nodes without newer changes are skipped.
+    uint64_t areaChangeGeometryCount_ = 0;
+    uint64_t visibleAreaChangeGeometryCount_ = 0;
+    bool needFullAreaChangeCheck_ = true;
+    bool needFullVisibleAreaChangeCheck_ = true;
+    bool lastVisibleAreaChangeOnShow_ = false;
+    // storage reused by the area change passes, empty between them.
+    std::vector<RefPtr<FrameNode>> areaChangeNodes_;
+    FrameNode::VisibleRectCache visibleRectCache_;
 
     RefPtr<StageManager> stageManager_;
     RefPtr<OverlayManager> overlayManager_;
@@ -648,7 +649,9 @@ private:
     std::unordered_map<int32_t, WeakPtr<FrameNode>> storeNode_;
     std::unordered_map<int32_t, std::string> restoreNodeInfo_;
 
-    std::unordered_map<int32_t, std::vector<TouchEvent>> historyPointsById_;
+    TouchResampler touchResampler_ { static_cast<TouchPredictor>(SystemProperties::GetTouchPredictor()) };
+    // costs of the frames of this pipeline, the causes of its janky frames.
+    std::unique_ptr<JankAttribution> jankAttribution_ = std::make_unique<JankAttribution>();
 
     std::list<FrameInfo> dumpFrameInfos_;
     std::list<std::function<void()>> animationClosuresList_;
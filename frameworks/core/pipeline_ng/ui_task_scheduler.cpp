@@ -15,15 +15,216 @@
 
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base/log/frame_profiler.h"
 #include "base/log/frame_report.h"
 #include "base/memory/referenced.h"
+#include "base/thread/background_task_executor.h"
+#include "base/utils/system_properties.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
+#include "core/common/container.h"
 #include "core/common/thread_checker.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/pattern/custom/custom_node.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+struct ParallelLayoutItem {
+    RefPtr<FrameNode> node;
+    RefPtr<LayoutWrapperNode> wrapper;
+    LayoutConstraintF constraint;
+    int64_t time = 0;
+    bool runOnMain = false;
+};
+
+// Shared by ui thread and background workers, each background item is taken by exactly one thread. Items hold
+// nodes, so they are only released on ui thread, workers just touch the counters once all items are taken.
+struct ParallelLayoutContext {
+    std::vector<ParallelLayoutItem> items;
+    std::vector<size_t> backgroundItems;
+    size_t backgroundCount = 0;
+    std::atomic<size_t> next { 0 };
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t finished = 0;
+    int32_t instanceId = -1;
+    // whether the frame info or the jank attribution is recorded, items are only timed for them.
+    bool recordTime = false;
+
+    void Run(ParallelLayoutItem& item) const
+    {
+        auto time = recordTime ? &item.time : nullptr;
+        {
+            FrameProfileScope profileScope(FramePhase::MEASURE, item.node->GetId(), item.node->GetTag(), time);
+            item.wrapper->Measure(item.constraint);
+        }
+        {
+            FrameProfileScope profileScope(FramePhase::LAYOUT, item.node->GetId(), item.node->GetTag(), time);
+            item.wrapper->Layout();
+        }
+    }
+
+    bool RunNext()
+    {
+        auto index = next.fetch_add(1);
+        if (index >= backgroundCount) {
+            return false;
+        }
+        {
+            ContainerScope scope(instanceId);
+            Run(items[backgroundItems[index]]);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++finished;
+        }
+        condition.notify_all();
+        return true;
+    }
+
+    void WaitAll()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return finished == backgroundCount; });
+    }
+};
+
+bool HasDirtyAncestor(const RefPtr<FrameNode>& node)
+{
+    auto parent = node->GetAncestorNodeOfFrame();
+    while (parent) {
+        if (parent->IsInDirtyLayoutIndex()) {
+            return true;
+        }
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+    return false;
+}
+} // namespace
+
+DirtyLayoutNodeIndex::~DirtyLayoutNodeIndex()
+{
+    Clear();
+}
+
+DirtyLayoutNodeIndex::Bucket& DirtyLayoutNodeIndex::GetBucket(int32_t layoutPriority, uint32_t pageId)
+{
+    // only a few pages and priorities are alive, linear search is cheaper than a tree.
+    auto iter = buckets_.begin();
+    for (; iter != buckets_.end(); ++iter) {
+        if (iter->layoutPriority == layoutPriority && iter->pageId == pageId) {
+            return *iter;
+        }
+        if (iter->layoutPriority < layoutPriority ||
+            (iter->layoutPriority == layoutPriority && iter->pageId > pageId)) {
+            break;
+        }
+    }
+    Bucket bucket;
+    if (!spareBuckets_.empty()) {
+        bucket = std::move(spareBuckets_.back());
+        spareBuckets_.pop_back();
+    }
+    iter = buckets_.insert(iter, std::move(bucket));
+    iter->layoutPriority = layoutPriority;
+    iter->pageId = pageId;
+    return *iter;
+}
+
+bool DirtyLayoutNodeIndex::Add(const RefPtr<FrameNode>& node)
+{
+    CHECK_NULL_RETURN(node, false);
+    if (node->IsInDirtyLayoutIndex()) {
+        return false;
+    }
+    auto& bucket = GetBucket(node->GetLayoutPriority(), node->GetPageId());
+    auto depth = static_cast<size_t>(std::max(node->GetDepth(), 0));
+    if (depth >= bucket.depths.size()) {
+        bucket.depths.resize(depth + 1);
+    }
+    bucket.depths[depth].push_back({ node, node->IsLayoutDirtyMarked() });
+    node->SetInDirtyLayoutIndex(true);
+    ++size_;
+    return true;
+}
+
+void DirtyLayoutNodeIndex::Walk(const Visitor& visitor) const
+{
+    if (size_ == 0) {
+        return;
+    }
+    for (const auto& bucket : buckets_) {
+        for (const auto& entries : bucket.depths) {
+            for (const auto& entry : entries) {
+                visitor(entry.node);
+            }
+        }
+    }
+}
+
+void DirtyLayoutNodeIndex::Flush(const Visitor& visitor)
+{
+    if (size_ == 0) {
+        return;
+    }
+    for (auto& bucket : buckets_) {
+        for (auto& entries : bucket.depths) {
+            for (auto& entry : entries) {
+                // dequeue before visiting, so the node can be queued again for next flush.
+                entry.node->SetInDirtyLayoutIndex(false);
+                if (entry.dirtyOnInsert && !entry.node->IsLayoutDirtyMarked()) {
+                    continue;
+                }
+                visitor(entry.node);
+            }
+        }
+    }
+    ResetBuckets();
+}
+
+void DirtyLayoutNodeIndex::Clear()
+{
+    if (size_ == 0) {
+        return;
+    }
+    for (auto& bucket : buckets_) {
+        for (auto& entries : bucket.depths) {
+            for (auto& entry : entries) {
+                entry.node->SetInDirtyLayoutIndex(false);
+            }
+        }
+    }
+    ResetBuckets();
+}
+
+void DirtyLayoutNodeIndex::ResetBuckets()
+{
+    for (auto& bucket : buckets_) {
+        if (spareBuckets_.size() >= MAX_SPARE_BUCKET_COUNT) {
+            break;
+        }
+        for (auto& entries : bucket.depths) {
+            entries.clear();
+        }
+        spareBuckets_.emplace_back(std::move(bucket));
+    }
+    buckets_.clear();
+    size_ = 0;
+}
+
+void DirtyLayoutNodeIndex::Swap(DirtyLayoutNodeIndex& other)
+{
+    buckets_.swap(other.buckets_);
+    std::swap(size_, other.size_);
+}
+
 uint64_t UITaskScheduler::frameId_ = 0;
 
 UITaskScheduler::~UITaskScheduler()
@@ -35,7 +236,7 @@ void UITaskScheduler::AddDirtyLayoutNode(const RefPtr<FrameNode>& dirty)
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(dirty);
-    dirtyLayoutNodes_.emplace_back(dirty);
+    dirtyLayoutNodes_.Add(dirty);
 }
 
 void UITaskScheduler::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
@@ -51,29 +252,108 @@ void UITaskScheduler::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
 void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
 {
     CHECK_RUN_ON(UI);
-    ACE_FUNCTION_TRACE();
-    if (dirtyLayoutNodes_.empty()) {
+    ACE_LAYOUT_SCOPED_TRACE(__func__);
+    if (dirtyLayoutNodes_.Empty()) {
         return;
     }
     isLayouting_ = true;
-    auto dirtyLayoutNodes = std::move(dirtyLayoutNodes_);
-    PageDirtySet dirtyLayoutNodesSet(dirtyLayoutNodes.begin(), dirtyLayoutNodes.end());
+    // take over queued nodes while keeping both bucket storages, nodes marked during layout go to the next flush.
+    DirtyLayoutNodeIndex dirtyLayoutNodes;
+    dirtyLayoutNodes.Swap(spareLayoutNodes_);
+    dirtyLayoutNodes.Swap(dirtyLayoutNodes_);
 
-    // Priority task creation
-    int64_t time = 0;
-    for (auto&& node : dirtyLayoutNodesSet) {
+    if (!forceUseMainThread && SystemProperties::GetParallelLayoutEnabled() && dirtyLayoutNodes.Size() > 1) {
+        FlushParallelLayoutTask(dirtyLayoutNodes);
+    }
+
+    // Priority task creation, measure and layout of each node are profiled in CreateLayoutTask.
+    dirtyLayoutNodes.Flush([this, forceUseMainThread](const RefPtr<FrameNode>& node) {
         // need to check the node is destroying or not before CreateLayoutTask
-        if (!node || node->IsInDestroying()) {
-            continue;
+        if (node->IsInDestroying()) {
+            return;
+        }
+        if (frameInfo_ == nullptr) {
+            node->CreateLayoutTask(forceUseMainThread);
+            return;
         }
-        time = GetSysTimestamp();
+        int64_t time = GetSysTimestamp();
         node->CreateLayoutTask(forceUseMainThread);
         time = GetSysTimestamp() - time;
+        frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::LAYOUT);
+    });
+    if (spareLayoutNodes_.Empty()) {
+        spareLayoutNodes_.Swap(dirtyLayoutNodes);
+    }
+    isLayouting_ = false;
+}
+
+void UITaskScheduler::FlushParallelLayoutTask(const DirtyLayoutNodeIndex& dirtyLayoutNodes)
+{
+    // items run on any thread, their costs are sent to the sink of the ui thread once they are committed.
+    auto costSink = FrameProfiler::GetCostSink();
+    FrameProfiler::SetCostSink(nullptr);
+    auto context = std::make_shared<ParallelLayoutContext>();
+    context->instanceId = Container::CurrentId();
+    context->recordTime = frameInfo_ != nullptr || costSink != nullptr;
+    dirtyLayoutNodes.Walk([&context](const RefPtr<FrameNode>& node) {
+        // subtree covered by a dirty ancestor is left to the ancestor, which is laid out in sequence afterwards.
+        if (node->IsInDestroying() || !node->IsLayoutDirtyMarked() || HasDirtyAncestor(node)) {
+            return;
+        }
+        ParallelLayoutItem item;
+        item.node = node;
+        item.wrapper = node->CreateParallelLayoutWrapper(item.constraint);
+        if (!item.wrapper) {
+            return;
+        }
+        item.runOnMain = item.wrapper->CheckShouldRunOnMain();
+        if (!item.runOnMain) {
+            context->backgroundItems.emplace_back(context->items.size());
+        }
+        context->items.emplace_back(std::move(item));
+    });
+    context->backgroundCount = context->backgroundItems.size();
+    ACE_LAYOUT_SCOPED_TRACE("FlushParallelLayoutTask total:%zu background:%zu", context->items.size(),
+        context->backgroundCount);
+
+    // ui thread takes background items too, so a busy executor never blocks the frame.
+    for (size_t i = 1; i < context->backgroundCount; ++i) {
+        BackgroundTaskExecutor::GetInstance().PostTask([context]() {
+            while (context->RunNext()) {
+            }
+        });
+    }
+    for (auto& item : context->items) {
+        if (item.runOnMain) {
+            context->Run(item);
+        }
+    }
+    while (context->RunNext()) {
+    }
+    context->WaitAll();
+    FrameProfiler::SetCostSink(costSink);
+
+    // commit geometry in the same order as sequential layout.
+    for (auto& item : context->items) {
+        if (item.node->IsInDestroying()) {
+            continue;
+        }
+        if (!context->recordTime) {
+            item.wrapper->MountToHostOnMainThread();
+            continue;
+        }
+        int64_t time = GetSysTimestamp();
+        item.wrapper->MountToHostOnMainThread();
+        time = GetSysTimestamp() - time + item.time;
+        if (costSink != nullptr) {
+            auto tagId = FrameProfiler::GetInstance().InternTag(item.node->GetTag());
+            costSink->AddCost(FramePhase::LAYOUT, item.node->GetId(), tagId, time);
+        }
         if (frameInfo_ != nullptr) {
-            frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::LAYOUT);
+            frameInfo_->AddTaskInfo(item.node->GetTag(), item.node->GetId(), time, FrameInfo::TaskType::LAYOUT);
         }
     }
-    isLayouting_ = false;
+    context->items.clear();
 }
 
 void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
@@ -84,7 +364,6 @@ void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
     }
     auto dirtyRenderNodes = std::move(dirtyRenderNodes_);
     // Priority task creation
-    int64_t time = 0;
     for (auto&& pageNodes : dirtyRenderNodes) {
         ACE_SCOPED_TRACE("FlushRenderTask %zu", pageNodes.second.size());
         for (auto&& node : pageNodes.second) {
@@ -94,17 +373,21 @@ void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
             if (node->IsInDestroying()) {
                 continue;
             }
-            time = GetSysTimestamp();
-            auto task = node->CreateRenderTask(forceUseMainThread);
-            if (task) {
-                if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
+            // the profile scope times the task for the frame info as well.
+            int64_t time = 0;
+            bool runOnMain = false;
+            {
+                FrameProfileScope profileScope(
+                    FramePhase::RENDER, node->GetId(), node->GetTag(), frameInfo_ != nullptr ? &time : nullptr);
+                auto task = node->CreateRenderTask(forceUseMainThread);
+                if (task && (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK))) {
                     (*task)();
-                    time = GetSysTimestamp() - time;
-                    if (frameInfo_ != nullptr) {
-                        frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
-                    }
+                    runOnMain = true;
                 }
             }
+            if (runOnMain && frameInfo_ != nullptr) {
+                frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
+            }
         }
     }
 }
@@ -114,22 +397,15 @@ bool UITaskScheduler::NeedAdditionalLayout()
     bool ret = false;
     ElementRegister::GetInstance()->ReSyncGeometryTransition();
 
-    RootDirtyMap dirtyLayoutNodesMap;
-    for (auto&& dirty : dirtyLayoutNodes_) {
-        dirtyLayoutNodesMap[dirty->GetPageId()].emplace(dirty);
-    }
-
-    for (auto&& pageNodes : dirtyLayoutNodesMap) {
-        for (auto&& node : pageNodes.second) {
-            if (!node || node->IsInDestroying() || !node->GetLayoutProperty()) {
-                continue;
-            }
-            const auto& geometryTransition = node->GetLayoutProperty()->GetGeometryTransition();
-            if (geometryTransition != nullptr) {
-                ret |= geometryTransition->OnAdditionalLayout(node);
-            }
+    dirtyLayoutNodes_.Walk([&ret](const RefPtr<FrameNode>& node) {
+        if (node->IsInDestroying() || !node->GetLayoutProperty()) {
+            return;
         }
-    }
+        const auto& geometryTransition = node->GetLayoutProperty()->GetGeometryTransition();
+        if (geometryTransition != nullptr) {
+            ret |= geometryTransition->OnAdditionalLayout(node);
+        }
+    });
     return ret;
 }
 
@@ -175,28 +451,84 @@ void UITaskScheduler::FlushDelayJsActive()
 
 void UITaskScheduler::AddPredictTask(PredictTask&& task)
 {
-    predictTask_.push_back(std::move(task));
+    predictTasks_[static_cast<size_t>(PredictTaskPriority::NORMAL)].push_back({ std::move(task) });
+    ++predictTaskCount_;
 }
 
-void UITaskScheduler::FlushPredictTask(int64_t deadline, bool canUseLongPredictTask)
+void UITaskScheduler::AddPredictTask(
+    PredictTask&& task, PredictTaskPriority priority, const WeakPtr<AceType>& owner, PredictTaskType type)
 {
-    decltype(predictTask_) tasks(std::move(predictTask_));
-    for (const auto& task : tasks) {
-        if (task) {
-            task(deadline, canUseLongPredictTask);
+    predictTasks_[static_cast<size_t>(priority)].push_back({ std::move(task), owner, true, type });
+    ++predictTaskCount_;
+}
+
+int64_t UITaskScheduler::GetPredictTaskCost(PredictTaskType type) const
+{
+    return predictTaskCost_[static_cast<size_t>(type)];
+}
+
+void UITaskScheduler::UpdatePredictTaskCost(PredictTaskType type, int64_t cost)
+{
+    if (type == PredictTaskType::UNKNOWN) {
+        return;
+    }
+    auto& learnedCost = predictTaskCost_[static_cast<size_t>(type)];
+    // weight 1/4 on the newest sample, so one slow run doesn't starve the task.
+    learnedCost = learnedCost == 0 ? cost : learnedCost + (cost - learnedCost) / 4;
+}
+
+bool UITaskScheduler::FlushPredictTask(int64_t deadline, bool canUseLongPredictTask)
+{
+    // tasks added while flushing wait for next idle slot.
+    decltype(predictTasks_) tasks;
+    tasks.swap(predictTasks_);
+    predictTaskCount_ = 0;
+    bool hasRun = false;
+    bool outOfTime = false;
+    for (auto& queue : tasks) {
+        while (!queue.empty()) {
+            auto& item = queue.front();
+            if (!item.task || (item.hasOwner && !item.owner.Upgrade())) {
+                queue.pop_front();
+                continue;
+            }
+            // the first task always runs, tasks check deadline by themselves and resume in later slots. Deferred
+            // tasks are at the front of their queue, so the oldest ones are the first to run once deferred enough.
+            auto now = GetSysTimestamp();
+            if (hasRun && item.deferredCount < MAX_PREDICT_DEFERRED_COUNT &&
+                (outOfTime || now + GetPredictTaskCost(item.type) > deadline)) {
+                outOfTime = true;
+                break;
+            }
+            hasRun = true;
+            item.task(deadline, canUseLongPredictTask);
+            auto end = GetSysTimestamp();
+            if (end < deadline) {
+                UpdatePredictTaskCost(item.type, end - now);
+            }
+            queue.pop_front();
+        }
+    }
+    // keep deferred tasks ahead of the ones added while flushing.
+    for (size_t priority = 0; priority < PREDICT_PRIORITY_COUNT; ++priority) {
+        for (auto& item : tasks[priority]) {
+            ++item.deferredCount;
         }
+        predictTaskCount_ += tasks[priority].size();
+        predictTasks_[priority].splice(predictTasks_[priority].begin(), tasks[priority]);
     }
+    return outOfTime;
 }
 
 void UITaskScheduler::CleanUp()
 {
-    dirtyLayoutNodes_.clear();
+    dirtyLayoutNodes_.Clear();
     dirtyRenderNodes_.clear();
 }
 
 bool UITaskScheduler::isEmpty()
 {
-    return dirtyLayoutNodes_.empty() && dirtyRenderNodes_.empty();
+    return dirtyLayoutNodes_.Empty() && dirtyRenderNodes_.empty();
 }
 
 void UITaskScheduler::AddAfterLayoutTask(std::function<void()>&& task)
@@ -212,6 +544,7 @@ void UITaskScheduler::AddPersistAfterLayoutTask(std::function<void()>&& task)
 
 void UITaskScheduler::FlushAfterLayoutTask()
 {
+    FrameProfileScope profileScope(FramePhase::AFTER_LAYOUT);
     decltype(afterLayoutTasks_) tasks(std::move(afterLayoutTasks_));
     for (const auto& task : tasks) {
         if (task) {
@@ -16,13 +16,18 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_UI_TASK_SCHEDULER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_UI_TASK_SCHEDULER_H
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <list>
 #include <map>
 #include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "base/log/frame_info.h"
+#include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
 
@@ -67,6 +72,80 @@ private:
     TaskThread taskThread_ = MAIN_TASK;
 };
 
+// Predict tasks run in idle time after vsync, higher priority queues are drained first.
+enum class PredictTaskPriority : uint32_t {
+    HIGH = 0,
+    NORMAL,
+    LOW,
+};
+
+// Predict tasks of one type share the learned cost, which decides whether a task still fits into an idle slot.
+enum class PredictTaskType : uint32_t {
+    // no cost is learned, the task runs whenever it is reached before the deadline.
+    UNKNOWN = 0,
+    LAZY_FOR_EACH,
+};
+
+// Persistent index of dirty layout nodes, bucketed by layout priority, page and depth. Storage is kept across
+// frames, so queuing and walking nodes don't allocate once the buckets have grown.
+class DirtyLayoutNodeIndex final {
+public:
+    using Visitor = std::function<void(const RefPtr<FrameNode>&)>;
+
+    DirtyLayoutNodeIndex() = default;
+    ~DirtyLayoutNodeIndex();
+
+    // Returns false when the node is already queued.
+    bool Add(const RefPtr<FrameNode>& node);
+
+    // Visit nodes ordered by layout priority (high first), page id and depth, without consuming them.
+    void Walk(const Visitor& visitor) const;
+
+    // Visit and dequeue all nodes in the same order as Walk. A node which was layout dirty when queued but has been
+    // measured by a dirty ancestor since then is covered, and is dropped without visiting.
+    void Flush(const Visitor& visitor);
+
+    // Dequeue all nodes, the storage of a few buckets is kept for reuse.
+    void Clear();
+
+    void Swap(DirtyLayoutNodeIndex& other);
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+private:
+    // buckets are dropped once flushed, so pages shown long ago leave nothing behind.
+    static constexpr size_t MAX_SPARE_BUCKET_COUNT = 4;
+
+    struct Entry {
+        RefPtr<FrameNode> node;
+        bool dirtyOnInsert = false;
+    };
+
+    struct Bucket {
+        int32_t layoutPriority = 0;
+        uint32_t pageId = 0;
+        // entries indexed by node depth.
+        std::vector<std::vector<Entry>> depths;
+    };
+
+    Bucket& GetBucket(int32_t layoutPriority, uint32_t pageId);
+    void ResetBuckets();
+
+    std::vector<Bucket> buckets_;
+    std::vector<Bucket> spareBuckets_;
+    size_t size_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(DirtyLayoutNodeIndex);
+};
+
 class ACE_EXPORT UITaskScheduler final {
 public:
     using PredictTask = std::function<void(int64_t, bool)>;
@@ -77,6 +156,9 @@ public:
     void AddDirtyLayoutNode(const RefPtr<FrameNode>& dirty);
     void AddDirtyRenderNode(const RefPtr<FrameNode>& dirty);
     void AddPredictTask(PredictTask&& task);
+    // The task is dropped without running once owner is destroyed.
+    void AddPredictTask(
+        PredictTask&& task, PredictTaskPriority priority, const WeakPtr<AceType>& owner, PredictTaskType type);
     void AddAfterLayoutTask(std::function<void()>&& task);
     void AddAfterRenderTask(std::function<void()>&& task);
     void AddPersistAfterLayoutTask(std::function<void()>&& task);
@@ -84,7 +166,10 @@ public:
     void FlushLayoutTask(bool forceUseMainThread = false);
     void FlushRenderTask(bool forceUseMainThread = false);
     void FlushTask();
-    void FlushPredictTask(int64_t deadline, bool canUseLongPredictTask = false);
+    // Run predict tasks until deadline, tasks that don't fit are kept for next idle slot. A task kept for
+    // MAX_PREDICT_DEFERRED_COUNT slots runs in the next one whatever it costs. Returns true when tasks were kept for
+    // lack of time, tasks added while flushing don't count.
+    bool FlushPredictTask(int64_t deadline, bool canUseLongPredictTask = false);
     void FlushAfterLayoutTask();
     void FlushAfterRenderTask();
     void FlushPersistAfterLayoutTask();
@@ -100,6 +185,16 @@ public:
 
     bool isEmpty();
 
+    bool HasPredictTask() const
+    {
+        return predictTaskCount_ > 0;
+    }
+
+    size_t GetPredictTaskCount() const
+    {
+        return predictTaskCount_;
+    }
+
     void StartRecordFrameInfo(FrameInfo* info)
     {
         frameInfo_ = info;
@@ -145,12 +240,37 @@ private:
         }
     };
 
+    struct PredictTaskItem {
+        PredictTask task;
+        WeakPtr<AceType> owner;
+        bool hasOwner = false;
+        PredictTaskType type = PredictTaskType::UNKNOWN;
+        // idle slots the task was kept out of for lack of time.
+        uint32_t deferredCount = 0;
+    };
+    static constexpr size_t PREDICT_PRIORITY_COUNT = static_cast<size_t>(PredictTaskPriority::LOW) + 1;
+    static constexpr size_t PREDICT_TYPE_COUNT = static_cast<size_t>(PredictTaskType::LAZY_FOR_EACH) + 1;
+    static constexpr uint32_t MAX_PREDICT_DEFERRED_COUNT = 4;
+
+    int64_t GetPredictTaskCost(PredictTaskType type) const;
+    void UpdatePredictTaskCost(PredictTaskType type, int64_t cost);
+
     using PageDirtySet = std::set<RefPtr<FrameNode>, NodeCompare<RefPtr<FrameNode>>>;
     using RootDirtyMap = std::map<uint32_t, PageDirtySet>;
 
-    std::list<RefPtr<FrameNode>> dirtyLayoutNodes_;
+    // Measure and layout the dirty roots whose subtrees don't overlap on background threads at the same time, then
+    // commit their geometry back on ui thread. Nodes handled here are no longer layout dirty.
+    void FlushParallelLayoutTask(const DirtyLayoutNodeIndex& dirtyLayoutNodes);
+
+    DirtyLayoutNodeIndex dirtyLayoutNodes_;
+    // empty index keeping bucket storage, swapped in by FlushLayoutTask.
+    DirtyLayoutNodeIndex spareLayoutNodes_;
     RootDirtyMap dirtyRenderNodes_;
-    std::list<PredictTask> predictTask_;
+    std::array<std::list<PredictTaskItem>, PREDICT_PRIORITY_COUNT> predictTasks_;
+    size_t predictTaskCount_ = 0;
+    // moving average of predict task cost in nanoseconds by type, learned from the runs which ended before the
+    // deadline. A task which stops itself at the deadline would otherwise learn the size of a whole slot.
+    std::array<int64_t, PREDICT_TYPE_COUNT> predictTaskCost_ {};
     std::list<std::function<void()>> afterLayoutTasks_;
     std::list<std::function<void()>> afterRenderTasks_;
     std::list<std::function<void()>> persistAfterLayoutTasks_;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/common/lru/gdsf_cache.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t IMAGE_SIZE = 64 * 1024;
+constexpr int64_t MAX_KEY_COUNT = 4096;
+constexpr int32_t MAX_THREAD_COUNT = 8;
+
+// keys look like the image cache keys built from a source and a size.
+std::vector<std::string> CreateKeys(int64_t count, const std::string& prefix)
+{
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (int64_t i = 0; i < count; ++i) {
+        keys.emplace_back(prefix + "resource://base/media/image_" + std::to_string(i) + ".png200x200");
+    }
+    return keys;
+}
+} // namespace
+
+// The tiers of ImageCache are GDSFCache, which is what a lookup of ImageCache costs.
+static void GDSFCacheGetHit(benchmark::State& state)
+{
+    auto keys = CreateKeys(state.range(0), "");
+    GDSFCache<std::shared_ptr<int32_t>> cache(IMAGE_SIZE * MAX_KEY_COUNT, MAX_KEY_COUNT);
+    for (const auto& key : keys) {
+        cache.Put(key, std::make_shared<int32_t>(0), IMAGE_SIZE);
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.Get(keys[index]));
+        index = (index + 1) % keys.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GDSFCacheGetHit)->RangeMultiplier(8)->Range(8, MAX_KEY_COUNT);
+
+static void GDSFCacheGetMiss(benchmark::State& state)
+{
+    auto keys = CreateKeys(state.range(0), "");
+    auto missingKeys = CreateKeys(state.range(0), "missing/");
+    GDSFCache<std::shared_ptr<int32_t>> cache(IMAGE_SIZE * MAX_KEY_COUNT, MAX_KEY_COUNT);
+    for (const auto& key : keys) {
+        cache.Put(key, std::make_shared<int32_t>(0), IMAGE_SIZE);
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.Get(missingKeys[index]));
+        index = (index + 1) % missingKeys.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GDSFCacheGetMiss)->RangeMultiplier(8)->Range(8, MAX_KEY_COUNT);
+
+// Twice as many images as the cache holds, so that every put evicts.
+static void GDSFCachePutEvict(benchmark::State& state)
+{
+    auto keys = CreateKeys(state.range(0) * 2, "");
+    GDSFCache<std::shared_ptr<int32_t>> cache(IMAGE_SIZE * state.range(0), state.range(0));
+    size_t index = 0;
+    for (auto _ : state) {
+        cache.Put(keys[index], std::make_shared<int32_t>(0), IMAGE_SIZE);
+        index = (index + 1) % keys.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["evict"] = static_cast<double>(cache.GetMetrics().evictCount);
+}
+BENCHMARK(GDSFCachePutEvict)->RangeMultiplier(8)->Range(8, MAX_KEY_COUNT);
+
+// Decode threads look up the cache at the same time, the shards keep them from waiting for each other.
+static void GDSFCacheGetConcurrent(benchmark::State& state)
+{
+    static const auto keys = CreateKeys(MAX_KEY_COUNT, "");
+    static GDSFCache<std::shared_ptr<int32_t>> cache(IMAGE_SIZE * MAX_KEY_COUNT, MAX_KEY_COUNT);
+    static const bool filled = [] {
+        for (const auto& key : keys) {
+            cache.Put(key, std::make_shared<int32_t>(0), IMAGE_SIZE);
+        }
+        return true;
+    }();
+    benchmark::DoNotOptimize(filled);
+    // threads start from different keys, as decode threads do not load the same image.
+    static std::atomic<size_t> nextStart = 0;
+    auto index = nextStart.fetch_add(keys.size() / MAX_THREAD_COUNT) % keys.size();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.Get(keys[index]));
+        index = (index + 1) % keys.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GDSFCacheGetConcurrent)->ThreadRange(1, MAX_THREAD_COUNT);
+} // namespace OHOS::Ace
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "base/json/json_util.h"
+
+namespace OHOS::Ace {
+namespace {
+// an array of [count] objects shaped like the nodes of an inspector tree.
+std::string CreateJsonContent(int64_t count)
+{
+    auto json = JsonUtil::CreateArray(true);
+    for (int64_t i = 0; i < count; ++i) {
+        auto item = JsonUtil::Create(true);
+        item->Put("id", static_cast<int32_t>(i));
+        item->Put("type", "Column");
+        item->Put("width", 100.0 + i);
+        item->Put("visible", i % 2 == 0);
+        auto attrs = JsonUtil::Create(true);
+        attrs->Put("backgroundColor", "#FF0A59F7");
+        attrs->Put("padding", "12.00vp");
+        item->Put("attrs", attrs);
+        json->Put(item);
+    }
+    return json->ToString();
+}
+} // namespace
+
+static void JsonUtilParse(benchmark::State& state)
+{
+    auto content = CreateJsonContent(state.range(0));
+    for (auto _ : state) {
+        auto json = JsonUtil::ParseJsonString(content);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(content.size()));
+}
+BENCHMARK(JsonUtilParse)->RangeMultiplier(8)->Range(8, 4096);
+
+static void JsonUtilGetValue(benchmark::State& state)
+{
+    auto json = JsonUtil::ParseJsonString(CreateJsonContent(state.range(0)));
+    auto size = json->GetArraySize();
+    for (auto _ : state) {
+        double widthSum = 0.0;
+        for (int32_t i = 0; i < size; ++i) {
+            auto item = json->GetArrayItem(i);
+            widthSum += item->GetDouble("width");
+            benchmark::DoNotOptimize(item->GetValue("attrs")->GetString("padding"));
+        }
+        benchmark::DoNotOptimize(widthSum);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(JsonUtilGetValue)->RangeMultiplier(8)->Range(8, 4096);
+
+static void JsonUtilToString(benchmark::State& state)
+{
+    auto json = JsonUtil::ParseJsonString(CreateJsonContent(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(json->ToString());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(JsonUtilToString)->RangeMultiplier(8)->Range(8, 4096);
+} // namespace OHOS::Ace
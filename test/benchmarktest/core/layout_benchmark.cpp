@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "gmock/gmock.h"
+
+#define private public
+#define protected public
+#include "test/mock/base/mock_task_executor.h"
+#include "test/mock/core/common/mock_container.h"
+#include "test/mock/core/common/mock_theme_manager.h"
+#include "test/mock/core/pipeline/mock_pipeline_base.h"
+#include "test/unittest/core/pattern/test_ng.h"
+
+#include "core/components/list/list_item_theme.h"
+#include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/grid/grid_item_model_ng.h"
+#include "core/components_ng/pattern/grid/grid_item_theme.h"
+#include "core/components_ng/pattern/grid/grid_layout_info.h"
+#include "core/components_ng/pattern/grid/grid_model_ng.h"
+#include "core/components_ng/pattern/grid/grid_pattern.h"
+#include "core/components_ng/pattern/list/list_item_model_ng.h"
+#include "core/components_ng/pattern/list/list_model_ng.h"
+#include "core/components_ng/pattern/list/list_pattern.h"
+#include "core/components_ng/pattern/scroll_bar/proxy/scroll_bar_proxy.h"
+#include "core/components_ng/pattern/scrollable/scrollable_properties.h"
+
+using namespace testing;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr float ITEM_HEIGHT = 100.0f;
+constexpr float SCROLL_DELTA = 37.0f;
+constexpr float GRID_MAIN_GAP = 10.0f;
+constexpr int32_t GRID_CROSS_COUNT = 4;
+// a long feed, laid out in 4 columns on phones and 8 on tablets.
+constexpr int32_t GRID_ITEM_COUNT = 100000;
+constexpr int32_t GRID_PHONE_CROSS_COUNT = 4;
+constexpr int32_t GRID_TABLET_CROSS_COUNT = 8;
+constexpr int32_t GRID_FLING_LINE_COUNT = 5;
+
+// Same environment as ListTestNg, every theme is a default one.
+class LayoutEnvironment {
+public:
+    LayoutEnvironment()
+    {
+        MockContainer::SetUp();
+        MockPipelineBase::SetUp();
+        MockContainer::Current()->taskExecutor_ = AceType::MakeRefPtr<MockTaskExecutor>();
+        auto themeManager = AceType::MakeRefPtr<NiceMock<MockThemeManager>>();
+        MockPipelineBase::GetCurrent()->SetThemeManager(themeManager);
+        ON_CALL(*themeManager, GetTheme(_)).WillByDefault(Return(AceType::MakeRefPtr<ListItemTheme>()));
+        ON_CALL(*themeManager, GetTheme(GridItemTheme::TypeId()))
+            .WillByDefault(Return(AceType::MakeRefPtr<GridItemTheme>()));
+    }
+
+    ~LayoutEnvironment()
+    {
+        MockPipelineBase::TearDown();
+        MockContainer::TearDown();
+    }
+};
+
+RefPtr<FrameNode> CreateList(int32_t itemCount)
+{
+    ListModelNG model;
+    model.Create();
+    RefPtr<ScrollControllerBase> scrollController = model.CreateScrollController();
+    RefPtr<ScrollProxy> proxy = AceType::MakeRefPtr<ScrollBarProxy>();
+    model.SetScroller(scrollController, proxy);
+    for (int32_t index = 0; index < itemCount; ++index) {
+        ListItemModelNG itemModel;
+        itemModel.Create([](int32_t) {}, V2::ListItemStyle::NONE);
+        TestNG::SetHeight(Dimension(ITEM_HEIGHT));
+        TestNG::SetWidth(FILL_LENGTH);
+        ViewStackProcessor::GetInstance()->Pop();
+    }
+    return AceType::DynamicCast<FrameNode>(ViewStackProcessor::GetInstance()->Finish());
+}
+
+RefPtr<FrameNode> CreateGrid(int32_t itemCount, int32_t crossCount)
+{
+    GridModelNG model;
+    RefPtr<ScrollControllerBase> positionController = model.CreatePositionController();
+    RefPtr<ScrollProxy> scrollBarProxy = model.CreateScrollBarProxy();
+    model.Create(positionController, scrollBarProxy);
+    std::string columnsTemplate = "1fr";
+    for (int32_t cross = 1; cross < crossCount; ++cross) {
+        columnsTemplate.append(" 1fr");
+    }
+    model.SetColumnsTemplate(columnsTemplate);
+    model.SetRowsGap(Dimension(GRID_MAIN_GAP));
+    for (int32_t index = 0; index < itemCount; ++index) {
+        GridItemModelNG itemModel;
+        itemModel.Create(GridItemStyle::NONE);
+        TestNG::SetHeight(Dimension(ITEM_HEIGHT));
+        ViewStackProcessor::GetInstance()->Pop();
+    }
+    return AceType::DynamicCast<FrameNode>(ViewStackProcessor::GetInstance()->Finish());
+}
+
+GridLayoutInfo CreateGridLayoutInfo(int32_t lineCount, int32_t crossCount = GRID_CROSS_COUNT)
+{
+    GridLayoutInfo info;
+    for (int32_t line = 0; line < lineCount; ++line) {
+        for (int32_t cross = 0; cross < crossCount; ++cross) {
+            info.gridMatrix_[line][cross] = line * crossCount + cross;
+        }
+        // lines are not the same height, as with text of different lengths.
+        info.lineHeightMap_[line] = ITEM_HEIGHT + line % 3 * GRID_MAIN_GAP;
+    }
+    info.childrenCount_ = lineCount * crossCount;
+    info.endIndex_ = info.childrenCount_ - 1;
+    return info;
+}
+} // namespace
+
+// One frame of a finger scroll over a List, items leaving the viewport are recycled and new ones measured.
+static void ListScrollFrame(benchmark::State& state)
+{
+    LayoutEnvironment environment;
+    TestNG layout;
+    auto frameNode = CreateList(state.range(0));
+    auto pattern = frameNode->GetPattern<ListPattern>();
+    layout.RunMeasureAndLayout(frameNode);
+    auto delta = -SCROLL_DELTA;
+    for (auto _ : state) {
+        // turn around at both ends, so that every frame scrolls.
+        if (pattern->IsAtBottom() && delta < 0.0f) {
+            delta = SCROLL_DELTA;
+        } else if (pattern->IsAtTop() && delta > 0.0f) {
+            delta = -SCROLL_DELTA;
+        }
+        pattern->UpdateCurrentOffset(delta, SCROLL_FROM_UPDATE);
+        layout.RunMeasureAndLayout(frameNode);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ListScrollFrame)->RangeMultiplier(8)->Range(16, 4096);
+
+// What Grid computes for its scroll bar on every scroll frame once the lines are measured.
+static void GridContentOffset(benchmark::State& state)
+{
+    auto info = CreateGridLayoutInfo(state.range(0));
+    int32_t line = 0;
+    for (auto _ : state) {
+        info.startMainLineIndex_ = line++ % state.range(0);
+        benchmark::DoNotOptimize(info.GetContentOffset(GRID_MAIN_GAP));
+        benchmark::DoNotOptimize(info.GetContentHeight(GRID_MAIN_GAP));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GridContentOffset)->RangeMultiplier(8)->Range(8, 4096);
+
+// The layout algorithm works on a copy of the info, so the line height index is built again after each layout.
+static void GridContentOffsetAfterLayout(benchmark::State& state)
+{
+    auto info = CreateGridLayoutInfo(state.range(0));
+    for (auto _ : state) {
+        GridLayoutInfo copy = info;
+        benchmark::DoNotOptimize(copy.GetContentOffset(GRID_MAIN_GAP));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GridContentOffsetAfterLayout)->RangeMultiplier(8)->Range(8, 4096);
+
+// One frame of a finger scroll over a Grid of GRID_ITEM_COUNT items, in state.range(0) columns.
+static void GridScrollFrame(benchmark::State& state)
+{
+    LayoutEnvironment environment;
+    TestNG layout;
+    auto frameNode = CreateGrid(GRID_ITEM_COUNT, state.range(0));
+    auto pattern = frameNode->GetPattern<GridPattern>();
+    layout.RunMeasureAndLayout(frameNode);
+    auto delta = -SCROLL_DELTA;
+    for (auto _ : state) {
+        if (pattern->IsAtBottom() && delta < 0.0f) {
+            delta = SCROLL_DELTA;
+        } else if (pattern->IsAtTop() && delta > 0.0f) {
+            delta = -SCROLL_DELTA;
+        }
+        pattern->UpdateCurrentOffset(delta, SCROLL_FROM_UPDATE);
+        layout.RunMeasureAndLayout(frameNode);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GridScrollFrame)->Arg(GRID_PHONE_CROSS_COUNT)->Arg(GRID_TABLET_CROSS_COUNT);
+
+// Scroll bar offset of a fling deep into a Grid of GRID_ITEM_COUNT items whose lines are all measured, in
+// state.range(0) columns.
+static void GridFlingContentOffset(benchmark::State& state)
+{
+    auto lineCount = GRID_ITEM_COUNT / state.range(0);
+    auto info = CreateGridLayoutInfo(lineCount, state.range(0));
+    int32_t line = 0;
+    for (auto _ : state) {
+        // a fling moves by several lines per frame.
+        line = (line + GRID_FLING_LINE_COUNT) % lineCount;
+        info.startMainLineIndex_ = line;
+        benchmark::DoNotOptimize(info.GetContentOffset(GRID_MAIN_GAP));
+        benchmark::DoNotOptimize(info.GetContentHeight(GRID_MAIN_GAP));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GridFlingContentOffset)->Arg(GRID_PHONE_CROSS_COUNT)->Arg(GRID_TABLET_CROSS_COUNT);
+} // namespace OHOS::Ace::NG
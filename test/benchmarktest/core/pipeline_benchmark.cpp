@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "gmock/gmock.h"
+
+#define private public
+#define protected public
+#include "test/mock/base/mock_task_executor.h"
+#include "test/mock/core/common/mock_container.h"
+#include "test/mock/core/common/mock_window.h"
+#include "test/mock/core/render/mock_render_context.h"
+
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/event/touch_event.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/property/property.h"
+#include "core/pipeline/base/element_register.h"
+#include "core/pipeline_ng/pipeline_context.h"
+
+using namespace testing;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t DEFAULT_INSTANCE_ID = 0;
+constexpr float ROOT_WIDTH = 480.0f;
+constexpr float ROOT_HEIGHT = 800.0f;
+// leaves of the tree are laid out in a grid of cells this big.
+constexpr float CELL_SIZE = 20.0f;
+constexpr int32_t COLUMN_COUNT = static_cast<int32_t>(ROOT_WIDTH / CELL_SIZE);
+
+// Same setup as PipelineContextTestNg, the window is a nice mock as no frame is requested in a benchmark.
+RefPtr<PipelineContext> CreatePipelineContext()
+{
+    auto window = std::make_shared<NiceMock<MockWindow>>();
+    auto context = AceType::MakeRefPtr<PipelineContext>(
+        window, AceType::MakeRefPtr<MockTaskExecutor>(), nullptr, nullptr, DEFAULT_INSTANCE_ID);
+    context->SetEventManager(AceType::MakeRefPtr<EventManager>());
+    MockContainer::SetUp();
+    MockContainer::Current()->pipelineContext_ = context;
+    return context;
+}
+
+RefPtr<FrameNode> CreateNode(const RectF& rect)
+{
+    auto node = FrameNode::CreateFrameNode(
+        "BenchmarkNode", ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<Pattern>());
+    auto renderContext = AceType::DynamicCast<MockRenderContext>(node->GetRenderContext());
+    if (renderContext) {
+        renderContext->rect_ = rect;
+        renderContext->paintRect_ = rect;
+    }
+    node->GetGeometryNode()->SetFrameSize(rect.GetSize());
+    return node;
+}
+
+// A root with rows of |leafCount| leaves in total, every leaf a cell of a grid covering the root.
+RefPtr<FrameNode> CreateTree(int32_t leafCount, std::vector<RefPtr<FrameNode>>& leaves)
+{
+    auto root = CreateNode(RectF(0.0f, 0.0f, ROOT_WIDTH, ROOT_HEIGHT));
+    auto rowCount = (leafCount + COLUMN_COUNT - 1) / COLUMN_COUNT;
+    for (int32_t row = 0; row < rowCount; ++row) {
+        auto rowNode = CreateNode(RectF(0.0f, row * CELL_SIZE, ROOT_WIDTH, CELL_SIZE));
+        for (int32_t column = 0; column < COLUMN_COUNT && row * COLUMN_COUNT + column < leafCount; ++column) {
+            auto leaf = CreateNode(RectF(column * CELL_SIZE, 0.0f, CELL_SIZE, CELL_SIZE));
+            rowNode->AddChild(leaf);
+            leaves.emplace_back(leaf);
+        }
+        root->AddChild(rowNode);
+        rowNode->MarkNeedSyncRenderTree();
+        rowNode->RebuildRenderContextTree();
+    }
+    root->MarkNeedSyncRenderTree();
+    root->RebuildRenderContextTree();
+    root->SetActive();
+    root->SetRootMeasureNode();
+    LayoutConstraintF constraint;
+    constraint.selfIdealSize = { ROOT_WIDTH, ROOT_HEIGHT };
+    constraint.maxSize = { ROOT_WIDTH, ROOT_HEIGHT };
+    constraint.percentReference = { ROOT_WIDTH, ROOT_HEIGHT };
+    root->Measure(constraint);
+    root->Layout();
+    return root;
+}
+} // namespace
+
+// One frame of the UI thread after every leaf changed, dirty nodes are sorted, measured, laid out and rendered.
+static void PipelineFlushDirtyNodes(benchmark::State& state)
+{
+    auto context = CreatePipelineContext();
+    std::vector<RefPtr<FrameNode>> leaves;
+    auto root = CreateTree(state.range(0), leaves);
+    for (auto _ : state) {
+        for (const auto& leaf : leaves) {
+            leaf->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
+        }
+        context->FlushUITasks();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    context->window_.reset();
+    MockContainer::TearDown();
+}
+BENCHMARK(PipelineFlushDirtyNodes)->RangeMultiplier(4)->Range(16, 1024);
+
+// Hit test of a touch down, half of the points land on a leaf, the others miss every leaf.
+static void PipelineTouchTest(benchmark::State& state)
+{
+    auto context = CreatePipelineContext();
+    std::vector<RefPtr<FrameNode>> leaves;
+    auto root = CreateTree(state.range(0), leaves);
+    TouchRestrict touchRestrict { TouchRestrict::NONE };
+    int32_t index = 0;
+    for (auto _ : state) {
+        auto cell = index++ % (static_cast<int32_t>(leaves.size()) * 2);
+        PointF point((cell % COLUMN_COUNT + 0.5f) * CELL_SIZE, (cell / COLUMN_COUNT + 0.5f) * CELL_SIZE);
+        TouchTestResult result;
+        benchmark::DoNotOptimize(root->TouchTest(point, point, point, touchRestrict, result, 0));
+    }
+    state.SetItemsProcessed(state.iterations());
+    context->window_.reset();
+    MockContainer::TearDown();
+}
+BENCHMARK(PipelineTouchTest)->RangeMultiplier(4)->Range(16, 1024);
+} // namespace OHOS::Ace::NG
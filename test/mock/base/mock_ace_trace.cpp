@@ -16,6 +16,13 @@
 #include "base/log/ace_trace.h"
 
 namespace OHOS::Ace {
+uint32_t GetAceTraceCategoryMask()
+{
+    return ACE_TRACE_CATEGORY_ALL;
+}
+
+void SetAceTraceCategoryMask(uint32_t /* mask */) {}
+
 bool AceTraceEnabled()
 {
     return false;
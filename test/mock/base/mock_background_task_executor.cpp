@@ -40,9 +40,24 @@ bool BackgroundTaskExecutor::PostTask(const Task& task, BgTaskPriority priority)
     return true;
 }
 
+bool BackgroundTaskExecutor::PostTask(Task&& task, BgTaskPriority priority, const RefPtr<BgTaskGroup>& group)
+{
+    return true;
+}
+
 void BackgroundTaskExecutor::StartNewThreads(size_t num) {}
 
 void BackgroundTaskExecutor::ThreadLoop(uint32_t threadNo) {}
 
 void BackgroundTaskExecutor::TriggerGarbageCollection() {}
+
+BgTaskMetrics BackgroundTaskExecutor::GetMetrics() const
+{
+    return BgTaskMetrics();
+}
+
+std::string BgTaskMetrics::ToString() const
+{
+    return "";
+}
 } // namespace OHOS::Ace
@@ -29,6 +29,13 @@ void JankFrameReport::FlushRecord() {}
 
 void JankFrameReport::RecordFrameUpdate() {}
 
+bool JankFrameReport::IsRecording()
+{
+    return false;
+}
+
+void JankFrameReport::AttributeFrame(JankAttribution& attribution, int64_t vsyncTime, int64_t duration) {}
+
 PerfMonitor* PerfMonitor::GetPerfMonitor()
 {
     return nullptr;
@@ -40,9 +47,9 @@ void PerfMonitor::End(const std::string& sceneId, bool isJsApi) {}
 
 void PerfMonitor::SetPageUrl(const std::string& pageUrl) {}
 
-void PerfMonitor::SetFrameTime(int64_t vsyncTime, int64_t durition, double jank) {}
+void PerfMonitor::SetFrameTime(int64_t vsyncTime, int64_t durition, double jank, const std::string& jankCause) {}
 
-void PerfMonitor::ReportJankFrameApp(double jank) {}
+void PerfMonitor::ReportJankFrameApp(double jank, const std::string& jankCause) {}
 
 void PerfMonitor::RecordInputEvent(PerfActionType type, PerfSourceType sourceType, int64_t time) {}
 
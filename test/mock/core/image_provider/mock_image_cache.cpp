@@ -45,4 +45,13 @@ void ImageCache::Purge() {}
 
 void ImageCache::ClearCacheImage(const std::string& key) {}
 void ImageCache::Clear() {}
+
+void ImageCache::SetDataCacheLimit(size_t sizeLimit) {}
+
+void ImageCache::NotifyMemoryLevel(int32_t level) {}
+
+std::string ImageCache::GetMetrics() const
+{
+    return "";
+}
 } // namespace OHOS::Ace
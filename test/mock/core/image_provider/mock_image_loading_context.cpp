@@ -130,6 +130,11 @@ bool ImageLoadingContext::GetAutoResize() const
 
 void ImageLoadingContext::SetSourceSize(const std::optional<SizeF>& sourceSize) {}
 
+void ImageLoadingContext::SetVisible(bool visible)
+{
+    visible_ = visible;
+}
+
 std::optional<SizeF> ImageLoadingContext::GetSourceSize() const
 {
     return std::optional<SizeF>();
@@ -34,6 +34,15 @@ ElementRegister* ElementRegister::GetInstance()
     return (ElementRegister::instance_);
 }
 
+ElementRegister::ItemSlot* ElementRegister::CreateSlot(ElementIdType elmtId)
+{
+    if (slots_.Find(elmtId)) {
+        LOGE("Duplicate elmtId %{public}d error.", elmtId);
+        return nullptr;
+    }
+    return slots_.Create(elmtId, nextUniqueElementId_);
+}
+
 RefPtr<Element> ElementRegister::GetElementById(ElementIdType elementId)
 {
     return nullptr;
@@ -44,8 +53,14 @@ RefPtr<AceType> ElementRegister::GetNodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto position = itemMap_.find(elementId);
-    return position == itemMap_.end() ? nullptr : position->second.Upgrade();
+    auto slot = slots_.Find(elementId);
+    if (!slot) {
+        return nullptr;
+    }
+    if (slot->uiNode.Invalid()) {
+        return slot->item.Upgrade();
+    }
+    return slot->uiNode.Upgrade();
 }
 
 RefPtr<V2::ElementProxy> ElementRegister::GetElementProxyById(ElementIdType /* elementId */)
@@ -55,25 +70,40 @@ RefPtr<V2::ElementProxy> ElementRegister::GetElementProxyById(ElementIdType /* e
 
 bool ElementRegister::Exists(ElementIdType elementId)
 {
-    return (itemMap_.find(elementId) != itemMap_.end());
+    return slots_.Find(elementId) != nullptr;
 }
 
 void ElementRegister::UpdateRecycleElmtId(int32_t oldElmtId, int32_t newElmtId)
 {
-    if (!Exists(oldElmtId)) {
+    auto oldSlot = slots_.Find(oldElmtId);
+    if (!oldSlot) {
         return;
     }
-    auto node = GetNodeById(oldElmtId);
+    auto node = oldSlot->uiNode.Upgrade();
     if (node) {
-        itemMap_.erase(oldElmtId);
-        AddReferenced(newElmtId, node);
+        slots_.Erase(oldElmtId, nextUniqueElementId_);
+        AddUINode(newElmtId, node);
+        return;
+    }
+    auto item = oldSlot->item.Upgrade();
+    if (item) {
+        slots_.Erase(oldElmtId, nextUniqueElementId_);
+        AddReferenced(newElmtId, item);
     }
 }
 
 bool ElementRegister::AddReferenced(ElementIdType elmtId, const WeakPtr<AceType>& referenced)
 {
-    auto result = itemMap_.emplace(elmtId, referenced);
-    return result.second;
+    auto node = AceType::DynamicCast<NG::UINode>(referenced.Upgrade());
+    if (node) {
+        return AddUINode(elmtId, node);
+    }
+    auto slot = CreateSlot(elmtId);
+    if (!slot) {
+        return false;
+    }
+    slot->item = referenced;
+    return true;
 }
 
 bool ElementRegister::AddElement(const RefPtr<Element>& element)
@@ -94,8 +124,21 @@ RefPtr<NG::UINode> ElementRegister::GetUINodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto iter = itemMap_.find(elementId);
-    return iter == itemMap_.end() ? nullptr : AceType::DynamicCast<NG::UINode>(iter->second).Upgrade();
+    auto slot = slots_.Find(elementId);
+    return slot ? slot->uiNode.Upgrade() : nullptr;
+}
+
+RefPtr<NG::FrameNode> ElementRegister::GetFrameNodeById(ElementIdType elementId)
+{
+    if (elementId == ElementRegister::UndefinedElementId) {
+        return nullptr;
+    }
+    auto slot = slots_.Find(elementId);
+    if (!slot || !slot->isFrameNode) {
+        return nullptr;
+    }
+    auto node = slot->uiNode.Upgrade();
+    return node ? Referenced::Claim(static_cast<NG::FrameNode*>(AceType::RawPtr(node))) : nullptr;
 }
 
 bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
@@ -103,7 +146,30 @@ bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
     if (!node || (node->GetId() == ElementRegister::UndefinedElementId)) {
         return false;
     }
-    return AddReferenced(node->GetId(), node);
+    return AddUINode(node->GetId(), node);
+}
+
+bool ElementRegister::AddUINode(ElementIdType elmtId, const RefPtr<NG::UINode>& node)
+{
+    auto slot = CreateSlot(elmtId);
+    if (!slot) {
+        return false;
+    }
+    slot->uiNode = node;
+    slot->isFrameNode = AceType::InstanceOf<NG::FrameNode>(node);
+    return true;
+}
+
+ElementHandle ElementRegister::GetHandle(ElementIdType elementId)
+{
+    auto slot = slots_.Find(elementId);
+    return slot ? ElementHandle { elementId, slot->generation } : ElementHandle();
+}
+
+RefPtr<NG::UINode> ElementRegister::GetUINodeByHandle(const ElementHandle& handle)
+{
+    auto slot = slots_.Find(handle.elmtId);
+    return slot && slot->generation == handle.generation ? slot->uiNode.Upgrade() : nullptr;
 }
 
 bool ElementRegister::RemoveItem(ElementIdType elementId, const std::string& tag)
@@ -111,7 +177,7 @@ bool ElementRegister::RemoveItem(ElementIdType elementId, const std::string& tag
     if (elementId == ElementRegister::UndefinedElementId) {
         return false;
     }
-    auto removed = itemMap_.erase(elementId);
+    auto removed = slots_.Erase(elementId, nextUniqueElementId_);
     if (removed) {
         removedItems_.insert(std::pair(elementId, tag));
     }
@@ -123,18 +189,18 @@ bool ElementRegister::RemoveItemSilently(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return false;
     }
-    return itemMap_.erase(elementId);
+    return slots_.Erase(elementId, nextUniqueElementId_);
 }
 
 void ElementRegister::MoveRemovedItems(RemovedElementsType& removedItems)
 {
-    removedItems = removedItems_;
-    removedItems_ = std::unordered_set<std::pair<ElementIdType, std::string>, deleted_element_hash>();
+    removedItems.swap(removedItems_);
+    removedItems_.clear();
 }
 
 void ElementRegister::Clear()
 {
-    itemMap_.clear();
+    slots_.Clear();
     removedItems_.clear();
     geometryTransitionMap_.clear();
     pendingRemoveNodes_.clear();
@@ -273,6 +273,10 @@ const RefPtr<OverlayManager>& PipelineContext::GetOverlayManager()
 
 void PipelineContext::AddPredictTask(PredictTask&& task) {}
 
+void PipelineContext::AddPredictTask(
+    PredictTask&& task, PredictTaskPriority priority, const WeakPtr<AceType>& owner, PredictTaskType type)
+{}
+
 void PipelineContext::AddAfterLayoutTask(std::function<void()>&& task)
 {
     if (task) {
@@ -56,7 +56,13 @@ public:
         return rect_;
     }
 
+    RectF GetPaintRectWithoutTransform() override
+    {
+        return paintRect_;
+    }
+
     RectF rect_;
+    RectF paintRect_;
     Color blendColor_ = Color::TRANSPARENT;
     std::vector<double> transInfo_ = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 };
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "base/thread/background_task_executor.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t USER_VISIBLE = static_cast<size_t>(BgTaskPriority::USER_VISIBLE);
+constexpr size_t PREFETCH = static_cast<size_t>(BgTaskPriority::PREFETCH);
+constexpr size_t MAINTENANCE = static_cast<size_t>(BgTaskPriority::MAINTENANCE);
+// bucket 5 counts the tasks which waited in [16, 32) ms.
+constexpr size_t WAIT_BUCKET = 5;
+constexpr auto WAIT_TIME = std::chrono::milliseconds(20);
+
+// Counts events of the background threads, the test thread waits for a number of them.
+class Counter {
+public:
+    void Increase()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++count_;
+        condition_.notify_all();
+    }
+
+    void Wait(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this, count]() { return count_ >= count; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    size_t count_ = 0;
+};
+
+// Occupies every background thread, so that tasks queue up until the threads are released one by one.
+class ThreadBlocker {
+public:
+    ThreadBlocker()
+    {
+        auto& executor = BackgroundTaskExecutor::GetInstance();
+        threadNum_ = executor.maxThreadNum_;
+        for (size_t i = 0; i < threadNum_; ++i) {
+            executor.PostTask(
+                [this]() {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    ++blockedNum_;
+                    condition_.notify_all();
+                    condition_.wait(lock, [this]() { return releaseNum_ > 0; });
+                    --releaseNum_;
+                    --blockedNum_;
+                    condition_.notify_all();
+                },
+                BgTaskPriority::USER_VISIBLE);
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return blockedNum_ == threadNum_; });
+    }
+
+    ~ThreadBlocker()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        releaseNum_ += blockedNum_;
+        condition_.notify_all();
+        condition_.wait(lock, [this]() { return blockedNum_ == 0; });
+    }
+
+    void ReleaseOne()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++releaseNum_;
+        condition_.notify_all();
+    }
+
+    size_t GetThreadNum() const
+    {
+        return threadNum_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    size_t threadNum_ = 0;
+    size_t blockedNum_ = 0;
+    size_t releaseNum_ = 0;
+};
+} // namespace
+
+class BackgroundTaskExecutorTest : public testing::Test {};
+
+/**
+ * @tc.name: BackgroundTaskExecutorTest001
+ * @tc.desc: Run queued tasks by priority, stealing them from the queues of the other threads
+ * @tc.type: FUNC
+ */
+HWTEST_F(BackgroundTaskExecutorTest, BackgroundTaskExecutorTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. queue tasks of every priority while all the threads are busy.
+     */
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    ThreadBlocker blocker;
+    auto before = executor.GetMetrics();
+    std::mutex mutex;
+    std::vector<std::string> order;
+    Counter counter;
+    auto post = [&](const std::string& name, BgTaskPriority priority) {
+        EXPECT_TRUE(executor.PostTask(
+            [&, name]() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    order.push_back(name);
+                }
+                counter.Increase();
+            },
+            priority));
+    };
+    post("maintenance", BgTaskPriority::MAINTENANCE);
+    post("prefetch", BgTaskPriority::PREFETCH);
+    post("userVisible", BgTaskPriority::USER_VISIBLE);
+    post("prefetch", BgTaskPriority::PREFETCH);
+    post("maintenance", BgTaskPriority::MAINTENANCE);
+
+    /**
+     * @tc.steps: step2. release one thread.
+     * @tc.expected: step2. it runs the higher priorities first. The tasks were spread over the queues of all the
+     *                      threads, all but one of them are stolen.
+     */
+    blocker.ReleaseOne();
+    counter.Wait(5);
+    std::vector<std::string> expectedOrder { "userVisible", "prefetch", "prefetch", "maintenance", "maintenance" };
+    EXPECT_EQ(order, expectedOrder);
+    auto after = executor.GetMetrics();
+    EXPECT_EQ(after.executedCount[USER_VISIBLE] - before.executedCount[USER_VISIBLE], 1);
+    EXPECT_EQ(after.executedCount[PREFETCH] - before.executedCount[PREFETCH], 2);
+    EXPECT_EQ(after.executedCount[MAINTENANCE] - before.executedCount[MAINTENANCE], 2);
+    ASSERT_GT(blocker.GetThreadNum(), 1);
+    EXPECT_GE(after.stolenCount - before.stolenCount, 4);
+}
+
+/**
+ * @tc.name: BackgroundTaskExecutorTest002
+ * @tc.desc: Drop the queued tasks of a canceled group
+ * @tc.type: FUNC
+ */
+HWTEST_F(BackgroundTaskExecutorTest, BackgroundTaskExecutorTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. queue tasks of a group while all the threads are busy, then cancel the group.
+     * @tc.expected: step1. tasks of the canceled group are not queued any more.
+     */
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    ThreadBlocker blocker;
+    auto before = executor.GetMetrics();
+    auto group = Referenced::MakeRefPtr<BgTaskGroup>();
+    std::atomic<int32_t> runCount { 0 };
+    for (int32_t i = 0; i < 3; ++i) {
+        EXPECT_TRUE(executor.PostTask([&runCount]() { ++runCount; }, BgTaskPriority::PREFETCH, group));
+    }
+    Counter counter;
+    EXPECT_TRUE(executor.PostTask([&counter]() { counter.Increase(); }, BgTaskPriority::MAINTENANCE));
+    group->Cancel();
+    EXPECT_FALSE(executor.PostTask([&runCount]() { ++runCount; }, BgTaskPriority::PREFETCH, group));
+
+    /**
+     * @tc.steps: step2. release one thread.
+     * @tc.expected: step2. the tasks of the group are dropped and counted, the other task runs.
+     */
+    blocker.ReleaseOne();
+    counter.Wait(1);
+    EXPECT_EQ(runCount, 0);
+    auto after = executor.GetMetrics();
+    EXPECT_EQ(after.canceledCount[PREFETCH] - before.canceledCount[PREFETCH], 3);
+    EXPECT_EQ(after.executedCount[PREFETCH] - before.executedCount[PREFETCH], 0);
+    EXPECT_EQ(after.executedCount[MAINTENANCE] - before.executedCount[MAINTENANCE], 1);
+}
+
+/**
+ * @tc.name: BackgroundTaskExecutorTest003
+ * @tc.desc: Cancel a group while one of its tasks runs
+ * @tc.type: FUNC
+ */
+HWTEST_F(BackgroundTaskExecutorTest, BackgroundTaskExecutorTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. queue a long task of a group and more tasks behind it, then release one thread.
+     */
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    ThreadBlocker blocker;
+    auto before = executor.GetMetrics();
+    auto group = Referenced::MakeRefPtr<BgTaskGroup>();
+    Counter started;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool finish = false;
+    std::atomic<bool> finished { false };
+    EXPECT_TRUE(executor.PostTask(
+        [&]() {
+            started.Increase();
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&finish]() { return finish; });
+            finished = true;
+        },
+        BgTaskPriority::USER_VISIBLE, group));
+    std::atomic<int32_t> runCount { 0 };
+    for (int32_t i = 0; i < 2; ++i) {
+        EXPECT_TRUE(executor.PostTask([&runCount]() { ++runCount; }, BgTaskPriority::PREFETCH, group));
+    }
+    Counter counter;
+    EXPECT_TRUE(executor.PostTask([&counter]() { counter.Increase(); }, BgTaskPriority::MAINTENANCE));
+    blocker.ReleaseOne();
+    started.Wait(1);
+
+    /**
+     * @tc.steps: step2. cancel the group while its first task runs, then let that task end.
+     * @tc.expected: step2. the running task is not interrupted, the tasks queued behind it are dropped.
+     */
+    group->Cancel();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finish = true;
+        condition.notify_all();
+    }
+    counter.Wait(1);
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(runCount, 0);
+    auto after = executor.GetMetrics();
+    EXPECT_EQ(after.executedCount[USER_VISIBLE] - before.executedCount[USER_VISIBLE], 1);
+    EXPECT_EQ(after.canceledCount[PREFETCH] - before.canceledCount[PREFETCH], 2);
+}
+
+/**
+ * @tc.name: BackgroundTaskExecutorTest004
+ * @tc.desc: Count the time tasks wait in the queue
+ * @tc.type: FUNC
+ */
+HWTEST_F(BackgroundTaskExecutorTest, BackgroundTaskExecutorTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. keep a task queued for a while before a thread is released.
+     * @tc.expected: step1. its wait is counted in a bucket at least as long, the buckets sum up to the executed tasks.
+     */
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    ThreadBlocker blocker;
+    auto before = executor.GetMetrics();
+    Counter counter;
+    EXPECT_TRUE(executor.PostTask([&counter]() { counter.Increase(); }, BgTaskPriority::MAINTENANCE));
+    std::this_thread::sleep_for(WAIT_TIME);
+    blocker.ReleaseOne();
+    counter.Wait(1);
+    auto after = executor.GetMetrics();
+    uint64_t waitCount = 0;
+    for (size_t bucket = WAIT_BUCKET; bucket < BgTaskMetrics::LATENCY_BUCKET_COUNT; ++bucket) {
+        waitCount += after.latencyHistogram[MAINTENANCE][bucket] - before.latencyHistogram[MAINTENANCE][bucket];
+    }
+    EXPECT_EQ(waitCount, 1);
+    for (size_t priority = 0; priority < BgTaskMetrics::PRIORITY_COUNT; ++priority) {
+        uint64_t bucketSum = 0;
+        for (auto count : after.latencyHistogram[priority]) {
+            bucketSum += count;
+        }
+        EXPECT_EQ(bucketSum, after.executedCount[priority]);
+    }
+
+    /**
+     * @tc.steps: step2. dump the metrics.
+     * @tc.expected: step2. every priority and the stolen tasks are printed.
+     */
+    auto dump = after.ToString();
+    EXPECT_NE(dump.find("userVisible: executed "), std::string::npos);
+    EXPECT_NE(dump.find("maintenance: executed "), std::string::npos);
+    EXPECT_NE(dump.find("stolen: "), std::string::npos);
+}
+} // namespace OHOS::Ace
@@ -14,14 +14,19 @@
  */
 
 #include <memory>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <ctime>
 #include <regex>
 #include <sys/time.h>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
 #include "base/utils/base_id.h"
 #include "base/utils/date_util.h"
 #include "base/log/log.h"
@@ -93,6 +98,19 @@ const std::wstring TEST_INPUT_W_STRING = L"THIS IS A STRING";
 const std::wstring DEFAULT_WSTRING = L"error";
 const char TEST_INPUT_ARGS_ONE[MAX_STRING_SIZE] = "TODAY";
 const std::vector<int64_t> RESOURCEHANDLERS = {255};
+
+class PooledObject : public AceType {
+    DECLARE_ACE_TYPE(PooledObject, AceType);
+    ACE_POOLED_ALLOCATION();
+
+public:
+    PooledObject() = default;
+    ~PooledObject() override = default;
+
+private:
+    // as large as a node, its pool differs from the one of the reference counter.
+    std::array<uint8_t, 256> payload_ {};
+};
 } // namespace
 
 class BaseUtilsTest : public testing::Test {
@@ -841,4 +859,112 @@ HWTEST_F(BaseUtilsTest, BaseUtilsTest042, TestSize.Level1)
     ASSERT_EQ(StringUtils::EndWith(startWithValue, prefixString), true);
     ASSERT_EQ(StringUtils::EndWith(startWithValue, prefixString), true);
 }
+
+/**
+ * @tc.name: BaseUtilsTest043
+ * @tc.desc: Instances with pooled allocation take aligned blocks, which a weak reference left behind does not pin.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest043, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a pooled instance and keep a weak reference to it.
+     * @tc.expected: the block is aligned and counted as used.
+     */
+    auto pool = SlabPool::GetPool(sizeof(PooledObject));
+    ASSERT_NE(pool, nullptr);
+    SlabPool::FlushThreadCache();
+    auto usedCount = pool->GetUsedCount();
+    WeakPtr<PooledObject> weak;
+    {
+        auto object = AceType::MakeRefPtr<PooledObject>();
+        weak = object;
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(AceType::RawPtr(object)) % SlabPool::BLOCK_ALIGNMENT, 0);
+        SlabPool::FlushThreadCache();
+        EXPECT_EQ(pool->GetUsedCount(), usedCount + 1);
+    }
+
+    /**
+     * @tc.steps: step2. destroy the instance while the weak reference remains.
+     * @tc.expected: the block returns to the pool at once.
+     */
+    EXPECT_TRUE(weak.Invalid());
+    EXPECT_EQ(weak.Upgrade(), nullptr);
+    SlabPool::FlushThreadCache();
+    EXPECT_EQ(pool->GetUsedCount(), usedCount);
+}
+
+/**
+ * @tc.name: BaseUtilsTest044
+ * @tc.desc: Compiled calc formulas give the results of the formulas and are shared.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest044, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. compile formulas without unit, with errors and with units.
+     * @tc.expected: formulas without unit or with errors give 0, the others are calculated with calcFunc.
+     */
+    auto calcFunc = [](const Dimension& dim) -> double { return dim.Value(); };
+    auto doubleVpFunc = [](const Dimension& dim) -> double {
+        return dim.Unit() == DimensionUnit::VP ? dim.Value() * 2 : dim.Value();
+    };
+    const std::string calcFormula = "calc(100px - 2vp * 3)";
+    EXPECT_EQ(StringExpression::CompiledExpression::Compile(FORMULA_ONE)->Calculate(calcFunc), NORMAL_CALC_RESULT);
+    EXPECT_EQ(StringExpression::CompiledExpression::Compile(FORMULA_TWO)->Calculate(calcFunc), ERROR_CALC_RESULT);
+    EXPECT_EQ(StringExpression::CompiledExpression::Compile(FORMULA_THREE)->Calculate(calcFunc), ERROR_CALC_RESULT);
+    EXPECT_EQ(StringExpression::CompiledExpression::Compile(calcFormula)->Calculate(calcFunc), 94.0);
+    EXPECT_EQ(StringExpression::CompiledExpression::Compile(calcFormula)->Calculate(doubleVpFunc), 88.0);
+    EXPECT_FALSE(StringExpression::CompiledExpression::Compile(FORMULA_THREE)->IsValid());
+    EXPECT_TRUE(StringExpression::CompiledExpression::Compile(calcFormula)->IsValid());
+
+    /**
+     * @tc.steps: step2. compile the same formula again, after compiling many other formulas.
+     * @tc.expected: the recently used formula is shared, not compiled again.
+     */
+    auto compiled = StringExpression::CompiledExpression::Compile(calcFormula);
+    for (int32_t i = 0; i < 1000; ++i) {
+        StringExpression::CompiledExpression::Compile("calc(" + std::to_string(i) + "px + 1px)");
+        EXPECT_EQ(StringExpression::CompiledExpression::Compile(calcFormula), compiled);
+    }
+}
+
+/**
+ * @tc.name: BaseUtilsTest045
+ * @tc.desc: Slab pools return empty slabs to the heap and take blocks freed on other threads.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest045, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. allocate blocks spanning several slabs.
+     * @tc.expected: every block is aligned, slabs are added.
+     */
+    auto pool = SlabPool::GetPool(SlabPool::MAX_BLOCK_SIZE);
+    ASSERT_NE(pool, nullptr);
+    SlabPool::FlushThreadCache();
+    auto usedCount = pool->GetUsedCount();
+    auto slabCount = pool->GetSlabCount();
+    const size_t blockCount = 8 * SlabPool::SLAB_SIZE / SlabPool::MAX_BLOCK_SIZE;
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < blockCount; ++i) {
+        blocks.push_back(pool->Allocate());
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks.back()) % SlabPool::BLOCK_ALIGNMENT, 0);
+    }
+    SlabPool::FlushThreadCache();
+    EXPECT_EQ(pool->GetUsedCount(), usedCount + blockCount);
+    EXPECT_GT(pool->GetSlabCount(), slabCount);
+
+    /**
+     * @tc.steps: step2. free the blocks on another thread, which exits afterwards.
+     * @tc.expected: the blocks are back in the pool and at most one empty slab is kept.
+     */
+    std::thread([&blocks] {
+        for (auto block : blocks) {
+            SlabPool::Deallocate(block);
+        }
+    }).join();
+    EXPECT_EQ(pool->GetUsedCount(), usedCount);
+    EXPECT_LE(pool->GetSlabCount(), slabCount + 1);
+}
 } // namespace OHOS::Ace
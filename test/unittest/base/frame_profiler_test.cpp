@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "base/log/frame_profiler.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+const std::string TEST_TAG = "Column";
+constexpr size_t TEST_CAPACITY = 6;
+constexpr int32_t TEST_RECORD_COUNT = 20;
+} // namespace
+
+class FrameProfilerTest : public testing::Test {
+public:
+    void TearDown() override
+    {
+        FrameProfiler::GetInstance().Disable();
+        FrameProfiler::GetInstance().Clear();
+    }
+};
+
+/**
+ * @tc.name: FrameProfilerTest001
+ * @tc.desc: Record tasks into the ring of FrameProfiler
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameProfilerTest, FrameProfilerTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a scope while the profiler is disabled.
+     * @tc.expected: step1. nothing is recorded.
+     */
+    auto& profiler = FrameProfiler::GetInstance();
+    {
+        FrameProfileScope scope(FramePhase::LAYOUT, 1, TEST_TAG);
+    }
+    EXPECT_TRUE(profiler.GetRecords().empty());
+
+    /**
+     * @tc.steps: step2. enable the profiler and record a node task and a frame.
+     * @tc.expected: step2. both are recorded in order, the tag of the node is interned.
+     */
+    profiler.Enable(TEST_CAPACITY);
+    {
+        FrameProfileScope scope(FramePhase::MEASURE, 2, TEST_TAG);
+    }
+    {
+        FrameProfileScope scope(FramePhase::FRAME, 3);
+    }
+    auto records = profiler.GetRecords();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].phase, FramePhase::MEASURE);
+    EXPECT_EQ(records[0].id, 2);
+    EXPECT_EQ(profiler.GetTag(records[0].tagId), TEST_TAG);
+    EXPECT_GE(records[0].duration, 0);
+    EXPECT_EQ(records[1].phase, FramePhase::FRAME);
+    EXPECT_EQ(records[1].tagId, FrameProfiler::UNKNOWN_TAG);
+    EXPECT_EQ(profiler.InternTag(TEST_TAG), records[0].tagId);
+
+    /**
+     * @tc.steps: step3. record more tasks than the ring holds.
+     * @tc.expected: step3. the capacity is a power of two, fixed by whichever test enabled the profiler first, and
+     *                      only the newest records are kept.
+     */
+    auto ringSize = profiler.capacity_;
+    ASSERT_GE(ringSize, TEST_CAPACITY);
+    EXPECT_EQ(ringSize & (ringSize - 1), 0);
+    profiler.Clear();
+    auto recordCount = static_cast<int32_t>(ringSize) + TEST_RECORD_COUNT;
+    for (int32_t i = 0; i < recordCount; ++i) {
+        profiler.Record(FramePhase::RENDER, i, FrameProfiler::UNKNOWN_TAG, i, 1);
+    }
+    records = profiler.GetRecords();
+    ASSERT_EQ(records.size(), ringSize);
+    EXPECT_EQ(records.front().id, TEST_RECORD_COUNT);
+    EXPECT_EQ(records.back().id, recordCount - 1);
+
+    /**
+     * @tc.steps: step4. disable the profiler and record again.
+     * @tc.expected: step4. the records are kept and nothing is added.
+     */
+    profiler.Disable();
+    profiler.Record(FramePhase::RENDER, recordCount, FrameProfiler::UNKNOWN_TAG, 0, 1);
+    EXPECT_EQ(profiler.GetRecords().back().id, recordCount - 1);
+}
+
+/**
+ * @tc.name: FrameProfilerTest002
+ * @tc.desc: Export the records of FrameProfiler as binary and as Chrome trace
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameProfilerTest, FrameProfilerTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a layout task of 1.5 microseconds.
+     */
+    auto& profiler = FrameProfiler::GetInstance();
+    profiler.Enable();
+    profiler.Clear();
+    auto tagId = profiler.InternTag(TEST_TAG);
+    profiler.Record(FramePhase::LAYOUT, 1, tagId, 2000, 1500);
+
+    /**
+     * @tc.steps: step2. dump the records as binary.
+     * @tc.expected: step2. the dump starts with the magic and ends with the record as it is in memory.
+     */
+    std::ostringstream binary;
+    profiler.DumpBinary(binary);
+    auto content = binary.str();
+    ASSERT_GT(content.size(), sizeof(FrameProfileRecord));
+    EXPECT_EQ(content.substr(0, 8), "ACEFPROF");
+    FrameProfileRecord record;
+    std::memcpy(&record, content.data() + content.size() - sizeof(record), sizeof(record));
+    EXPECT_EQ(record.id, 1);
+    EXPECT_EQ(record.tagId, tagId);
+    EXPECT_EQ(record.duration, 1500);
+
+    /**
+     * @tc.steps: step3. dump the records as Chrome trace.
+     * @tc.expected: step3. the task is a complete event in microseconds, named by its phase and tag.
+     */
+    std::ostringstream json;
+    profiler.DumpChromeTrace(json);
+    EXPECT_NE(json.str().find("\"name\":\"Layout Column\""), std::string::npos);
+    EXPECT_NE(json.str().find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.str().find("\"ts\":2.000,\"dur\":1.500"), std::string::npos);
+
+    /**
+     * @tc.steps: step4. record a task whose tag has a quote, a backslash and a control character, dump again.
+     * @tc.expected: step4. the tag is escaped in the JSON string.
+     */
+    profiler.Record(FramePhase::LAYOUT, 2, profiler.InternTag("a\"b\\c\n"), 4000, 1000);
+    std::ostringstream escapedJson;
+    profiler.DumpChromeTrace(escapedJson);
+    EXPECT_NE(escapedJson.str().find("\"name\":\"Layout a\\\"b\\\\c\\u000a\""), std::string::npos);
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "base/log/jank_attribution.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+const std::string PAGE_URL = "pages/Index";
+const std::string OTHER_PAGE_URL = "pages/Detail";
+const std::string LIST_TAG = "List";
+const std::string TEXT_TAG = "Text";
+const std::string VIEW_NAME = "ItemView";
+constexpr int64_t MILLI = 1000000;
+constexpr int64_t VSYNC_TIME = 1000 * MILLI;
+constexpr int64_t FRAME_DURATION = 40 * MILLI;
+constexpr double JANK = 2.4;
+constexpr double NO_JANK = 0.5;
+constexpr size_t JANK_RANGE = 0;
+constexpr int32_t TEXT_COUNT = 10;
+} // namespace
+
+class JankAttributionTest : public testing::Test {};
+
+/**
+ * @tc.name: JankAttributionTest001
+ * @tc.desc: Keep the most expensive nodes, tags and phases of a janky frame
+ * @tc.type: FUNC
+ */
+HWTEST_F(JankAttributionTest, JankAttributionTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a frame without jank.
+     * @tc.expected: step1. the frame is counted for the page, its causes are not kept.
+     */
+    JankAttribution attribution;
+    auto& profiler = FrameProfiler::GetInstance();
+    auto listTagId = profiler.InternTag(LIST_TAG);
+    auto textTagId = profiler.InternTag(TEXT_TAG);
+    auto viewTagId = profiler.InternTag(VIEW_NAME);
+    attribution.AddNodeCost(FramePhase::LAYOUT, listTagId, 1, MILLI);
+    EXPECT_EQ(attribution.EndFrame(PAGE_URL, VSYNC_TIME, MILLI, NO_JANK, JANK_RANGE), nullptr);
+    ASSERT_EQ(attribution.GetPages().size(), 1);
+    EXPECT_EQ(attribution.GetPages().front().frameCount, 1);
+    EXPECT_TRUE(attribution.GetJankFrames().empty());
+
+    /**
+     * @tc.steps: step2. record a janky frame with an expensive list, a custom node and more texts than kept.
+     * @tc.expected: step2. the most expensive nodes are kept first, costs are summed by tag and phase.
+     */
+    for (int32_t i = 0; i < TEXT_COUNT; ++i) {
+        attribution.AddNodeCost(FramePhase::RENDER, textTagId, i + 10, MILLI + i);
+    }
+    attribution.AddNodeCost(FramePhase::LAYOUT, listTagId, 1, 30 * MILLI);
+    attribution.AddNodeCost(FramePhase::BUILD, viewTagId, 2, 5 * MILLI);
+    attribution.AddPhaseCost(FramePhase::ANIMATION, MILLI);
+    auto cause = attribution.EndFrame(PAGE_URL, VSYNC_TIME, FRAME_DURATION, JANK, JANK_RANGE + 2);
+    ASSERT_NE(cause, nullptr);
+    ASSERT_EQ(cause->nodes.size(), JankAttribution::TOP_COUNT);
+    EXPECT_EQ(cause->nodes[0].tag, LIST_TAG);
+    EXPECT_EQ(cause->nodes[0].phase, FramePhase::LAYOUT);
+    EXPECT_EQ(cause->nodes[1].id, 2);
+    EXPECT_EQ(cause->nodes[2].id, 10 + TEXT_COUNT - 1);
+    EXPECT_EQ(cause->nodes[4].id, 10 + TEXT_COUNT - 3);
+    ASSERT_EQ(cause->tags.size(), 3);
+    EXPECT_EQ(cause->tags[0].tag, LIST_TAG);
+    EXPECT_EQ(cause->tags[1].tag, TEXT_TAG);
+    EXPECT_EQ(cause->tags[1].count, TEXT_COUNT);
+    EXPECT_EQ(cause->phaseDurations[static_cast<size_t>(FramePhase::LAYOUT)], 30 * MILLI);
+    EXPECT_EQ(cause->phaseDurations[static_cast<size_t>(FramePhase::ANIMATION)], MILLI);
+    auto causeString = cause->ToString();
+    EXPECT_EQ(causeString.find("Layout 30.00ms"), 0);
+    EXPECT_NE(causeString.find("List(1) Layout 30.00ms, ItemView(2) Build 5.00ms"), std::string::npos);
+    EXPECT_NE(causeString.find("Text 10.00ms x10"), std::string::npos);
+
+    /**
+     * @tc.steps: step3. end the next frame without any cost.
+     * @tc.expected: step3. costs of the janky frame are not carried over, its tags count for the page.
+     */
+    cause = attribution.EndFrame(PAGE_URL, VSYNC_TIME, FRAME_DURATION, JANK, JANK_RANGE);
+    ASSERT_NE(cause, nullptr);
+    EXPECT_TRUE(cause->nodes.empty());
+    EXPECT_EQ(cause->phaseDurations[static_cast<size_t>(FramePhase::LAYOUT)], 0);
+    const auto& page = attribution.GetPages().front();
+    EXPECT_EQ(page.frameCount, 3);
+    EXPECT_EQ(page.frames[JANK_RANGE + 2], 1);
+    EXPECT_EQ(page.tags.size(), 3);
+    EXPECT_EQ(attribution.GetJankFrames().size(), 2);
+}
+
+/**
+ * @tc.name: JankAttributionTest002
+ * @tc.desc: Roll the histograms of pages and export the janky frames as binary
+ * @tc.type: FUNC
+ */
+HWTEST_F(JankAttributionTest, JankAttributionTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record more frames on a page than a histogram holds.
+     * @tc.expected: step1. counts are halved once the limit is reached.
+     */
+    JankAttribution attribution;
+    for (uint32_t i = 0; i <= JankAttribution::MAX_HISTOGRAM_FRAMES; ++i) {
+        attribution.EndFrame(PAGE_URL, VSYNC_TIME, MILLI, NO_JANK, JANK_RANGE);
+    }
+    EXPECT_EQ(attribution.GetPages().front().frameCount, JankAttribution::MAX_HISTOGRAM_FRAMES / 2 + 1);
+    EXPECT_EQ(attribution.GetPages().front().frames[JANK_RANGE], JankAttribution::MAX_HISTOGRAM_FRAMES / 2 + 1);
+
+    /**
+     * @tc.steps: step2. record frames on more pages than kept, then on the first page again.
+     * @tc.expected: step2. the page shown the longest ago is dropped, the latest page comes first.
+     */
+    for (size_t i = 0; i < JankAttribution::MAX_PAGE_COUNT; ++i) {
+        attribution.EndFrame(OTHER_PAGE_URL + std::to_string(i), VSYNC_TIME, MILLI, NO_JANK, JANK_RANGE);
+    }
+    EXPECT_EQ(attribution.GetPages().size(), JankAttribution::MAX_PAGE_COUNT);
+    EXPECT_NE(attribution.GetPages().back().pageUrl, PAGE_URL);
+    attribution.AddNodeCost(FramePhase::LAYOUT, FrameProfiler::GetInstance().InternTag(LIST_TAG), 1, FRAME_DURATION);
+    attribution.EndFrame(PAGE_URL, VSYNC_TIME, FRAME_DURATION, JANK, JANK_RANGE);
+    EXPECT_EQ(attribution.GetPages().front().pageUrl, PAGE_URL);
+    EXPECT_EQ(attribution.GetPages().front().frameCount, 1);
+
+    /**
+     * @tc.steps: step3. dump the pages and the janky frame as binary.
+     * @tc.expected: step3. the dump starts with the magic and holds each string once.
+     */
+    std::ostringstream binary;
+    attribution.DumpBinary(binary);
+    auto content = binary.str();
+    EXPECT_EQ(content.substr(0, 8), std::string("ACEJANK\0", 8));
+    auto listPosition = content.find(LIST_TAG);
+    EXPECT_NE(listPosition, std::string::npos);
+    EXPECT_EQ(content.find(LIST_TAG, listPosition + 1), std::string::npos);
+
+    /**
+     * @tc.steps: step4. clear the attribution.
+     * @tc.expected: step4. no page and no frame is left.
+     */
+    attribution.Clear();
+    EXPECT_TRUE(attribution.GetPages().empty());
+    EXPECT_TRUE(attribution.GetJankFrames().empty());
+}
+
+/**
+ * @tc.name: JankAttributionTest003
+ * @tc.desc: Take the costs of a frame from the profile scopes of the thread
+ * @tc.type: FUNC
+ */
+HWTEST_F(JankAttributionTest, JankAttributionTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set the attribution as the cost sink of the thread, then time a frame, a node and a phase.
+     * @tc.expected: step1. the node and the phase are attributed to the frame, the frame itself is not.
+     */
+    JankAttribution attribution;
+    FrameProfiler::SetCostSink(&attribution);
+    {
+        FrameProfileScope frameScope(FramePhase::FRAME, 1);
+        FrameProfileScope nodeScope(FramePhase::LAYOUT, 1, LIST_TAG);
+        FrameProfileScope phaseScope(FramePhase::ANIMATION);
+    }
+    FrameProfiler::SetCostSink(nullptr);
+    auto cause = attribution.EndFrame(PAGE_URL, VSYNC_TIME, FRAME_DURATION, JANK, JANK_RANGE);
+    ASSERT_NE(cause, nullptr);
+    ASSERT_EQ(cause->nodes.size(), 1);
+    EXPECT_EQ(cause->nodes[0].tag, LIST_TAG);
+    EXPECT_EQ(cause->nodes[0].phase, FramePhase::LAYOUT);
+    ASSERT_EQ(cause->tags.size(), 1);
+    EXPECT_EQ(cause->tags[0].tag, LIST_TAG);
+    EXPECT_EQ(cause->phaseDurations[static_cast<size_t>(FramePhase::FRAME)], 0);
+
+    /**
+     * @tc.steps: step2. time a node without a sink, given a duration to increase.
+     * @tc.expected: step2. the node is only timed for the duration.
+     */
+    int64_t duration = 0;
+    {
+        FrameProfileScope nodeScope(FramePhase::RENDER, 2, TEXT_TAG, &duration);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_GE(duration, MILLI);
+    cause = attribution.EndFrame(PAGE_URL, VSYNC_TIME, FRAME_DURATION, JANK, JANK_RANGE);
+    ASSERT_NE(cause, nullptr);
+    EXPECT_TRUE(cause->nodes.empty());
+}
+} // namespace OHOS::Ace
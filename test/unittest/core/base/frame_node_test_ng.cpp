@@ -1649,4 +1649,205 @@ HWTEST_F(FrameNodeTestNg, FrameNodeTouchTest043, TestSize.Level1)
     auto test = FRAME_NODE2->TouchTest(globalPoint, parentLocalPoint, parentLocalPoint, touchRestrict, result, 1);
     EXPECT_EQ(test, HitTestResult::STOP_BUBBLING);
 }
+
+/**
+ * @tc.name: FrameNodeLayoutResultCache001
+ * @tc.desc: Test layout result cache replays a container layout for a previously seen constraint
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeLayoutResultCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create stack with one fixed size child, only plain stack is cacheable.
+     */
+    auto stack = FrameNode::CreateFrameNode("stack", 201, AceType::MakeRefPtr<StackPattern>());
+    auto child = FrameNode::CreateFrameNode("child", 202, AceType::MakeRefPtr<Pattern>());
+    stack->AddChild(child);
+    stack->SetActive(true);
+    child->SetActive(true);
+    child->GetLayoutProperty()->UpdateUserDefinedIdealSize(CalcSize(CalcLength(100.0f), CalcLength(50.0f)));
+    EXPECT_TRUE(stack->GetPattern()->IsLayoutResultCacheable());
+    EXPECT_FALSE(child->GetPattern()->IsLayoutResultCacheable());
+
+    LayoutConstraintF constraintA;
+    constraintA.minSize = SizeF(200.0f, 200.0f);
+    constraintA.maxSize = CONTAINER_SIZE;
+    constraintA.percentReference = CONTAINER_SIZE;
+    LayoutConstraintF constraintB = constraintA;
+    constraintB.minSize = SizeF(300.0f, 300.0f);
+
+    /**
+     * @tc.steps: step2. layout with constraint A, then B, then A again.
+     * @tc.expected: no cache is created until the constraint changes, then both results are recorded as misses.
+     */
+    stack->Measure(constraintA);
+    stack->Layout();
+    stack->GetLayoutProperty()->CleanDirty();
+    EXPECT_EQ(stack->GetLayoutResultCache(), nullptr);
+
+    stack->Measure(constraintB);
+    stack->Layout();
+    stack->GetLayoutProperty()->CleanDirty();
+    auto sizeB = stack->GetGeometryNode()->GetFrameSize();
+    auto childOffsetB = child->GetGeometryNode()->GetFrameOffset();
+    const auto& cache = stack->GetLayoutResultCache();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->GetEntryCount(), 1);
+    EXPECT_EQ(cache->GetHitCount(), 0);
+    auto missCount = cache->GetMissCount();
+
+    stack->Measure(constraintA);
+    stack->Layout();
+    stack->GetLayoutProperty()->CleanDirty();
+    EXPECT_EQ(cache->GetEntryCount(), 2);
+    EXPECT_EQ(cache->GetMissCount(), missCount + 1);
+
+    /**
+     * @tc.steps: step3. flip back to constraint B.
+     * @tc.expected: the result is replayed and matches the layout with B.
+     */
+    stack->Measure(constraintB);
+    stack->Layout();
+    stack->GetLayoutProperty()->CleanDirty();
+    EXPECT_EQ(cache->GetHitCount(), 1);
+    EXPECT_EQ(stack->GetGeometryNode()->GetFrameSize(), sizeB);
+    EXPECT_EQ(child->GetGeometryNode()->GetFrameOffset(), childOffsetB);
+
+    /**
+     * @tc.steps: step4. mark the stack dirty and layout with constraint A.
+     * @tc.expected: old entries are dropped, only the new result is kept.
+     */
+    stack->GetLayoutProperty()->UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    stack->Measure(constraintA);
+    stack->Layout();
+    EXPECT_EQ(cache->GetEntryCount(), 1);
+    EXPECT_EQ(cache->GetHitCount(), 1);
+}
+
+/**
+ * @tc.name: FrameNodeHitTestBounds001
+ * @tc.desc: Test hit test bounds prune subtrees whose response regions miss the point
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeHitTestBounds001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create parent with two children side by side, parent itself has no area.
+     */
+    auto parent = FrameNode::CreateFrameNode("parent", 211, AceType::MakeRefPtr<Pattern>());
+    auto left = FrameNode::CreateFrameNode("left", 212, AceType::MakeRefPtr<Pattern>());
+    auto right = FrameNode::CreateFrameNode("right", 213, AceType::MakeRefPtr<Pattern>());
+    auto parentContext = AceType::MakeRefPtr<MockRenderContext>();
+    auto leftContext = AceType::MakeRefPtr<MockRenderContext>();
+    auto rightContext = AceType::MakeRefPtr<MockRenderContext>();
+    parent->renderContext_ = parentContext;
+    left->renderContext_ = leftContext;
+    right->renderContext_ = rightContext;
+    leftContext->paintRect_ = RectF(0.0f, 0.0f, 100.0f, 100.0f);
+    rightContext->paintRect_ = RectF(200.0f, 0.0f, 100.0f, 100.0f);
+    parent->AddChild(left);
+    parent->AddChild(right);
+    parent->frameChildren_.emplace(left);
+    parent->frameChildren_.emplace(right);
+
+    /**
+     * @tc.steps: step2. test points inside a child and inside the gap.
+     * @tc.expected: only the gap and the other child are pruned.
+     */
+    EXPECT_FALSE(parent->IsOutOfHitTestBounds(PointF(250.0f, 50.0f)));
+    EXPECT_TRUE(parent->IsOutOfHitTestBounds(PointF(250.0f, 150.0f)));
+    EXPECT_TRUE(left->IsOutOfHitTestBounds(PointF(250.0f, 50.0f)));
+    EXPECT_FALSE(right->IsOutOfHitTestBounds(PointF(250.0f, 50.0f)));
+    EXPECT_TRUE(parent->IsOutOfTouchTestRegion(PointF(150.0f, 150.0f), static_cast<int32_t>(SourceType::TOUCH)));
+
+    /**
+     * @tc.steps: step3. move the right child without marking it, then mark the left child changed.
+     * @tc.expected: the parent is rebuilt from the bounds still cached on the right child.
+     */
+    rightContext->paintRect_ = RectF(200.0f, 200.0f, 100.0f, 100.0f);
+    EXPECT_TRUE(parent->IsOutOfHitTestBounds(PointF(250.0f, 250.0f)));
+    left->MarkGeometryChanged();
+    EXPECT_TRUE(parent->IsOutOfHitTestBounds(PointF(250.0f, 250.0f)));
+
+    /**
+     * @tc.steps: step4. mark the right child changed.
+     * @tc.expected: its new bounds reach the parent.
+     */
+    right->MarkGeometryChanged();
+    EXPECT_FALSE(parent->IsOutOfHitTestBounds(PointF(250.0f, 250.0f)));
+
+    /**
+     * @tc.steps: step5. clip the parent.
+     * @tc.expected: children no longer extend the parent bounds.
+     */
+    parentContext->UpdateClipEdge(true);
+    parent->MarkHitTestBoundsDirty();
+    EXPECT_TRUE(parent->IsOutOfHitTestBounds(PointF(250.0f, 250.0f)));
+}
+
+/**
+ * @tc.name: FrameNodeElementRegister001
+ * @tc.desc: Test typed lookup and generation checked handles of ElementRegister
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeElementRegister001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a frame node and look it up by id and by handle.
+     * @tc.expected: both lookups return the node.
+     */
+    auto elementRegister = ElementRegister::GetInstance();
+    auto nodeId = elementRegister->MakeUniqueId();
+    auto frameNode = FrameNode::CreateFrameNode("main", nodeId, AceType::MakeRefPtr<Pattern>());
+    EXPECT_EQ(elementRegister->GetFrameNodeById(nodeId), frameNode);
+    EXPECT_EQ(elementRegister->GetUINodeById(nodeId), frameNode);
+    auto handle = elementRegister->GetHandle(nodeId);
+    EXPECT_EQ(handle.elmtId, nodeId);
+    EXPECT_EQ(elementRegister->GetUINodeByHandle(handle), frameNode);
+
+    /**
+     * @tc.steps: step2. remove the node and register it again with the same id.
+     * @tc.expected: the old handle no longer resolves, a new one does.
+     */
+    EXPECT_TRUE(elementRegister->RemoveItemSilently(nodeId));
+    EXPECT_FALSE(elementRegister->Exists(nodeId));
+    EXPECT_EQ(elementRegister->GetUINodeByHandle(handle), nullptr);
+    EXPECT_TRUE(elementRegister->AddUINode(frameNode));
+    EXPECT_EQ(elementRegister->GetUINodeByHandle(handle), nullptr);
+    auto newHandle = elementRegister->GetHandle(nodeId);
+    EXPECT_NE(newHandle.generation, handle.generation);
+    EXPECT_EQ(elementRegister->GetUINodeByHandle(newHandle), frameNode);
+
+    /**
+     * @tc.steps: step3. move the node to a recycled id.
+     * @tc.expected: the node is found by the new id only.
+     */
+    auto recycleId = elementRegister->MakeUniqueId();
+    elementRegister->UpdateRecycleElmtId(nodeId, recycleId);
+    EXPECT_EQ(elementRegister->GetFrameNodeById(nodeId), nullptr);
+    EXPECT_EQ(elementRegister->GetFrameNodeById(recycleId), frameNode);
+    elementRegister->RemoveItemSilently(recycleId);
+
+    /**
+     * @tc.steps: step4. register a node with an id far ahead of MakeUniqueId.
+     * @tc.expected: it is found without growing the page table, and removed again.
+     */
+    auto pageCount = elementRegister->slots_.pages_.size();
+    auto farId = elementRegister->MakeUniqueId() + 1000 * ElementSlotTable::PAGE_SIZE;
+    auto farNode = FrameNode::CreateFrameNode("far", farId, AceType::MakeRefPtr<Pattern>());
+    EXPECT_EQ(elementRegister->GetFrameNodeById(farId), farNode);
+    EXPECT_EQ(elementRegister->slots_.pages_.size(), pageCount);
+    EXPECT_TRUE(elementRegister->RemoveItemSilently(farId));
+    EXPECT_FALSE(elementRegister->Exists(farId));
+
+    /**
+     * @tc.steps: step5. register a frame node as a plain referenced item.
+     * @tc.expected: it is still found by the typed lookups.
+     */
+    auto referencedId = elementRegister->MakeUniqueId();
+    EXPECT_TRUE(elementRegister->AddReferenced(referencedId, AceType::WeakClaim(AceType::RawPtr(farNode))));
+    EXPECT_EQ(elementRegister->GetFrameNodeById(referencedId), farNode);
+    EXPECT_EQ(elementRegister->GetSpecificItemById<FrameNode>(referencedId), farNode);
+    elementRegister->RemoveItemSilently(referencedId);
+}
 } // namespace OHOS::Ace::NG
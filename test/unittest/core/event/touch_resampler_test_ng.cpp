@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+#include "core/event/touch_resampler.h"
+#include "core/gestures/velocity_tracker.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr int32_t POINTER_ID = 1;
+constexpr uint64_t MILLI = 1000 * 1000;
+// a 240 Hz panel reports a point every 4ms, the finger moves at 1000 px/s.
+constexpr uint64_t REPORT_PERIOD = 4 * MILLI;
+constexpr float SPEED = 1000.0f;
+constexpr float SCREEN_OFFSET = 100.0f;
+constexpr int32_t POINT_COUNT = 10;
+constexpr int32_t TRACK_COUNT = 40;
+constexpr float POSITION_ERROR = 0.01f;
+constexpr float KALMAN_POSITION_ERROR = 0.5f;
+
+TouchEvent CreateMovePoint(uint64_t time)
+{
+    TouchEvent point;
+    point.id = POINTER_ID;
+    point.type = TouchType::MOVE;
+    point.x = SPEED * static_cast<float>(time) / static_cast<float>(MILLI * 1000);
+    point.y = point.x / 2;
+    point.screenX = point.x + SCREEN_OFFSET;
+    point.screenY = point.y + SCREEN_OFFSET;
+    point.time = TimeStamp(std::chrono::nanoseconds(time));
+    return point;
+}
+
+// Adds the points reported in [begin, end) and ends the frame, the latest point is returned in |point|.
+bool ResampleFrame(TouchResampler& resampler, uint64_t begin, uint64_t end, uint64_t targetTime, TouchEvent& point)
+{
+    for (auto time = begin; time < end; time += REPORT_PERIOD) {
+        point = CreateMovePoint(time);
+        resampler.AddPoint(point);
+    }
+    return resampler.EndFrame(point, targetTime);
+}
+} // namespace
+
+class TouchResamplerTestNg : public testing::Test {};
+
+/**
+ * @tc.name: TouchResamplerTest001
+ * @tc.desc: Interpolate the points of a pointer between the average points of two frames
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchResamplerTestNg, TouchResamplerTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. end the first frame of a pointer.
+     * @tc.expected: step1. there is no frame to interpolate from, the point is kept.
+     */
+    TouchResampler resampler;
+    TouchEvent point;
+    EXPECT_FALSE(ResampleFrame(resampler, 0, 4 * REPORT_PERIOD, REPORT_PERIOD, point));
+    EXPECT_FALSE(point.isInterpolated);
+    EXPECT_EQ(point.time, TimeStamp(std::chrono::nanoseconds(3 * REPORT_PERIOD)));
+
+    /**
+     * @tc.steps: step2. end the second frame, one report repeated, resampled between both frames.
+     * @tc.expected: step2. the repeated report is skipped, the point is moved along the line of the finger.
+     */
+    resampler.AddPoint(CreateMovePoint(4 * REPORT_PERIOD));
+    auto targetTime = 5 * REPORT_PERIOD;
+    ASSERT_TRUE(ResampleFrame(resampler, 4 * REPORT_PERIOD, 8 * REPORT_PERIOD, targetTime, point));
+    auto expected = CreateMovePoint(targetTime);
+    EXPECT_TRUE(point.isInterpolated);
+    EXPECT_EQ(point.time, expected.time);
+    EXPECT_NEAR(point.x, expected.x, POSITION_ERROR);
+    EXPECT_NEAR(point.y, expected.y, POSITION_ERROR);
+    EXPECT_NEAR(point.screenX, expected.screenX, POSITION_ERROR);
+
+    /**
+     * @tc.steps: step3. reset the pointer, then end a frame long after the last one.
+     * @tc.expected: step3. neither frame is interpolated from.
+     */
+    resampler.ResetPointer(POINTER_ID);
+    EXPECT_FALSE(ResampleFrame(resampler, 8 * REPORT_PERIOD, 12 * REPORT_PERIOD, 9 * REPORT_PERIOD, point));
+    EXPECT_FALSE(ResampleFrame(resampler, 200 * MILLI, 200 * MILLI + REPORT_PERIOD, 150 * MILLI, point));
+}
+
+/**
+ * @tc.name: TouchResamplerTest002
+ * @tc.desc: Predict the points of a pointer to the vsync with least squares and with a kalman filter
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchResamplerTestNg, TouchResamplerTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. predict with an unknown predictor.
+     * @tc.expected: step1. it falls back to interpolation.
+     */
+    TouchResampler resampler(static_cast<TouchPredictor>(POINT_COUNT));
+    EXPECT_EQ(resampler.GetPredictor(), TouchPredictor::NONE);
+
+    /**
+     * @tc.steps: step2. predict a frame with least squares, 8ms past the latest point.
+     * @tc.expected: step2. the point lands where the finger is at the vsync, the screen point moves as much.
+     */
+    resampler.SetPredictor(TouchPredictor::LEAST_SQUARE);
+    auto end = POINT_COUNT * REPORT_PERIOD;
+    auto targetTime = end + REPORT_PERIOD;
+    TouchEvent point;
+    ASSERT_TRUE(ResampleFrame(resampler, 0, end, targetTime, point));
+    auto expected = CreateMovePoint(targetTime);
+    EXPECT_TRUE(point.isInterpolated);
+    EXPECT_EQ(point.time, expected.time);
+    EXPECT_NEAR(point.x, expected.x, POSITION_ERROR);
+    EXPECT_NEAR(point.y, expected.y, POSITION_ERROR);
+    EXPECT_NEAR(point.screenY, expected.screenY, POSITION_ERROR);
+
+    /**
+     * @tc.steps: step3. predict the next frame with a vsync far past the latest point.
+     * @tc.expected: step3. the prediction stops 16ms past the latest point, and is stamped with that time.
+     */
+    ASSERT_TRUE(ResampleFrame(resampler, end, end + REPORT_PERIOD, end + 40 * MILLI, point));
+    EXPECT_NEAR(point.x, CreateMovePoint(end + 16 * MILLI).x, POSITION_ERROR);
+    EXPECT_EQ(point.time, TimeStamp(std::chrono::nanoseconds(end + 16 * MILLI)));
+
+    /**
+     * @tc.steps: step4. predict a frame with the kalman filter.
+     * @tc.expected: step4. too few points are not predicted, then the filter follows the finger.
+     */
+    resampler.SetPredictor(TouchPredictor::KALMAN);
+    EXPECT_FALSE(ResampleFrame(resampler, 0, 2 * REPORT_PERIOD, 2 * REPORT_PERIOD, point));
+    ASSERT_TRUE(ResampleFrame(resampler, 2 * REPORT_PERIOD, end, targetTime, point));
+    EXPECT_NEAR(point.x, expected.x, KALMAN_POSITION_ERROR);
+    EXPECT_NEAR(point.y, expected.y, KALMAN_POSITION_ERROR);
+}
+
+/**
+ * @tc.name: TouchResamplerTest003
+ * @tc.desc: Track the velocity of a long move in the ring of VelocityTracker
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchResamplerTestNg, TouchResamplerTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. track two points.
+     * @tc.expected: step1. the velocity can not be fitted yet.
+     */
+    VelocityTracker tracker;
+    tracker.UpdateTouchPoint(CreateMovePoint(0));
+    tracker.UpdateTouchPoint(CreateMovePoint(REPORT_PERIOD));
+    EXPECT_EQ(tracker.GetVelocity().GetVelocityX(), 0.0);
+
+    /**
+     * @tc.steps: step2. track more points than the ring holds.
+     * @tc.expected: step2. the velocity of the finger is fitted from the latest points.
+     */
+    for (int32_t i = 2; i < TRACK_COUNT; ++i) {
+        tracker.UpdateTouchPoint(CreateMovePoint(i * REPORT_PERIOD));
+    }
+    EXPECT_NEAR(tracker.GetVelocity().GetVelocityX(), SPEED, 1.0);
+    EXPECT_NEAR(tracker.GetVelocity().GetVelocityY(), SPEED / 2, 1.0);
+
+    /**
+     * @tc.steps: step3. track a point predicted off the line of the finger, then the points reported before its time.
+     * @tc.expected: step3. the prediction is dropped, the velocity of the finger is fitted again.
+     */
+    auto predicted = CreateMovePoint((TRACK_COUNT + 3) * REPORT_PERIOD);
+    predicted.x += SPEED;
+    tracker.UpdateTouchPoint(predicted);
+    for (int32_t i = TRACK_COUNT; i < TRACK_COUNT + 2; ++i) {
+        tracker.UpdateTouchPoint(CreateMovePoint(i * REPORT_PERIOD));
+    }
+    EXPECT_NEAR(tracker.GetVelocity().GetVelocityX(), SPEED, 1.0);
+
+    /**
+     * @tc.steps: step4. reset the tracker.
+     * @tc.expected: step4. no velocity is left.
+     */
+    tracker.Reset();
+    EXPECT_EQ(tracker.GetVelocity().GetVelocityX(), 0.0);
+}
+} // namespace OHOS::Ace
@@ -595,4 +595,46 @@ HWTEST_F(ImageProviderTestNg, TargetSize001, TestSize.Level1)
     ctx->OnMakeCanvasImage();
     EXPECT_EQ(ctx->dstRect_.GetSize(), SizeF(50, 50));
 }
+
+/**
+ * @tc.name: TaskPriority001
+ * @tc.desc: Test the order of queued background tasks
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTestNg, TaskPriority001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. queue decode tasks a and c of visible images and b of an invisible image, in that order
+     */
+    std::vector<std::string> order;
+    std::vector<std::string> keys = { "a", "b", "c" };
+    {
+        std::scoped_lock<std::mutex> lock(ImageProvider::taskMtx_);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            auto key = keys[i];
+            ImageProvider::QueueKey queueKey { key != "b", i + 1 };
+            ImageProvider::queues_[ImageProvider::DECODE].emplace(queueKey,
+                ImageProvider::QueuedTask { CancelableCallback<void()>([&order, key] { order.emplace_back(key); }) });
+            auto& task = ImageProvider::tasks_[key];
+            task.stage_ = ImageProvider::DECODE;
+            task.queueKey_ = queueKey;
+        }
+    }
+
+    /**
+     * @tc.steps: step2. b becomes visible, then run all queued tasks
+     * @tc.expected: the most recent visible task runs first
+     */
+    ImageProvider::UpdateTaskPriority("b", true);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ImageProvider::RunNextTask(ImageProvider::DECODE);
+    }
+    EXPECT_EQ(order, std::vector<std::string>({ "c", "b", "a" }));
+
+    std::scoped_lock<std::mutex> lock(ImageProvider::taskMtx_);
+    EXPECT_TRUE(ImageProvider::queues_[ImageProvider::DECODE].empty());
+    for (const auto& key : keys) {
+        ImageProvider::tasks_.erase(key);
+    }
+}
 } // namespace OHOS::Ace::NG
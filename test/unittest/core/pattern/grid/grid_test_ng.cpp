@@ -4824,6 +4824,54 @@ HWTEST_F(GridTestNg, GetAverageHeight001, TestSize.Level1)
     EXPECT_EQ(pattern_->GetAverageHeight(), 50);
 }
 
+/**
+ * @tc.name: GridLineHeightIndex001
+ * @tc.desc: Test the line height index of GridLayoutInfo.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GridTestNg, GridLineHeightIndex001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Lines 0 and 1 are measured, line 2 has a height but is not in gridMatrix_.
+     * @tc.expected: Heights are summed with the gap, only measured lines are counted.
+     */
+    GridLayoutInfo info;
+    info.lineHeightMap_ = { { 0, 100.0f }, { 1, 200.0f }, { 2, 50.0f } };
+    info.gridMatrix_[0] = { { 0, 0 }, { 1, 1 } };
+    info.gridMatrix_[1] = { { 0, 2 } };
+    const auto& index = info.GetLineHeightIndex();
+    EXPECT_TRUE(index.IsValid());
+    EXPECT_EQ(index.GetHeightBefore(0, 10.0f), 0.0f);
+    EXPECT_EQ(index.GetHeightBefore(1, 10.0f), 110.0f);
+    EXPECT_EQ(index.GetHeightBefore(2, 10.0f), 320.0f);
+    EXPECT_EQ(index.GetHeightBefore(5, 10.0f), 380.0f);
+    EXPECT_EQ(index.GetTotalHeight(10.0f), 370.0f);
+    EXPECT_EQ(index.GetMeasuredItemCount(), 3);
+    EXPECT_EQ(index.GetMeasuredHeight(10.0f), 320.0f);
+    EXPECT_EQ(index.GetFirstMeasuredLineHeight(), 100.0f);
+    info.startMainLineIndex_ = 1;
+    info.currentOffset_ = -20.0f;
+    EXPECT_EQ(info.GetStartLineOffset(10.0f), 130.0f);
+    EXPECT_EQ(info.GetTotalLineHeight(10.0f), 370.0f);
+
+    /**
+     * @tc.steps: step2. Copy the info and change a line in the copy.
+     * @tc.expected: The copy builds its own index, the index of the source is kept.
+     */
+    GridLayoutInfo copy = info;
+    copy.lineHeightMap_[1] = 100.0f;
+    EXPECT_EQ(copy.GetTotalLineHeight(10.0f), 270.0f);
+    EXPECT_EQ(info.GetTotalLineHeight(10.0f), 370.0f);
+
+    /**
+     * @tc.steps: step3. Change a line of the source and reset the index.
+     * @tc.expected: The index is built again from the maps.
+     */
+    info.lineHeightMap_.erase(2);
+    info.ResetLineHeightIndex();
+    EXPECT_EQ(info.GetTotalLineHeight(10.0f), 310.0f);
+}
+
 /**
  * @tc.name: GridItemHoverEventTest001
  * @tc.desc: GirdItem hover event test.
@@ -1105,7 +1105,8 @@ HWTEST_F(ImageAnimatorTestNg, ImageAnimatorTest017, TestSize.Level1)
     CHECK_NULL_VOID(imageNode);
     frameNode->AddChild(imageNode);
     frameNode->tag_ = V2::IMAGE_ANIMATOR_ETS_TAG;
-    ElementRegister::GetInstance()->itemMap_[nodeId] = frameNode;
+    ElementRegister::GetInstance()->RemoveItemSilently(nodeId);
+    ElementRegister::GetInstance()->AddUINode(frameNode);
     imageAnimatorModelNG.Create();
     EXPECT_FALSE(frameNode->GetChildren().empty());
 }
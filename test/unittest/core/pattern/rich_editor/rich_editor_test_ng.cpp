@@ -1302,7 +1302,7 @@ HWTEST_F(RichEditorTestNg, InitSelection001, TestSize.Level1)
     auto richEditorPattern = richEditorNode_->GetPattern<RichEditorPattern>();
     ASSERT_NE(richEditorPattern, nullptr);
     auto paragraph = MockParagraph::GetOrCreateMockParagraph();
-    richEditorPattern->paragraphs_.paragraphs_.push_front({ paragraph });
+    richEditorPattern->paragraphs_.AddParagraph({ .paragraph = paragraph });
     richEditorPattern->textForDisplay_ = "test";
     richEditorPattern->InitSelection(Offset(0, 0));
     EXPECT_EQ(richEditorPattern->textSelector_.baseOffset, 0);
@@ -1320,7 +1320,7 @@ HWTEST_F(RichEditorTestNg, InitSelection002, TestSize.Level1)
     auto richEditorPattern = richEditorNode_->GetPattern<RichEditorPattern>();
     ASSERT_NE(richEditorPattern, nullptr);
     auto paragraph = MockParagraph::GetOrCreateMockParagraph();
-    richEditorPattern->paragraphs_.paragraphs_.push_front({ paragraph });
+    richEditorPattern->paragraphs_.AddParagraph({ .paragraph = paragraph });
     richEditorPattern->textForDisplay_ = "test";
     richEditorPattern->spans_.push_front(AceType::MakeRefPtr<SpanItem>());
     richEditorPattern->spans_.front()->position = 3;
@@ -1411,7 +1411,7 @@ HWTEST_F(RichEditorTestNg, MouseRightFocus001, TestSize.Level1)
     richEditorPattern->caretPosition_ = richEditorPattern->GetTextContentLength();
     richEditorPattern->moveLength_ = 0;
     auto paragraph = MockParagraph::GetOrCreateMockParagraph();
-    richEditorPattern->paragraphs_.paragraphs_.push_front({ paragraph });
+    richEditorPattern->paragraphs_.AddParagraph({ .paragraph = paragraph });
     MouseInfo info;
     richEditorPattern->textSelector_.baseOffset = 0;
     richEditorPattern->textSelector_.destinationOffset = 0;
@@ -1619,7 +1619,7 @@ HWTEST_F(RichEditorTestNg, HandleMouseLeftButton001, TestSize.Level1)
 
     auto paragraph = AceType::MakeRefPtr<MockParagraph>();
     EXPECT_CALL(*paragraph, GetHeight).WillRepeatedly(Return(0));
-    richEditorPattern->paragraphs_.paragraphs_.push_front({ paragraph });
+    richEditorPattern->paragraphs_.AddParagraph({ .paragraph = paragraph });
     richEditorPattern->mouseStatus_ = MouseStatus::NONE;
     richEditorPattern->blockPress_ = false;
     richEditorPattern->leftMousePress_ = true;
@@ -2694,4 +2694,84 @@ HWTEST_F(RichEditorTestNg, NeedSoftKeyboard001, TestSize.Level1)
      */
     EXPECT_TRUE(richEditorPattern->NeedSoftKeyboard());
 }
+
+/**
+ * @tc.name: ParagraphManager001
+ * @tc.desc: test hit test and cursor offset over several paragraphs
+ * @tc.type: FUNC
+ */
+HWTEST_F(RichEditorTestNg, ParagraphManager001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. add three paragraphs of height 10, covering [0, 5), [5, 10) and [10, 15).
+     */
+    constexpr float paragraphHeight = 10.0f;
+    constexpr int32_t paragraphLength = 5;
+    ParagraphManager manager;
+    std::vector<RefPtr<MockParagraph>> paragraphs;
+    for (int32_t i = 0; i < 3; ++i) {
+        auto paragraph = AceType::MakeRefPtr<MockParagraph>();
+        EXPECT_CALL(*paragraph, GetHeight).WillRepeatedly(Return(paragraphHeight));
+        manager.AddParagraph(
+            { .paragraph = paragraph, .start = i * paragraphLength, .end = (i + 1) * paragraphLength });
+        paragraphs.emplace_back(paragraph);
+    }
+    EXPECT_EQ(manager.GetHeight(), paragraphHeight * 3);
+
+    /**
+     * @tc.steps: step2. hit test the second paragraph and below the last one.
+     * @tc.expected: the offset is made relative to the second paragraph.
+     */
+    EXPECT_CALL(*paragraphs[1], GetGlyphIndexByCoordinate(Offset(1.0, 5.0))).WillOnce(Return(2));
+    EXPECT_EQ(manager.GetIndex(Offset(1.0, 15.0)), 7);
+    EXPECT_EQ(manager.GetIndex(Offset(1.0, 100.0)), 15);
+
+    /**
+     * @tc.steps: step3. compute the caret of the third paragraph and at the end of the text.
+     */
+    CaretMetricsF metrics(OffsetF(3.0f, 1.0f), paragraphHeight);
+    EXPECT_CALL(*paragraphs[2], ComputeOffsetForCaretUpstream(_, _))
+        .WillRepeatedly(DoAll(SetArgReferee<1>(metrics), Return(true)));
+    float lineHeight = 0.0f;
+    auto offset = manager.ComputeCursorOffset(11, lineHeight);
+    EXPECT_EQ(offset, OffsetF(3.0f, 21.0f));
+    EXPECT_EQ(lineHeight, paragraphHeight);
+    offset = manager.ComputeCursorOffset(15, lineHeight);
+    EXPECT_EQ(offset, OffsetF(3.0f, 21.0f));
+}
+
+/**
+ * @tc.name: ParagraphManager002
+ * @tc.desc: test paragraphs are reused by the next layout only with an equal key
+ * @tc.type: FUNC
+ */
+HWTEST_F(RichEditorTestNg, ParagraphManager002, TestSize.Level1)
+{
+    ParagraphManager manager;
+    auto paragraph = AceType::MakeRefPtr<MockParagraph>();
+    ParagraphManager::LayoutKey key;
+    key.spans.push_back({ .content = INIT_VALUE_1 });
+    key.maxWidth = 100.0f;
+    manager.RecordParagraph(ParagraphManager::LayoutKey(key), paragraph);
+
+    /**
+     * @tc.steps: step1. start the next layout.
+     * @tc.expected: the paragraph is reusable with the same key only.
+     */
+    manager.Reset();
+    EXPECT_EQ(manager.GetReusableParagraph(key), paragraph);
+    auto otherKey = key;
+    otherKey.spans.front().content = INIT_VALUE_2;
+    EXPECT_EQ(manager.GetReusableParagraph(otherKey), nullptr);
+    otherKey = key;
+    otherKey.maxWidth = 50.0f;
+    EXPECT_EQ(manager.GetReusableParagraph(otherKey), nullptr);
+
+    /**
+     * @tc.steps: step2. finish the layout without recording the paragraph again.
+     * @tc.expected: the paragraph is released.
+     */
+    manager.FinishLayout();
+    EXPECT_EQ(manager.GetReusableParagraph(key), nullptr);
+}
 } // namespace OHOS::Ace::NG
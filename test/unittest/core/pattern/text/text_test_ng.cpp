@@ -40,6 +40,7 @@
 #include "core/components_ng/pattern/pattern.h"
 #include "core/components_ng/pattern/picker/picker_type_define.h"
 #include "core/components_ng/pattern/root/root_pattern.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/span_model_ng.h"
 #include "core/components_ng/pattern/text/text_accessibility_property.h"
 #include "core/components_ng/pattern/text/text_content_modifier.h"
@@ -4858,4 +4859,55 @@ HWTEST_F(TextTestNg, TextFrameNodeCreator004, TestSize.Level1)
     eventHub->SetOnCopy(std::move(Event));
     EXPECT_TRUE(eventHub->onCopy_);
 }
+
+/**
+ * @tc.name: ParagraphCache001
+ * @tc.desc: Test paragraphs are shared only for identical content, style and width.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextTestNg, ParagraphCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put a paragraph and get it with an equal key.
+     */
+    auto& cache = ParagraphCache::GetInstance();
+    cache.Clear();
+    RefPtr<Paragraph> paragraph = MockParagraph::GetOrCreateMockParagraph();
+    ParagraphCacheKey key;
+    key.content = CREATE_VALUE;
+    key.textStyle.SetFontSize(ADAPT_MIN_FONT_SIZE_VALUE);
+    key.maxWidth = TEXT_WIDTH;
+    cache.Put(key, paragraph);
+    ParagraphCacheKey sameKey = key;
+    EXPECT_EQ(cache.Get(sameKey), paragraph);
+
+    /**
+     * @tc.steps: step2. change the width, the style and the content.
+     * @tc.expected: each of them misses.
+     */
+    auto otherKey = key;
+    otherKey.maxWidth = TEXT_WIDTH / 2;
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    otherKey = key;
+    otherKey.textStyle.SetWhiteSpace(WhiteSpace::NORMAL);
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    otherKey = key;
+    otherKey.content = TEXT_CONTENT;
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+
+    /**
+     * @tc.steps: step3. content longer than MAX_CONTENT_LENGTH is not cached.
+     */
+    otherKey = key;
+    otherKey.content = std::string(ParagraphCache::MAX_CONTENT_LENGTH + 1, 'a');
+    cache.Put(otherKey, paragraph);
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+
+    /**
+     * @tc.steps: step4. critical memory level empties the cache.
+     */
+    cache.NotifyMemoryLevel(2);
+    EXPECT_EQ(cache.Get(key), nullptr);
+    EXPECT_EQ(cache.GetMetrics().count, 0u);
+}
 } // namespace OHOS::Ace::NG
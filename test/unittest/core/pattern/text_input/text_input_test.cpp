@@ -1499,6 +1499,50 @@ HWTEST_F(TextFieldControllerTest, ContentController003, TestSize.Level1)
     EXPECT_EQ(afterSelectedValue.compare("defghijklmnopqrstuvwxyz"), 0) << "Text is " + afterSelectedValue;
 }
 
+/**
+ * @tc.name: ContentController004
+ * @tc.desc: Test ContentController editing long text and restoring snapshots
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextFieldControllerTest, ContentController004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Initialize text filed node with text spanning several rope leaves
+     */
+    CreateTextField();
+    auto controller = pattern_->contentController_;
+    std::wstring expected;
+    for (int32_t i = 0; i < 3000; ++i) {
+        expected += static_cast<wchar_t>(L'a' + i % 26);
+    }
+    controller->SetTextValueOnly(StringUtils::ToString(expected));
+    auto snapshot = controller->GetSnapshot();
+
+    /**
+     * @tc.steps: step2. Insert, replace and erase across leaf boundaries
+     * @tc.expected: The content matches the same edits made on a flat string
+     */
+    controller->InsertValue(1000, "你好");
+    expected.insert(1000, L"你好");
+    controller->ReplaceSelectedValue(500, 1600, "xyz");
+    expected.replace(500, 1100, L"xyz");
+    controller->erase(10, 20);
+    expected.erase(10, 20);
+    EXPECT_EQ(controller->GetWideTextLength(), expected.length());
+    EXPECT_EQ(controller->GetWideText(), expected);
+    EXPECT_EQ(controller->GetTextValue(), StringUtils::ToString(expected));
+    EXPECT_EQ(controller->GetSelectedValue(495, 505), StringUtils::ToString(expected.substr(495, 10)));
+
+    /**
+     * @tc.steps: step3. Restore the snapshot taken before the edits
+     * @tc.expected: The snapshot was not changed by the edits
+     */
+    controller->RestoreSnapshot(snapshot);
+    EXPECT_EQ(controller->GetWideTextLength(), 3000u);
+    EXPECT_EQ(controller->GetValueBeforeIndex(3), "abc");
+    EXPECT_TRUE(controller->GetSnapshot().IsSameStorage(snapshot));
+}
+
 /**
  * @tc.name: TextFiledControllerTest001
  * @tc.desc: Test TextFieldController GetTextContentLinesNum
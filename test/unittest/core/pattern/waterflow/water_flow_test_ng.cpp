@@ -1436,4 +1436,109 @@ HWTEST_F(WaterFlowTestNg, WaterFlowGetItemRectTest001, TestSize.Level1)
     EXPECT_TRUE(IsEqual(pattern_->GetItemRect(10),
         Rect(DEVICE_WIDTH / 2, ITEM_HEIGHT * 2, itemWidth, ITEM_HEIGHT)));
 }
+
+/**
+ * @tc.name: WaterFlowScrollToIndex001
+ * @tc.desc: Test scroll to an index far out of the laid out items.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WaterFlowTestNg, WaterFlowScrollToIndex001, TestSize.Level1)
+{
+    Create([](WaterFlowModelNG model) {
+        model.SetColumnsTemplate("1fr 1fr");
+        CreateItem(100);
+    });
+    EXPECT_LT(pattern_->layoutInfo_.endIndex_, 80);
+
+    /**
+     * @tc.steps: step1. Scroll to index 80.
+     * @tc.expected: Item 80 is at the top and the items skipped are estimated without being measured or placed.
+     */
+    pattern_->ScrollToIndex(80);
+    RunMeasureAndLayout(frameNode_, DEVICE_WIDTH, DEVICE_HEIGHT);
+    EXPECT_EQ(pattern_->layoutInfo_.jumpIndex_, -1);
+    EXPECT_EQ(pattern_->layoutInfo_.startIndex_, 80);
+    EXPECT_EQ(pattern_->layoutInfo_.currentOffset_, -ITEM_HEIGHT * 40);
+    EXPECT_TRUE(frameNode_->GetOrCreateChildByIndex(80, false)->IsActive());
+    EXPECT_TRUE(pattern_->layoutInfo_.IsEstimatedItem(40));
+    EXPECT_EQ(pattern_->layoutInfo_.GetCrossIndex(40), -1);
+    auto skippedItem = frameNode_->GetOrCreateChildByIndex(40, false);
+    EXPECT_FALSE(skippedItem->IsActive());
+    EXPECT_EQ(AceType::DynamicCast<FrameNode>(skippedItem)->GetGeometryNode()->GetFrameSize().Height(), 0.0f);
+
+    /**
+     * @tc.steps: step2. Scroll back a little.
+     * @tc.expected: The items shown above are laid out.
+     */
+    UpdateCurrentOffset(ITEM_HEIGHT);
+    EXPECT_EQ(pattern_->layoutInfo_.currentOffset_, -ITEM_HEIGHT * 39);
+    EXPECT_EQ(pattern_->layoutInfo_.startIndex_, 78);
+    EXPECT_FALSE(pattern_->layoutInfo_.IsEstimatedItem(78));
+    EXPECT_TRUE(frameNode_->GetOrCreateChildByIndex(78, false)->IsActive());
+}
+
+/**
+ * @tc.name: WaterFlowScrollToIndex002
+ * @tc.desc: Test scroll back after scrolling to an index, with items higher and lower than estimated.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WaterFlowTestNg, WaterFlowScrollToIndex002, TestSize.Level1)
+{
+    Create([](WaterFlowModelNG model) {
+        model.SetColumnsTemplate("1fr 1fr");
+        for (int32_t i = 0; i < 100; i++) {
+            WaterFlowItemModelNG waterFlowItemModel;
+            waterFlowItemModel.Create();
+            SetWidth(FILL_LENGTH);
+            SetHeight(Dimension(i < 20 ? ITEM_HEIGHT : ITEM_HEIGHT * (1 + i % 3) / 2));
+            ViewStackProcessor::GetInstance()->Pop();
+        }
+    });
+    auto getShownItems = [this]() {
+        std::map<int32_t, float> shownItems;
+        const auto& layoutInfo = pattern_->layoutInfo_;
+        for (const auto& crossItems : layoutInfo.waterFlowItems_) {
+            for (const auto& [index, item] : crossItems.second) {
+                if (index >= layoutInfo.startIndex_ && index <= layoutInfo.endIndex_) {
+                    shownItems[index] = item.first + layoutInfo.currentOffset_;
+                }
+            }
+        }
+        return shownItems;
+    };
+
+    /**
+     * @tc.steps: step1. Scroll to index 80.
+     * @tc.expected: Item 80 is at the top, the items skipped are estimated.
+     */
+    pattern_->ScrollToIndex(80);
+    RunMeasureAndLayout(frameNode_, DEVICE_WIDTH, DEVICE_HEIGHT);
+    EXPECT_TRUE(pattern_->layoutInfo_.HasEstimatedItems());
+    EXPECT_TRUE(pattern_->layoutInfo_.IsEstimatedItem(40));
+
+    /**
+     * @tc.steps: step2. Scroll back item by item.
+     * @tc.expected: The items shown only move by the offset, the items shown above are measured and follow each
+     *               other in their cross.
+     */
+    for (int32_t step = 0; step < 20; step++) {
+        auto shownItems = getShownItems();
+        UpdateCurrentOffset(ITEM_HEIGHT);
+        for (const auto& [index, position] : getShownItems()) {
+            EXPECT_FALSE(pattern_->layoutInfo_.IsEstimatedItem(index));
+            auto shownItem = shownItems.find(index);
+            if (shownItem != shownItems.end()) {
+                EXPECT_FLOAT_EQ(position, shownItem->second + ITEM_HEIGHT);
+            }
+        }
+        for (const auto& crossItems : pattern_->layoutInfo_.waterFlowItems_) {
+            auto item = crossItems.second.lower_bound(pattern_->layoutInfo_.startIndex_);
+            for (; item != crossItems.second.end() && std::next(item) != crossItems.second.end() &&
+                   std::next(item)->first <= pattern_->layoutInfo_.endIndex_;
+                 ++item) {
+                EXPECT_FLOAT_EQ(item->second.first + item->second.second, std::next(item)->second.first);
+            }
+        }
+    }
+}
 } // namespace OHOS::Ace::NG
@@ -2133,14 +2133,14 @@ HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg003, TestSize.Level1)
      */
     taskScheduler.AddPredictTask([](int64_t, bool) {});
     taskScheduler.AddPredictTask(nullptr);
-    EXPECT_EQ(taskScheduler.predictTask_.size(), 2);
+    EXPECT_EQ(taskScheduler.GetPredictTaskCount(), 2);
 
     /**
      * @tc.steps4: Call FlushPredictTask.
      * @tc.expected: predictTask_ in the taskScheduler size is 0.
      */
     taskScheduler.FlushPredictTask(0);
-    EXPECT_EQ(taskScheduler.predictTask_.size(), 0);
+    EXPECT_EQ(taskScheduler.GetPredictTaskCount(), 0);
 }
 
 /**
@@ -2281,6 +2281,184 @@ HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg006, TestSize.Level1)
     EXPECT_EQ(taskScheduler.afterLayoutTasks_.size(), 0);
 }
 
+/**
+ * @tc.name: UITaskSchedulerTestNg007
+ * @tc.desc: Test FlushLayoutTask with parallel layout enabled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg007, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create taskScheduler and enable parallel layout.
+     */
+    UITaskScheduler taskScheduler;
+    FrameInfo frameInfo;
+    taskScheduler.StartRecordFrameInfo(&frameInfo);
+    SystemProperties::parallelLayoutEnabled_ = true;
+
+    /**
+     * @tc.steps2: Create two independent dirty roots and a dirty child covered by the first root.
+     */
+    auto frameNode = FrameNode::GetOrCreateFrameNode(TEST_TAG, 101, nullptr);
+    auto frameNode2 = FrameNode::GetOrCreateFrameNode(TEST_TAG, 102, nullptr);
+    auto frameNode3 = FrameNode::GetOrCreateFrameNode(TEST_TAG, 103, nullptr);
+    frameNode3->MountToParent(frameNode);
+    frameNode->isLayoutDirtyMarked_ = true;
+    frameNode2->isLayoutDirtyMarked_ = true;
+    frameNode3->isLayoutDirtyMarked_ = true;
+    taskScheduler.AddDirtyLayoutNode(frameNode);
+    taskScheduler.AddDirtyLayoutNode(frameNode2);
+    taskScheduler.AddDirtyLayoutNode(frameNode3);
+
+    /**
+     * @tc.steps3: Call FlushLayoutTask.
+     * @tc.expected: roots are laid out once by parallel layout, the covered child is measured with its parent.
+     */
+    taskScheduler.FlushLayoutTask(false);
+    EXPECT_FALSE(frameNode->isLayoutDirtyMarked_);
+    EXPECT_FALSE(frameNode2->isLayoutDirtyMarked_);
+    EXPECT_FALSE(frameNode3->isLayoutDirtyMarked_);
+    EXPECT_EQ(frameInfo.layoutInfos_.size(), 2);
+    EXPECT_FALSE(taskScheduler.IsLayouting());
+    SystemProperties::parallelLayoutEnabled_ = false;
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg008
+ * @tc.desc: Test DirtyLayoutNodeIndex dedupe and order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg008, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create a parent and a child node, queue them in reverse order and queue the child twice.
+     * @tc.expected: the duplicated node is rejected.
+     */
+    DirtyLayoutNodeIndex index;
+    auto parent = FrameNode::GetOrCreateFrameNode(TEST_TAG, 111, nullptr);
+    auto child = FrameNode::GetOrCreateFrameNode(TEST_TAG, 112, nullptr);
+    child->MountToParent(parent);
+    EXPECT_TRUE(index.Add(child));
+    EXPECT_FALSE(index.Add(child));
+    EXPECT_TRUE(index.Add(parent));
+    EXPECT_EQ(index.Size(), 2);
+    EXPECT_TRUE(child->IsInDirtyLayoutIndex());
+
+    /**
+     * @tc.steps2: Walk the index.
+     * @tc.expected: the parent is visited before the child.
+     */
+    std::vector<int32_t> visited;
+    index.Walk([&visited](const RefPtr<FrameNode>& node) { visited.emplace_back(node->GetId()); });
+    ASSERT_EQ(visited.size(), 2);
+    EXPECT_EQ(visited[0], 111);
+    EXPECT_EQ(visited[1], 112);
+
+    /**
+     * @tc.steps3: Mark the child consumed by its parent and flush the index.
+     * @tc.expected: the covered child is dropped and all nodes are dequeued.
+     */
+    child->isLayoutDirtyMarked_ = true;
+    index.Clear();
+    EXPECT_FALSE(child->IsInDirtyLayoutIndex());
+    index.Add(parent);
+    index.Add(child);
+    child->isLayoutDirtyMarked_ = false;
+    visited.clear();
+    index.Flush([&visited](const RefPtr<FrameNode>& node) { visited.emplace_back(node->GetId()); });
+    ASSERT_EQ(visited.size(), 1);
+    EXPECT_EQ(visited[0], 111);
+    EXPECT_TRUE(index.Empty());
+    EXPECT_FALSE(parent->IsInDirtyLayoutIndex());
+    EXPECT_FALSE(child->IsInDirtyLayoutIndex());
+
+    /**
+     * @tc.steps4: Queue nodes of more pages than spare buckets are kept, then flush the index.
+     * @tc.expected: no bucket is left behind, only a few are kept for reuse.
+     */
+    for (uint32_t pageId = 0; pageId < DirtyLayoutNodeIndex::MAX_SPARE_BUCKET_COUNT * 2; ++pageId) {
+        auto node = FrameNode::GetOrCreateFrameNode(TEST_TAG, 113 + static_cast<int32_t>(pageId), nullptr);
+        node->SetHostPageId(static_cast<int32_t>(pageId));
+        index.Add(node);
+    }
+    index.Flush([](const RefPtr<FrameNode>& node) {});
+    EXPECT_TRUE(index.buckets_.empty());
+    EXPECT_EQ(index.spareBuckets_.size(), DirtyLayoutNodeIndex::MAX_SPARE_BUCKET_COUNT);
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg009
+ * @tc.desc: Test FlushPredictTask with priority, owner and deadline.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg009, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Add predict tasks with different priorities, one of them has a destroyed owner.
+     */
+    UITaskScheduler taskScheduler;
+    std::vector<int32_t> order;
+    auto owner = FrameNode::GetOrCreateFrameNode(TEST_TAG, 121, nullptr);
+    WeakPtr<AceType> destroyedOwner;
+    {
+        auto node = FrameNode::CreateFrameNode(TEST_TAG, 122, AceType::MakeRefPtr<Pattern>());
+        destroyedOwner = node;
+    }
+    taskScheduler.AddPredictTask([&order](int64_t, bool) { order.emplace_back(1); });
+    taskScheduler.AddPredictTask(
+        [&order](int64_t, bool) { order.emplace_back(2); }, PredictTaskPriority::LOW, owner, PredictTaskType::UNKNOWN);
+    taskScheduler.AddPredictTask([&order](int64_t, bool) { order.emplace_back(3); }, PredictTaskPriority::HIGH,
+        destroyedOwner, PredictTaskType::UNKNOWN);
+    taskScheduler.AddPredictTask(
+        [&order](int64_t, bool) { order.emplace_back(4); }, PredictTaskPriority::HIGH, owner, PredictTaskType::UNKNOWN);
+    EXPECT_EQ(taskScheduler.GetPredictTaskCount(), 4);
+
+    /**
+     * @tc.steps2: Flush with an expired deadline.
+     * @tc.expected: only the first task of the highest priority runs, the rest are kept for next slot.
+     */
+    EXPECT_TRUE(taskScheduler.FlushPredictTask(0));
+    ASSERT_EQ(order.size(), 1);
+    EXPECT_EQ(order[0], 4);
+    EXPECT_EQ(taskScheduler.GetPredictTaskCount(), 2);
+
+    /**
+     * @tc.steps3: Flush with enough time.
+     * @tc.expected: remaining tasks run in priority order.
+     */
+    EXPECT_FALSE(taskScheduler.FlushPredictTask(INT64_MAX));
+    ASSERT_EQ(order.size(), 3);
+    EXPECT_EQ(order[1], 1);
+    EXPECT_EQ(order[2], 2);
+    EXPECT_FALSE(taskScheduler.HasPredictTask());
+
+    /**
+     * @tc.steps4: Keep a high priority task running first in every slot, ahead of a deferred normal one.
+     * @tc.expected: the normal task runs once it was deferred MAX_PREDICT_DEFERRED_COUNT times, it ran past the
+     *               deadline so no cost is learned from it.
+     */
+    uint32_t highRunCount = 0;
+    bool normalRun = false;
+    UITaskScheduler::PredictTask highTask = [&](int64_t, bool) {
+        ++highRunCount;
+        taskScheduler.AddPredictTask(
+            UITaskScheduler::PredictTask(highTask), PredictTaskPriority::HIGH, owner, PredictTaskType::UNKNOWN);
+    };
+    taskScheduler.AddPredictTask(
+        UITaskScheduler::PredictTask(highTask), PredictTaskPriority::HIGH, owner, PredictTaskType::UNKNOWN);
+    taskScheduler.AddPredictTask(
+        [&normalRun](int64_t, bool) { normalRun = true; }, PredictTaskPriority::NORMAL, owner,
+        PredictTaskType::LAZY_FOR_EACH);
+    for (uint32_t i = 0; i < UITaskScheduler::MAX_PREDICT_DEFERRED_COUNT; ++i) {
+        EXPECT_TRUE(taskScheduler.FlushPredictTask(0));
+        EXPECT_FALSE(normalRun);
+    }
+    EXPECT_FALSE(taskScheduler.FlushPredictTask(0));
+    EXPECT_TRUE(normalRun);
+    EXPECT_EQ(highRunCount, UITaskScheduler::MAX_PREDICT_DEFERRED_COUNT + 1);
+    EXPECT_EQ(taskScheduler.GetPredictTaskCost(PredictTaskType::LAZY_FOR_EACH), 0);
+}
+
 /**
  * @tc.name: PipelineContextTestNg043
  * @tc.desc: Test SetCloseButtonStatus function.
@@ -2897,5 +3075,49 @@ HWTEST_F(PipelineContextTestNg, PipelineContextTestNg063, TestSize.Level1)
     context_->CloseFrontendAnimation();
     EXPECT_EQ(context_->pendingFrontendAnimation_.size(), 0);
 }
+
+/**
+ * @tc.name: PipelineContextTestNg064
+ * @tc.desc: Test HandleOnAreaChangeEvent skips the user callback of nodes without geometry change.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, PipelineContextTestNg064, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create a node with onAreaChange and flush the area change once.
+     * @tc.expected: The callback is fired for the first frame.
+     */
+    auto nodeId = ElementRegister::GetInstance()->MakeUniqueId();
+    auto frameNode = FrameNode::GetOrCreateFrameNode(TEST_TAG, nodeId, nullptr);
+    ASSERT_NE(frameNode, nullptr);
+    int32_t fireCount = 0;
+    frameNode->SetOnAreaChangeCallback(
+        [&fireCount](const RectF& /* oldRect */, const OffsetF& /* oldOrigin */, const RectF& /* rect */,
+            const OffsetF& /* origin */) { ++fireCount; });
+    frameNode->GetGeometryNode()->SetFrameSize(SizeF(DEFAULT_INT10, DEFAULT_INT10));
+    context_->onAreaChangeNodeIds_.clear();
+    context_->AddOnAreaChangeNode(nodeId);
+    context_->HandleOnAreaChangeEvent();
+    EXPECT_EQ(fireCount, 1);
+    EXPECT_FALSE(frameNode->IsGeometryChangedSince(FrameNode::GetGeometryChangeCount()));
+
+    /**
+     * @tc.steps2: Change the frame size without marking the geometry change.
+     * @tc.expected: The node is skipped.
+     */
+    frameNode->GetGeometryNode()->SetFrameSize(SizeF(DEFAULT_INT10 * 2, DEFAULT_INT10 * 2));
+    context_->HandleOnAreaChangeEvent();
+    EXPECT_EQ(fireCount, 1);
+
+    /**
+     * @tc.steps3: Mark the geometry change and flush again.
+     * @tc.expected: The callback is fired with the new size.
+     */
+    frameNode->MarkGeometryChanged();
+    EXPECT_TRUE(frameNode->IsGeometryChangedSince(context_->areaChangeGeometryCount_));
+    context_->HandleOnAreaChangeEvent();
+    EXPECT_EQ(fireCount, 2);
+    context_->onAreaChangeNodeIds_.clear();
+}
 } // namespace NG
 } // namespace OHOS::Ace
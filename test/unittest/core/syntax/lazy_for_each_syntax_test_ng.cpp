@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <optional>
 #include <utility>
 
@@ -28,6 +29,8 @@
 #include "test/mock/core/pipeline/mock_pipeline_base.h"
 
 #include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/custom/custom_node.h"
+#include "core/components_ng/pattern/recycle_view/recycle_dummy_node.h"
 #include "core/components_ng/syntax/lazy_for_each_model_ng.h"
 #include "core/components_ng/syntax/lazy_for_each_node.h"
 #include "core/components_ng/syntax/lazy_layout_wrapper_builder.h"
@@ -1114,4 +1117,144 @@ HWTEST_F(LazyForEachSyntaxTestNg, ForEachSyntaxGetChildrenTest001, TestSize.Leve
     lazyForEachNode->GetChildren();
     EXPECT_TRUE(lazyForEachNode->ids_.empty());
 }
+
+/**
+ * @tc.name: ForEachSyntaxRecycleExpiredItemsTest001
+ * @tc.desc: Invoke RecycleExpiredItems, only expired items without data holding reusable components are released.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachSyntaxTestNg, ForEachSyntaxRecycleExpiredItemsTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create LazyForEachNode.
+     */
+    auto lazyForEachNode = CreateLazyForEachNode();
+    ASSERT_NE(lazyForEachNode, nullptr);
+    auto builder = lazyForEachNode->builder_;
+    ASSERT_NE(builder, nullptr);
+
+    /**
+     * @tc.steps: step2. Expire a reusable item without data, a plain item without data and a reusable item with data.
+     */
+    auto reusableItem = AceType::MakeRefPtr<FrameNode>(V2::LIST_ITEM_ETS_TAG, -1, AceType::MakeRefPtr<Pattern>());
+    reusableItem->AddChild(
+        AceType::MakeRefPtr<FrameNode>(V2::RECYCLE_VIEW_ETS_TAG, -1, AceType::MakeRefPtr<Pattern>()));
+    auto plainItem = AceType::MakeRefPtr<FrameNode>(V2::TEXT_ETS_TAG, -1, AceType::MakeRefPtr<Pattern>());
+    auto cachedItem = AceType::MakeRefPtr<FrameNode>(V2::RECYCLE_VIEW_ETS_TAG, -1, AceType::MakeRefPtr<Pattern>());
+    builder->expiringItem_.clear();
+    builder->expiringItem_.try_emplace("reusable", LazyForEachCacheChild(-1, reusableItem));
+    builder->expiringItem_.try_emplace("plain", LazyForEachCacheChild(-1, plainItem));
+    builder->expiringItem_.try_emplace("cached", LazyForEachCacheChild(INDEX_3, cachedItem));
+
+    /**
+     * @tc.steps: step3. Invoke RecycleExpiredItems.
+     * @tc.expected: Only the reusable item without data is released.
+     */
+    builder->RecycleExpiredItems();
+    EXPECT_EQ(builder->expiringItem_.size(), 2);
+    EXPECT_EQ(builder->expiringItem_.count("reusable"), 0);
+    EXPECT_EQ(builder->expiringItem_.count("plain"), 1);
+    EXPECT_EQ(builder->expiringItem_.count("cached"), 1);
+}
+
+/**
+ * @tc.name: ForEachSyntaxShiftIndexTest001
+ * @tc.desc: Invoke OnDataAdded and OnDataDeleted, the items after the index move with their nodes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachSyntaxTestNg, ForEachSyntaxShiftIndexTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create LazyForEachNode with items from 0 to 6.
+     */
+    auto lazyForEachNode = CreateLazyForEachNode();
+    ASSERT_NE(lazyForEachNode, nullptr);
+    auto builder = lazyForEachNode->builder_;
+    ASSERT_NE(builder, nullptr);
+    ASSERT_EQ(builder->cachedItems_.size(), LAZY_FOR_EACH_NODE_IDS_INT.size());
+    auto middleNode = builder->cachedItems_[INDEX_MIDDLE].second;
+    auto lastNode = builder->cachedItems_[NEW_END_ID].second;
+    builder->expiringItem_.try_emplace("expired", LazyForEachCacheChild(INDEX_8, nullptr));
+    builder->expiringItem_.try_emplace("removed", LazyForEachCacheChild(-1, nullptr));
+
+    /**
+     * @tc.steps: step2. Add data at INDEX_MIDDLE.
+     * @tc.expected: Items from INDEX_MIDDLE on move one index up, the item without data does not move.
+     */
+    builder->OnDataAdded(INDEX_MIDDLE);
+    EXPECT_EQ(builder->cachedItems_.size(), LAZY_FOR_EACH_NODE_IDS_INT.size());
+    EXPECT_EQ(builder->cachedItems_.count(INDEX_MIDDLE), 0);
+    EXPECT_EQ(builder->cachedItems_[INDEX_MIDDLE_2].second, middleNode);
+    EXPECT_EQ(builder->cachedItems_[START_ID].second, lastNode);
+    EXPECT_EQ(builder->expiringItem_["expired"].first, INDEX_8 + 1);
+    EXPECT_EQ(builder->expiringItem_["removed"].first, -1);
+
+    /**
+     * @tc.steps: step3. Delete data at INDEX_2.
+     * @tc.expected: The item at INDEX_2 is returned, the items after it move one index down.
+     */
+    auto deletedNode = builder->cachedItems_[INDEX_2].second;
+    EXPECT_EQ(builder->OnDataDeleted(INDEX_2), deletedNode);
+    EXPECT_EQ(builder->cachedItems_.size(), LAZY_FOR_EACH_NODE_IDS_INT.size() - 1);
+    EXPECT_EQ(builder->cachedItems_.count(INDEX_2), 0);
+    EXPECT_EQ(builder->cachedItems_[INDEX_MIDDLE].second, middleNode);
+    EXPECT_EQ(builder->cachedItems_[NEW_END_ID].second, lastNode);
+    EXPECT_EQ(builder->expiringItem_["expired"].first, INDEX_8);
+    EXPECT_EQ(builder->expiringItem_["removed"].first, -1);
+}
+
+/**
+ * @tc.name: ForEachSyntaxRecyclePoolTest001
+ * @tc.desc: Invoke RecycleExpiredItems and NotifyMemoryLevel, the recycle pool of each type is bounded by cacheCount.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachSyntaxTestNg, ForEachSyntaxRecyclePoolTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create LazyForEachNode with cacheCount 1, so that each type keeps 3 items.
+     */
+    auto lazyForEachNode = CreateLazyForEachNode();
+    ASSERT_NE(lazyForEachNode, nullptr);
+    auto builder = lazyForEachNode->builder_;
+    ASSERT_NE(builder, nullptr);
+    builder->SetCacheCount(INDEX_1);
+
+    /**
+     * @tc.steps: step2. Expire 5 items without data, each holding a reusable component of the same type.
+     */
+    std::vector<RefPtr<RecycleDummyNode>> dummyNodes;
+    builder->expiringItem_.clear();
+    for (int32_t i = 0; i < INDEX_5; i++) {
+        auto item = AceType::MakeRefPtr<FrameNode>(V2::LIST_ITEM_ETS_TAG, -1, AceType::MakeRefPtr<Pattern>());
+        auto dummyNode = AceType::MakeRefPtr<RecycleDummyNode>(-1);
+        auto customNode = CustomNode::CreateCustomNode(ElementRegister::GetInstance()->MakeUniqueId(), "Item");
+        customNode->SetJSViewName("Item");
+        dummyNode->AddChild(customNode);
+        item->AddChild(dummyNode);
+        dummyNodes.emplace_back(dummyNode);
+        builder->expiringItem_.try_emplace(std::to_string(i), LazyForEachCacheChild(-1, item));
+    }
+
+    /**
+     * @tc.steps: step3. Invoke RecycleExpiredItems.
+     * @tc.expected: The 2 oldest items are dropped without recycling, the next one is released to the JS pool and the
+     *               other 2 wait in the pool.
+     */
+    builder->RecycleExpiredItems();
+    EXPECT_TRUE(builder->expiringItem_.empty());
+    ASSERT_EQ(builder->recyclePool_.count("Item"), 1);
+    EXPECT_EQ(builder->recyclePool_["Item"].size(), 2);
+    auto droppedCount = std::count_if(dummyNodes.begin(), dummyNodes.end(),
+        [](const RefPtr<RecycleDummyNode>& dummyNode) { return dummyNode->GetChildren().empty(); });
+    EXPECT_EQ(droppedCount, 2);
+
+    /**
+     * @tc.steps: step4. Invoke NotifyMemoryLevel with a moderate level, then with a low one.
+     * @tc.expected: The pool keeps half of its limit, then nothing.
+     */
+    builder->NotifyMemoryLevel(0);
+    EXPECT_EQ(builder->recyclePool_["Item"].size(), 1);
+    builder->NotifyMemoryLevel(1);
+    EXPECT_TRUE(builder->recyclePool_.empty());
+}
 } // namespace OHOS::Ace::NG